@@ -4,17 +4,243 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <Kokkos_Core.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_session.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_test_case_info.hpp>
 #include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
 #include <catch2/reporters/catch_reporter_registrars.hpp>
 #include <catch2/reporters/catch_reporter_streaming_base.hpp>
 
+#include "NeoN/NeoN.hpp"
+
+namespace NeoN::benchmark
+{
+
+/* @brief The memory traffic in bytes and the floating point operations of a single run. */
+struct WorkModel
+{
+    double bytes = 0.0;
+
+    double flops = 0.0;
+};
+
+/* @brief The achieved performance of a benchmark with a work model. */
+struct RooflineRecord
+{
+    std::string testCase;
+
+    std::string size;
+
+    std::string executor;
+
+    // the mean run time in nanoseconds
+    double mean;
+
+    WorkModel model;
+};
+
+namespace detail
+{
+
+/* @brief the model of the next benchmark, which is consumed once the benchmark ends */
+inline std::optional<WorkModel>& pendingModel()
+{
+    static std::optional<WorkModel> model;
+    return model;
+}
+
+/* @brief the STREAM triad bandwidth of every executor in GB/s */
+inline std::map<std::string, double>& streamBandwidths()
+{
+    static std::map<std::string, double> bandwidths;
+    return bandwidths;
+}
+
+inline std::vector<RooflineRecord>& records()
+{
+    static std::vector<RooflineRecord> records;
+    return records;
+}
+
+/* @brief whether the calling process reports, i.e. the root rank of an MPI run */
+inline bool& isRoot()
+{
+    static bool root = true;
+    return root;
+}
+
+inline std::string& rooflineFile()
+{
+    static std::string file;
+    return file;
+}
+
+inline std::string escape(const std::string& value)
+{
+    std::string escaped;
+    for (auto c : value)
+    {
+        if (c == '"' || c == '\\') escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+}
+
+/* @brief Sets the work model of the next BENCHMARK, i.e. it has to be called right before it.
+ * @param bytes The compulsory memory traffic of a run, i.e. every array is counted once.
+ * @param flops The floating point operations of a run.
+ */
+inline void setWorkModel(double bytes, double flops = 0.0)
+{
+    detail::pendingModel() = WorkModel {bytes, flops};
+}
+
+/* @brief Measures the bandwidth of the STREAM triad a = b + s * c in GB/s.
+ * @details The best of several runs after a warm-up run is used, as done by STREAM.
+ */
+inline double measureStreamBandwidth(const Executor& exec, localIdx size = 1 << 24, int nRuns = 5)
+{
+    Vector<scalar> a(exec, size, 0.0);
+    Vector<scalar> b(exec, size, 1.0);
+    Vector<scalar> c(exec, size, 2.0);
+    auto [aView, bView, cView] = views(a, b, c);
+    const scalar s = 3.0;
+    double best = std::numeric_limits<double>::max();
+    for (int run = 0; run <= nRuns; run++)
+    {
+        fence(exec);
+        const auto start = std::chrono::steady_clock::now();
+        parallelFor(
+            exec,
+            {0, size},
+            KOKKOS_LAMBDA(const localIdx i) { aView[i] = bView[i] + s * cView[i]; },
+            "streamTriad"
+        );
+        fence(exec);
+        const std::chrono::duration<double, std::nano> elapsed =
+            std::chrono::steady_clock::now() - start;
+        if (run > 0) best = std::min(best, elapsed.count());
+    }
+    return 3.0 * sizeof(scalar) * double(size) / best;
+}
+
+/* @class RooflineListener
+ * @brief Reports the achieved bandwidth, the achieved GFLOP/s and the fraction of the memory
+ * roofline of every benchmark with a work model.
+ *
+ * The name of a BENCHMARK is the executor and the innermost section is the size, as in all
+ * benchmarks. The roofline of a memory bound kernel is the STREAM bandwidth of the executor
+ * times the arithmetic intensity, thus the fraction of the roofline is the achieved fraction of
+ * the STREAM bandwidth. The results are printed to stderr, since stdout holds the report, and
+ * written as JSON records at the end of the run.
+ */
+class RooflineListener : public Catch::EventListenerBase
+{
+public:
+
+    using Catch::EventListenerBase::EventListenerBase;
+
+    void testCaseStarting(const Catch::TestCaseInfo& info) override { testCase_ = info.name; }
+
+    void sectionStarting(const Catch::SectionInfo& info) override
+    {
+        sections_.push_back(info.name);
+    }
+
+    void sectionEnded(const Catch::SectionStats&) override
+    {
+        sections_.pop_back();
+        // a skipped benchmark must not pass its model to the next one
+        detail::pendingModel().reset();
+    }
+
+    void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override
+    {
+        auto model = std::exchange(detail::pendingModel(), std::nullopt);
+        if (!model || !detail::isRoot()) return;
+        RooflineRecord record {
+            testCase_,
+            sections_.empty() ? std::string() : sections_.back(),
+            stats.info.name,
+            stats.mean.point.count(),
+            *model
+        };
+        const double bandwidth = record.model.bytes / record.mean;
+        const double gflops = record.model.flops / record.mean;
+        std::cerr << record.testCase << " [" << record.size << "] " << record.executor << ": "
+                  << bandwidth << " GB/s, " << gflops << " GFLOP/s";
+        const auto roof = detail::streamBandwidths().find(record.executor);
+        if (roof != detail::streamBandwidths().end())
+        {
+            std::cerr << ", " << 100.0 * bandwidth / roof->second << " % of the roofline";
+        }
+        std::cerr << std::endl;
+        detail::records().push_back(std::move(record));
+    }
+
+    void testRunEnded(const Catch::TestRunStats&) override
+    {
+        if (detail::records().empty() || detail::rooflineFile().empty()) return;
+        std::ofstream out(detail::rooflineFile());
+        out << "[";
+        for (std::size_t i = 0; i < detail::records().size(); i++)
+        {
+            const auto& record = detail::records()[i];
+            const double bandwidth = record.model.bytes / record.mean;
+            const auto roof = detail::streamBandwidths().find(record.executor);
+            out << (i > 0 ? ",\n " : "\n ") << "{\"test_case\": \""
+                << detail::escape(record.testCase) << "\", \"size\": \""
+                << detail::escape(record.size) << "\", \"executor\": \""
+                << detail::escape(record.executor) << "\", \"mean\": " << record.mean
+                << ", \"bytes\": " << record.model.bytes << ", \"flops\": " << record.model.flops
+                << ", \"bandwidth\": " << bandwidth
+                << ", \"gflops\": " << record.model.flops / record.mean;
+            if (roof != detail::streamBandwidths().end())
+            {
+                out << ", \"streamBandwidth\": " << roof->second
+                    << ", \"rooflineFraction\": " << bandwidth / roof->second;
+            }
+            out << "}";
+        }
+        out << "\n]\n";
+    }
+
+private:
+
+    std::string testCase_;
+
+    std::vector<std::string> sections_;
+};
+
+}
+
+CATCH_REGISTER_LISTENER(NeoN::benchmark::RooflineListener)
+
 int main(int argc, char* argv[])
 {
+#ifdef NF_WITH_MPI_SUPPORT
+    // MPI is finalized after Kokkos, only the root rank reports when run with mpirun
+    NeoN::mpi::MPIInit mpi(argc, argv);
+    NeoN::benchmark::detail::isRoot() = NeoN::mpi::MPIEnvironment().rank() == 0;
+#endif
+
     // Initialize Catch2
     Kokkos::ScopeGuard guard(argc, argv);
     Catch::Session session;
@@ -23,6 +249,31 @@ int main(int argc, char* argv[])
     int returnCode = session.applyCommandLine(argc, argv);
     if (returnCode != 0) // Indicates a command line error
         return returnCode;
+    if (!NeoN::benchmark::detail::isRoot())
+    {
+        session.configData().defaultOutputFilename = "/dev/null";
+    }
+
+    // the achievable bandwidth of every executor is the reference of the roofline report
+    for (const auto& exec :
+         {NeoN::Executor(NeoN::SerialExecutor {}),
+          NeoN::Executor(NeoN::CPUExecutor {}),
+          NeoN::Executor(NeoN::GPUExecutor {})})
+    {
+        const auto name = std::visit([](const auto& e) { return e.name(); }, exec);
+        const auto bandwidth = NeoN::benchmark::measureStreamBandwidth(exec);
+        NeoN::benchmark::detail::streamBandwidths()[name] = bandwidth;
+        if (NeoN::benchmark::detail::isRoot())
+        {
+            std::cerr << "STREAM triad bandwidth of " << name << ": " << bandwidth << " GB/s"
+                      << std::endl;
+        }
+    }
+    if (NeoN::benchmark::detail::isRoot())
+    {
+        NeoN::benchmark::detail::rooflineFile() =
+            std::filesystem::path(argv[0]).filename().string() + "_roofline.json";
+    }
 
     int result = session.run();
 
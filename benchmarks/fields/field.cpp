@@ -23,6 +23,8 @@ TEST_CASE("Vector<scalar>::addition", "[bench]")
         NeoN::Vector<NeoN::scalar> cpuC(exec, size);
         NeoN::fill(cpuC, 0.0);
 
+        // read two and write one vector with one flop per entry
+        NeoN::benchmark::setWorkModel(3.0 * sizeof(NeoN::scalar) * size, size);
         BENCHMARK(std::string(execName)) { return (cpuC = cpuA + cpuB); };
     }
 }
@@ -42,6 +44,8 @@ TEST_CASE("Vector<scalar>::multiplication", "[bench]")
         NeoN::Vector<NeoN::scalar> cpuC(exec, size);
         NeoN::fill(cpuC, 0.0);
 
+        // read two and write one vector with one flop per entry
+        NeoN::benchmark::setWorkModel(3.0 * sizeof(NeoN::scalar) * size, size);
         BENCHMARK(std::string(execName)) { return (cpuC = cpuA * cpuB); };
     }
 }
@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "benchmarks/finiteVolume/cellCentred/implicit/common.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+TEST_CASE("VolumeField::correctBoundaryConditions", "[bench]")
+{
+    auto n = GENERATE(16, 32, 64);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = NeoN::create3DUniformMesh(exec, n, n, n);
+    fvcc::VolumeField<NeoN::scalar> phi(exec, "phi", mesh, inletOutletBCs<NeoN::scalar>(mesh));
+    NeoN::fill(phi.internalVector(), 1.0);
+
+    DYNAMIC_SECTION("" << mesh.nCells())
+    {
+        BENCHMARK(std::string(execName))
+        {
+            phi.correctBoundaryConditions();
+            NeoN::fence(exec);
+        };
+    }
+}
@@ -0,0 +1,204 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+/* @brief A fixed value at the x- patch and zero gradient at all other physical patches.
+ * The trailing patches of a decomposed mesh are processor patches to the given neighbour ranks.
+ */
+template<typename ValueType>
+std::vector<fvcc::VolumeBoundary<ValueType>> inletOutletBCs(
+    const NeoN::UnstructuredMesh& mesh, const std::vector<NeoN::label>& neighbourRanks = {}
+)
+{
+    const auto nPhysical = mesh.nBoundaries() - static_cast<NeoN::localIdx>(neighbourRanks.size());
+    std::vector<fvcc::VolumeBoundary<ValueType>> bcs;
+    bcs.emplace_back(
+        mesh,
+        NeoN::Dictionary(
+            {{"type", std::string("fixedValue")}, {"fixedValue", NeoN::one<ValueType>()}}
+        ),
+        0
+    );
+    for (NeoN::localIdx patchi = 1; patchi < nPhysical; patchi++)
+    {
+        bcs.emplace_back(
+            mesh,
+            NeoN::Dictionary(
+                {{"type", std::string("fixedGradient")}, {"fixedGradient", NeoN::zero<ValueType>()}}
+            ),
+            patchi
+        );
+    }
+    for (NeoN::localIdx patchi = nPhysical; patchi < mesh.nBoundaries(); patchi++)
+    {
+        bcs.emplace_back(
+            mesh,
+            NeoN::Dictionary(
+                {{"type", std::string("processor")},
+                 {"neighbourRank", neighbourRanks[static_cast<size_t>(patchi - nPhysical)]}}
+            ),
+            patchi
+        );
+    }
+    return bcs;
+}
+
+/* @brief creates the transported field in the database */
+struct CreateTransportedField
+{
+    const NeoN::UnstructuredMesh& mesh;
+
+    const std::vector<NeoN::label>& neighbourRanks;
+
+    NeoN::Document operator()(NeoN::Database& db)
+    {
+        NeoN::Field<NeoN::scalar> domainVector(
+            mesh.exec(),
+            NeoN::Vector<NeoN::scalar>(mesh.exec(), mesh.nCells(), 0.0),
+            mesh.boundaryMesh().offset()
+        );
+        fvcc::VolumeField<NeoN::scalar> phi(
+            mesh.exec(),
+            "phi",
+            mesh,
+            domainVector,
+            inletOutletBCs<NeoN::scalar>(mesh, neighbourRanks),
+            db,
+            "",
+            ""
+        );
+        phi.correctBoundaryConditions();
+        return NeoN::Document(
+            {{"name", phi.name},
+             {"timeIndex", std::int64_t(1)},
+             {"iterationIndex", std::int64_t(0)},
+             {"subCycleIndex", std::int64_t(0)},
+             {"field", phi}},
+            fvcc::validateVectorDoc
+        );
+    }
+};
+
+/* @class TransportProblem
+ * @brief Scalar transport with a uniform velocity in x direction on a 3D uniform mesh with n^3
+ * cells, i.e. ddt(phi) + div(faceFlux, phi) - laplacian(gamma, phi) = 0 with phi = 1 at the
+ * inlet.
+ */
+class TransportProblem
+{
+public:
+
+    TransportProblem(const NeoN::Executor& exec, NeoN::localIdx n)
+        : TransportProblem(NeoN::create3DUniformMesh(exec, n, n, n))
+    {}
+
+    /* @brief the problem on the given mesh, e.g. the part of a decomposed mesh
+     * @param neighbourRanks The neighbour rank of every trailing processor patch.
+     */
+    TransportProblem(NeoN::UnstructuredMesh partMesh, std::vector<NeoN::label> partNeighbours = {})
+        : neighbourRanks(std::move(partNeighbours)), mesh(std::move(partMesh)),
+          faceFlux(
+              mesh.exec(),
+              "faceFlux",
+              mesh,
+              fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh)
+          ),
+          gamma(
+              mesh.exec(),
+              "gamma",
+              mesh,
+              fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh)
+          ),
+          coeff(
+              mesh.exec(),
+              "coeff",
+              mesh,
+              fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh)
+          ),
+          phi(fvcc::VectorCollection::instance(db, "fieldCollection")
+                  .registerVector<fvcc::VolumeField<NeoN::scalar>>(
+                      CreateTransportedField {mesh, neighbourRanks}
+                  ))
+    {
+        const auto& exec = mesh.exec();
+        // the flux of the velocity (1, 0, 0)
+        auto [flux, faceAreas] = NeoN::views(faceFlux.internalVector(), mesh.faceAreas());
+        NeoN::parallelFor(
+            exec,
+            {0, faceFlux.internalVector().size()},
+            KOKKOS_LAMBDA(const NeoN::localIdx facei) { flux[facei] = faceAreas[facei][0]; }
+        );
+        NeoN::fill(gamma.internalVector(), 0.01);
+        NeoN::fill(coeff.internalVector(), 1.0);
+        fvcc::oldTime(phi).internalVector() = phi.internalVector();
+
+        fvSchemes.insert("ddtSchemes", NeoN::Dictionary({{"type", std::string("backwardEuler")}}));
+        fvSchemes.insert(
+            "divSchemes",
+            NeoN::Dictionary(
+                {{"div(faceFlux,phi)",
+                  NeoN::TokenList({std::string("Gauss"), std::string("upwind")})}}
+            )
+        );
+        fvSchemes.insert(
+            "laplacianSchemes",
+            NeoN::Dictionary(
+                {{"laplacian(gamma,phi)",
+                  NeoN::TokenList(
+                      {std::string("Gauss"), std::string("linear"), std::string("uncorrected")}
+                  )}}
+            )
+        );
+        fvSolution = solverDict("solver::Bicgstab");
+    }
+
+    /* @brief the transport equation, the convection term is optional */
+    NeoN::dsl::Expression<NeoN::scalar> expression(bool convection = true)
+    {
+        NeoN::dsl::Expression<NeoN::scalar> eqn(mesh.exec());
+        eqn.addOperator(NeoN::dsl::imp::ddt(phi));
+        if (convection) eqn.addOperator(NeoN::dsl::imp::div(faceFlux, phi));
+        eqn.addOperator(NeoN::dsl::Coeff(-1.0) * NeoN::dsl::imp::laplacian(gamma, phi));
+        eqn.read(fvSchemes);
+        return eqn;
+    }
+
+    /* @brief the settings of a Ginkgo solver of the given type */
+    static NeoN::Dictionary solverDict(const std::string& type)
+    {
+        return NeoN::Dictionary(
+            {{"solver", std::string("Ginkgo")},
+             {"type", type},
+             {"criteria",
+              NeoN::Dictionary({{"iteration", 1000}, {"relative_residual_norm", 1e-8}})}}
+        );
+    }
+
+    std::vector<NeoN::label> neighbourRanks;
+
+    NeoN::Database db;
+
+    NeoN::UnstructuredMesh mesh;
+
+    fvcc::SurfaceField<NeoN::scalar> faceFlux;
+
+    fvcc::SurfaceField<NeoN::scalar> gamma;
+
+    fvcc::VolumeField<NeoN::scalar> coeff;
+
+    fvcc::VolumeField<NeoN::scalar>& phi;
+
+    NeoN::Dictionary fvSchemes;
+
+    NeoN::Dictionary fvSolution;
+};
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "benchmarks/finiteVolume/cellCentred/implicit/common.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+TEST_CASE("DivOperator::implicit", "[bench]")
+{
+    auto n = GENERATE(16, 32, 64);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    TransportProblem problem(exec, n);
+    auto ls = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(
+        problem.mesh, NeoN::la::SparsityPattern::readOrCreate(problem.mesh)
+    );
+    NeoN::dsl::SpatialOperator<NeoN::scalar> op =
+        NeoN::dsl::imp::div(problem.faceFlux, problem.phi);
+    op.read(problem.fvSchemes);
+
+    DYNAMIC_SECTION("" << problem.mesh.nCells())
+    {
+        BENCHMARK(std::string(execName))
+        {
+            ls.reset();
+            op.implicitOperation(ls);
+            NeoN::fence(exec);
+        };
+    }
+}
+
+TEST_CASE("LaplacianOperator::implicit", "[bench]")
+{
+    auto n = GENERATE(16, 32, 64);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    TransportProblem problem(exec, n);
+    auto ls = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(
+        problem.mesh, NeoN::la::SparsityPattern::readOrCreate(problem.mesh)
+    );
+    NeoN::dsl::SpatialOperator<NeoN::scalar> op =
+        NeoN::dsl::imp::laplacian(problem.gamma, problem.phi);
+    op.read(problem.fvSchemes);
+
+    DYNAMIC_SECTION("" << problem.mesh.nCells())
+    {
+        BENCHMARK(std::string(execName))
+        {
+            ls.reset();
+            op.implicitOperation(ls);
+            NeoN::fence(exec);
+        };
+    }
+}
+
+TEST_CASE("SourceTerm::implicit", "[bench]")
+{
+    auto n = GENERATE(16, 32, 64);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    TransportProblem problem(exec, n);
+    auto ls = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(
+        problem.mesh, NeoN::la::SparsityPattern::readOrCreate(problem.mesh)
+    );
+    NeoN::dsl::SpatialOperator<NeoN::scalar> op =
+        NeoN::dsl::imp::source(problem.coeff, problem.phi);
+
+    DYNAMIC_SECTION("" << problem.mesh.nCells())
+    {
+        BENCHMARK(std::string(execName))
+        {
+            ls.reset();
+            op.implicitOperation(ls);
+            NeoN::fence(exec);
+        };
+    }
+}
+
+TEST_CASE("DdtOperator::implicit", "[bench]")
+{
+    auto n = GENERATE(16, 32, 64);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    TransportProblem problem(exec, n);
+    auto ls = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(
+        problem.mesh, NeoN::la::SparsityPattern::readOrCreate(problem.mesh)
+    );
+    NeoN::dsl::TemporalOperator<NeoN::scalar> op = NeoN::dsl::imp::ddt(problem.phi);
+
+    DYNAMIC_SECTION("" << problem.mesh.nCells())
+    {
+        BENCHMARK(std::string(execName))
+        {
+            ls.reset();
+            op.implicitOperation(ls, 0.0, 0.1);
+            NeoN::fence(exec);
+        };
+    }
+}
+
+TEST_CASE("Expression::assemble", "[bench]")
+{
+    auto n = GENERATE(16, 32, 64);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    TransportProblem problem(exec, n);
+    const auto& sp = NeoN::la::SparsityPattern::readOrCreate(problem.mesh);
+    auto ls = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(problem.mesh, sp);
+    auto eqn = problem.expression();
+
+    DYNAMIC_SECTION("" << problem.mesh.nCells())
+    {
+        BENCHMARK(std::string(execName))
+        {
+            ls.reset();
+            eqn.assemble(0.0, 0.1, sp, ls);
+            NeoN::fence(exec);
+        };
+    }
+}
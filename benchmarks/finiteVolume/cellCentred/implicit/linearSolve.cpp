@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "benchmarks/finiteVolume/cellCentred/implicit/common.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+/* @brief solves the assembled system of the transport problem from a zero initial guess */
+void benchmarkSolve(
+    const std::string& execName,
+    TransportProblem& problem,
+    bool convection,
+    const NeoN::Dictionary& solverDict
+)
+{
+    const auto& exec = problem.mesh.exec();
+    const auto& sp = NeoN::la::SparsityPattern::readOrCreate(problem.mesh);
+    auto ls = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(problem.mesh, sp);
+    problem.expression(convection).assemble(0.0, 0.1, sp, ls);
+    auto solver = NeoN::la::Solver(exec, solverDict);
+    NeoN::Vector<NeoN::scalar> x(exec, problem.mesh.nCells(), 0.0);
+
+    DYNAMIC_SECTION("" << problem.mesh.nCells())
+    {
+        BENCHMARK(std::string(execName))
+        {
+            NeoN::fill(x, 0.0);
+            return solver.solve(ls, x);
+        };
+    }
+}
+
+#if NF_WITH_GINKGO
+
+TEST_CASE("Solver::Ginkgo::Cg", "[bench]")
+{
+    auto n = GENERATE(16, 32, 64);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    // without convection the system is symmetric
+    TransportProblem problem(exec, n);
+    benchmarkSolve(execName, problem, false, TransportProblem::solverDict("solver::Cg"));
+}
+
+TEST_CASE("Solver::Ginkgo::Bicgstab", "[bench]")
+{
+    auto n = GENERATE(16, 32, 64);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    TransportProblem problem(exec, n);
+    benchmarkSolve(execName, problem, true, TransportProblem::solverDict("solver::Bicgstab"));
+}
+
+#endif
+
+#if NF_WITH_PETSC
+
+TEST_CASE("Solver::Petsc", "[bench]")
+{
+    auto n = GENERATE(16, 32, 64);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    TransportProblem problem(exec, n);
+    benchmarkSolve(execName, problem, true, NeoN::Dictionary({{"solver", std::string("Petsc")}}));
+}
+
+#endif
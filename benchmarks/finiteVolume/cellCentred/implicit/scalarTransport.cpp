@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "benchmarks/finiteVolume/cellCentred/implicit/common.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+// only needed for msvc
+template class NeoN::timeIntegration::BackwardEuler<fvcc::VolumeField<NeoN::scalar>>;
+
+#if NF_WITH_GINKGO
+
+// the fvSolution of the problem selects a Ginkgo solver
+TEST_CASE("ScalarTransport::timeStep", "[bench]")
+{
+    auto n = GENERATE(16, 32, 64);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    TransportProblem problem(exec, n);
+    auto eqn = problem.expression();
+    const NeoN::scalar dt = 0.1;
+    NeoN::scalar time = 0.0;
+
+    // a time step includes the assembly, the linear solve and the boundary update
+    DYNAMIC_SECTION("" << problem.mesh.nCells())
+    {
+        BENCHMARK(std::string(execName))
+        {
+            auto stats = NeoN::dsl::solve(
+                eqn, problem.phi, time, dt, problem.fvSchemes, problem.fvSolution
+            );
+            problem.phi.correctBoundaryConditions();
+            time += dt;
+            return stats;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+TEST_CASE("SparsityPattern::construct", "[bench]")
+{
+    auto n = GENERATE(16, 32, 64);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = NeoN::create3DUniformMesh(exec, n, n, n);
+
+    // capture the number of cells as section name
+    DYNAMIC_SECTION("" << mesh.nCells())
+    {
+        BENCHMARK(std::string(execName))
+        {
+            auto sp = NeoN::la::SparsityPattern(mesh);
+            NeoN::fence(exec);
+            return sp;
+        };
+    }
+}
@@ -41,6 +41,15 @@ TEMPLATE_TEST_CASE("linear", "[template]", NeoN::scalar, NeoN::Vec3)
     // capture the value of size as section name
     DYNAMIC_SECTION("" << size)
     {
+        // the weights and the result of every face, the owner and neighbour of every internal
+        // face and the field of every cell, each internal face computes w * a + (1 - w) * b
+        const double nComponents = sizeof(TestType) / sizeof(scalar);
+        NeoN::benchmark::setWorkModel(
+            double(mesh.nFaces()) * (sizeof(scalar) + sizeof(TestType))
+                + double(mesh.nInternalFaces()) * 2 * sizeof(localIdx)
+                + double(mesh.nCells()) * sizeof(TestType),
+            double(mesh.nInternalFaces()) * (1 + 3 * nComponents)
+        );
         BENCHMARK(std::string(execName)) { return (linear.interpolate(in, out)); };
     }
 }
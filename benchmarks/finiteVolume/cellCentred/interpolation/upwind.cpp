@@ -44,6 +44,13 @@ TEMPLATE_TEST_CASE("upwind", "[template]", NeoN::scalar, NeoN::Vec3)
     // capture the value of size as section name
     DYNAMIC_SECTION("" << size)
     {
+        // the flux and the result of every face, the upwind cell of every internal face and the
+        // field of every cell, upwinding only copies values
+        NeoN::benchmark::setWorkModel(
+            double(mesh.nFaces()) * (sizeof(scalar) + sizeof(TestType))
+                + double(mesh.nInternalFaces()) * sizeof(localIdx)
+                + double(mesh.nCells()) * sizeof(TestType)
+        );
         BENCHMARK(std::string(execName)) { return (upwind.interpolate(flux, in, out)); };
     }
 }
@@ -32,6 +32,21 @@ TEST_CASE("DivOperator::div", "[bench]")
         NeoN::Input input = NeoN::TokenList({std::string("Gauss"), std::string("linear")});
         auto op = fvcc::DivOperator(Operator::Type::Explicit, faceFlux, phi, input);
 
+        // the linear interpolation, the sum of the face fluxes into the cells and the scaling by
+        // the cell volumes
+        const double nFaces = mesh.nFaces();
+        const double nInternalFaces = mesh.nInternalFaces();
+        const double nCells = mesh.nCells();
+        const double scalarBytes = sizeof(NeoN::scalar);
+        const double indexBytes = sizeof(NeoN::localIdx);
+        const double interpolationBytes =
+            nFaces * 2 * scalarBytes + nInternalFaces * 2 * indexBytes + nCells * scalarBytes;
+        const double fluxBytes = nInternalFaces * 2 * (scalarBytes + indexBytes)
+                               + nCells * 2 * scalarBytes;
+        const double scalingBytes = nCells * 3 * scalarBytes;
+        NeoN::benchmark::setWorkModel(
+            interpolationBytes + fluxBytes + scalingBytes, nInternalFaces * 7 + nCells * 2
+        );
         BENCHMARK(std::string(execName)) { return (op.div(divPhi)); };
     }
 }
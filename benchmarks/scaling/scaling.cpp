@@ -0,0 +1,267 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "NeoN/NeoN.hpp"
+#include "benchmarks/catch_main.hpp"
+#include "benchmarks/finiteVolume/cellCentred/implicit/common.hpp"
+#include "test/catch2/executorGenerator.hpp"
+
+#include <catch2/interfaces/catch_interfaces_config.hpp>
+#include <catch2/internal/catch_context.hpp>
+
+// only needed for msvc
+template class NeoN::timeIntegration::BackwardEuler<fvcc::VolumeField<NeoN::scalar>>;
+
+/* @brief The parallel layout of a run, a worker is a thread of the CPU executor or a rank. */
+struct Layout
+{
+    int nRanks = 1;
+
+    int rank = 0;
+
+    int nThreads = 1;
+
+    int nWorkers() const { return nRanks * nThreads; }
+};
+
+Layout currentLayout(const NeoN::Executor& exec)
+{
+    Layout layout;
+#ifdef NF_WITH_MPI_SUPPORT
+    NeoN::mpi::MPIEnvironment mpiEnviron;
+    layout.nRanks = static_cast<int>(mpiEnviron.sizeRank());
+    layout.rank = static_cast<int>(mpiEnviron.rank());
+#endif
+    if (std::holds_alternative<NeoN::CPUExecutor>(exec))
+    {
+        layout.nThreads = Kokkos::num_threads();
+    }
+    return layout;
+}
+
+/* @brief the run time of the slowest rank */
+double slowestRank(double time)
+{
+#ifdef NF_WITH_MPI_SUPPORT
+    NeoN::mpi::allReduce(time, NeoN::mpi::ReduceOp::Max, MPI_COMM_WORLD);
+#endif
+    return time;
+}
+
+void barrier()
+{
+#ifdef NF_WITH_MPI_SUPPORT
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+}
+
+/* @brief The part of the calling rank of the uniform mesh with nx * ny * nz cells.
+ *
+ * Every rank creates and decomposes the complete mesh by recursive coordinate bisection, which is
+ * affordable for the rank counts of a single node. Without MPI the complete mesh is returned.
+ */
+TransportProblem createProblem(
+    const NeoN::Executor& exec,
+    const Layout& layout,
+    NeoN::localIdx nx,
+    NeoN::localIdx ny,
+    NeoN::localIdx nz
+)
+{
+#ifdef NF_WITH_MPI_SUPPORT
+    if (layout.nRanks > 1)
+    {
+        auto mesh = NeoN::create3DUniformMesh(NeoN::SerialExecutor {}, nx, ny, nz);
+        NeoN::Dictionary dict({{"method", std::string("RCB")}});
+        auto cellToPart = NeoN::Partitioner::create(dict)->partition(mesh, layout.nRanks);
+        auto parts = NeoN::decomposeMesh(mesh, cellToPart, layout.nRanks, exec);
+        auto& part = parts[static_cast<size_t>(layout.rank)];
+        NeoN::ProcessorInterface::attach(
+            part.mesh,
+            std::make_shared<NeoN::ProcessorInterface>(
+                part.mesh, part.nPhysicalBoundaries, part.sendMap, part.receiveMap
+            )
+        );
+        return TransportProblem(std::move(part.mesh), part.neighbourParts);
+    }
+#endif
+    (void)layout;
+    return TransportProblem(NeoN::create3DUniformMesh(exec, nx, ny, nz));
+}
+
+/* @brief Times the operator and step suite on the given problem and appends a row per kernel to
+ * scaling.csv, which scripts/scaling.py turns into efficiency tables.
+ *
+ * Unlike BENCHMARK, every kernel is run a fixed number of times, i.e. --benchmark-samples, since
+ * the halo exchanges and reductions are collective. The time of a run is that of the slowest
+ * rank. The linear solver runs a fixed number of iterations so that the work of a time step does
+ * not depend on the decomposition.
+ */
+void runSuite(
+    const std::string& mode,
+    NeoN::localIdx n,
+    const std::string& execName,
+    const Layout& layout,
+    NeoN::localIdx nCells,
+    TransportProblem& problem
+)
+{
+    const auto& exec = problem.mesh.exec();
+    const auto& mesh = problem.mesh;
+    auto& phi = problem.phi;
+    const int nRuns = static_cast<int>(Catch::getCurrentContext().getConfig()->benchmarkSamples());
+
+    auto linear = fvcc::SurfaceInterpolation<NeoN::scalar>(
+        exec, mesh, NeoN::TokenList({std::string("linear")})
+    );
+    fvcc::SurfaceField<NeoN::scalar> phif(
+        exec, "phif", mesh, fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh)
+    );
+    fvcc::GaussGreenGrad grad(exec, mesh);
+    auto div = fvcc::DivOperator(
+        NeoN::dsl::Operator::Type::Explicit,
+        problem.faceFlux,
+        phi,
+        NeoN::TokenList({std::string("Gauss"), std::string("linear")})
+    );
+    NeoN::Vector<NeoN::scalar> divPhi(exec, mesh.nCells(), 0.0);
+    auto eqn = problem.expression();
+    const auto& sp = NeoN::la::SparsityPattern::readOrCreate(mesh);
+    auto ls = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(mesh, sp);
+    const bool decomposed = NeoN::ProcessorInterface::read(mesh) != nullptr;
+    const NeoN::scalar dt = 0.1;
+    NeoN::scalar time = 0.0;
+
+    std::vector<std::pair<std::string, std::function<void()>>> kernels {
+        {"interpolate::linear", [&]() { linear.interpolate(phi, phif); }},
+        {"grad::gaussGreen", [&]() { return grad.grad(phi); }},
+        {"div::explicit", [&]() { div.explicitOperation(divPhi); }},
+        {"correctBoundaryConditions", [&]() { phi.correctBoundaryConditions(); }},
+        {"assemble::implicit",
+         [&]()
+         {
+             ls.reset();
+             eqn.assemble(time, dt, sp, ls);
+         }}
+    };
+#if NF_WITH_GINKGO
+    auto solver = NeoN::la::Solver(
+        exec,
+        NeoN::Dictionary(
+            {{"solver", std::string("Ginkgo")},
+             {"type", std::string("solver::Bicgstab")},
+             {"criteria",
+              NeoN::Dictionary({{"iteration", 20}, {"relative_residual_norm", 1e-14}})}}
+        )
+    );
+    kernels.push_back(
+        {"timeStep",
+         [&]()
+         {
+             ls.reset();
+             eqn.assemble(time, dt, sp, ls);
+             if (decomposed)
+             {
+                 NeoN::la::DistributedLinearSystem<NeoN::scalar, NeoN::localIdx> dls(mesh, ls);
+                 solver.solve(dls, phi.internalVector());
+             }
+             else
+             {
+                 solver.solve(ls, phi.internalVector());
+             }
+             phi.correctBoundaryConditions();
+             time += dt;
+         }}
+    );
+#else
+    (void)decomposed;
+#endif
+
+    std::ofstream out;
+    if (layout.rank == 0)
+    {
+        const bool header =
+            !std::filesystem::exists("scaling.csv") || std::filesystem::is_empty("scaling.csv");
+        out.open("scaling.csv", std::ios::app);
+        if (header)
+        {
+            out << "mode,size,kernel,executor,nRanks,nThreads,nWorkers,nCells,samples,mean,min\n";
+        }
+    }
+    for (auto& [name, kernel] : kernels)
+    {
+        // a warm-up run, e.g. to create the geometry schemes
+        kernel();
+        NeoN::fence(exec);
+        double sum = 0.0;
+        double min = std::numeric_limits<double>::max();
+        for (int run = 0; run < nRuns; run++)
+        {
+            barrier();
+            const auto start = std::chrono::steady_clock::now();
+            kernel();
+            NeoN::fence(exec);
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            const double runTime = slowestRank(elapsed.count());
+            sum += runTime;
+            min = std::min(min, runTime);
+        }
+        if (layout.rank == 0)
+        {
+            out << mode << "," << n << "," << name << "," << execName << "," << layout.nRanks
+                << "," << layout.nThreads << "," << layout.nWorkers() << "," << nCells << ","
+                << nRuns << "," << sum / nRuns << "," << min << "\n";
+        }
+    }
+}
+
+TEST_CASE("Scaling::strong", "[scaling]")
+{
+    auto n = GENERATE(64, 128);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    // the mesh has n^3 cells independent of the number of workers
+    DYNAMIC_SECTION("" << execName)
+    {
+        DYNAMIC_SECTION("" << n)
+        {
+            const auto layout = currentLayout(exec);
+            auto problem = createProblem(exec, layout, n, n, n);
+            runSuite("strong", n, execName, layout, n * n * n, problem);
+        }
+    }
+}
+
+TEST_CASE("Scaling::weak", "[scaling]")
+{
+    auto n = GENERATE(32, 64);
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    // every worker owns n^3 cells, the mesh is extended in x direction
+    DYNAMIC_SECTION("" << execName)
+    {
+        DYNAMIC_SECTION("" << n)
+        {
+            const auto layout = currentLayout(exec);
+            const NeoN::localIdx nx = n * layout.nWorkers();
+            auto problem = createProblem(exec, layout, nx, n, n);
+            runSuite("weak", n, execName, layout, nx * n * n, problem);
+        }
+    }
+}
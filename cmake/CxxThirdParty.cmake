@@ -35,6 +35,10 @@ if(${NeoN_WITH_PETSC})
   message("${PETSc_PREFIX}")
 endif()
 
+# the VTU output writes on a worker thread and compresses with zlib if available
+find_package(Threads REQUIRED)
+find_package(ZLIB QUIET)
+
 find_package(Kokkos ${NeoN_KOKKOS_CHECKOUT_VERSION} QUIET)
 
 if(NOT Kokkos_FOUND)
@@ -140,7 +144,7 @@ if(${NeoN_WITH_SUNDIALS})
       "BUILD_TESTING OFF"
       "EXAMPLES_INSTALL OFF"
       "BUILD_ARKODE ON"
-      "BUILD_CVODE OFF"
+      "BUILD_CVODE ON"
       "BUILD_CVODES OFF"
       "BUILD_IDA OFF"
       "BUILD_IDAS OFF"
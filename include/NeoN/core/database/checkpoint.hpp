@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <future>
+#include <memory>
+
+#include "NeoN/core/database/database.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace detail
+{
+
+/* @brief frees the page-locked host memory of a checkpoint */
+struct PinnedHostDeleter
+{
+    void operator()(char* ptr) const;
+};
+
+}
+
+/* @class Checkpoint
+ * @brief Writes the state of a database to a binary file and restores it, e.g. to restart a
+ * simulation.
+ *
+ * A checkpoint contains all fields registered in the VectorCollections of the database, i.e.
+ * the internal values and the boundary data of volume and surface fields of scalar and Vec3,
+ * their old time levels and the time, iteration and sub cycle index of every field document.
+ *
+ * Writing is asynchronous: write() enqueues the copies of all fields into a page-locked host
+ * buffer and returns, while a background thread waits for the copies and streams the snapshot
+ * to disk. The buffer is reused by later writes. The file is written under a temporary name and
+ * renamed once complete, thus an interrupted write never replaces a valid checkpoint.
+ *
+ * Restarting requires the fields to be registered with the same names as at the time of the
+ * checkpoint, since the mesh and the boundary conditions are not part of the checkpoint. Missing
+ * old time levels are registered during the restart.
+ */
+class Checkpoint
+{
+public:
+
+    Checkpoint() = default;
+
+    Checkpoint(const Checkpoint&) = delete;
+
+    Checkpoint& operator=(const Checkpoint&) = delete;
+
+    /* @brief waits for a pending write, errors of the write are discarded */
+    ~Checkpoint();
+
+    /* @brief Snapshots the database and writes it to the file on a background thread.
+     *
+     * A pending write is completed before the snapshot is taken. The fields can be modified as
+     * soon as the function returns, since the copies are enqueued on the default execution space
+     * instances, which order later kernels after them.
+     */
+    void write(const Database& db, const std::filesystem::path& file);
+
+    /* @brief blocks until the pending write is completed and rethrows its errors */
+    void wait();
+
+    /* @brief whether a write has been started and not yet waited for */
+    bool pending() const { return pendingWrite_.valid(); }
+
+    /* @brief Restores the fields of the database from a checkpoint file.
+     *
+     * The fields are looked up by the names of their collection and field, the values are
+     * copied into the executor memory of the registered fields.
+     */
+    static void read(Database& db, const std::filesystem::path& file);
+
+private:
+
+    std::future<void> pendingWrite_;
+
+    /* the page-locked host buffer of the snapshot */
+    std::unique_ptr<char, detail::PinnedHostDeleter> staging_;
+
+    std::size_t stagingSize_ = 0;
+};
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <limits>
 #include <optional>
 #include <string>
 #include <stdexcept>
+#include <vector>
 
 #include "NeoN/core/database/database.hpp"
 
@@ -20,6 +22,7 @@ namespace NeoN::finiteVolume::cellCentred
  *   - optional Database* storage
  *   - key, fieldCollectionName
  *   - hasDatabase(), db(), registered()
+ *   - a cache of the old time field and of all old time levels, see oldTime and oldTimeLevels
  */
 class FieldDatabaseMixin
 {
@@ -31,6 +34,23 @@ public:
         : db_(&db), key(std::move(key)), fieldCollectionName(std::move(collectionName))
     {}
 
+    // copies refer to the same database entry but do not share the cached old time fields,
+    // since a copy might be registered as a different field, e.g. as an old time field
+    FieldDatabaseMixin(const FieldDatabaseMixin& other)
+        : key(other.key), fieldCollectionName(other.fieldCollectionName), db_(other.db_)
+    {}
+
+    FieldDatabaseMixin& operator=(const FieldDatabaseMixin& other)
+    {
+        key = other.key;
+        fieldCollectionName = other.fieldCollectionName;
+        db_ = other.db_;
+        oldTime_ = nullptr;
+        oldTimeLevels_.clear();
+        oldTimeLevelsRegistrations_ = std::numeric_limits<std::size_t>::max();
+        return *this;
+    }
+
     bool hasDatabase() const { return db_.has_value(); }
 
     Database& db()
@@ -61,6 +81,26 @@ public:
         return !key.empty() && !fieldCollectionName.empty() && db_.has_value();
     }
 
+    /* @brief the old time field found by a previous lookup or a nullptr */
+    FieldDatabaseMixin* cachedOldTime() const { return oldTime_; }
+
+    void cacheOldTime(FieldDatabaseMixin* oldTime) const { oldTime_ = oldTime; }
+
+    /* @brief the old time levels found by a previous lookup or a nullptr, if old time fields have
+     * been registered since, i.e. if nRegistrations differs from the one of the lookup
+     */
+    const std::vector<FieldDatabaseMixin*>* cachedOldTimeLevels(std::size_t nRegistrations) const
+    {
+        return nRegistrations == oldTimeLevelsRegistrations_ ? &oldTimeLevels_ : nullptr;
+    }
+
+    void cacheOldTimeLevels(std::vector<FieldDatabaseMixin*> levels, std::size_t nRegistrations)
+        const
+    {
+        oldTimeLevels_ = std::move(levels);
+        oldTimeLevelsRegistrations_ = nRegistrations;
+    }
+
     // Keep names to match your existing API
     std::string key;                 // key in DB
     std::string fieldCollectionName; // collection name in DB
@@ -68,6 +108,14 @@ public:
 protected:
 
     std::optional<Database*> db_;
+
+private:
+
+    mutable FieldDatabaseMixin* oldTime_ = nullptr;
+
+    mutable std::vector<FieldDatabaseMixin*> oldTimeLevels_;
+
+    mutable std::size_t oldTimeLevelsRegistrations_ = std::numeric_limits<std::size_t>::max();
 };
 
 } // namespace NeoN::finiteVolume::cellCentred
@@ -5,11 +5,13 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "NeoN/core/database/database.hpp"
 #include "NeoN/core/database/collection.hpp"
 #include "NeoN/core/database/document.hpp"
 #include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/fieldDatabase.hpp"
 
 
 namespace NeoN::finiteVolume::cellCentred
@@ -73,6 +75,11 @@ public:
 
     const OldTimeDocument& oldTimeDoc(const std::string& id) const;
 
+    /* @brief the number of old time fields registered in any collection, which changes whenever
+     * a cached chain of old time levels might be outdated, see oldTimeLevels
+     */
+    static std::size_t nRegistrations();
+
     template<typename VectorType>
     VectorType& getOrInsert(std::string idOfNextVector)
     {
@@ -140,7 +147,9 @@ private:
 /**
  * @brief Retrieves the old time field of a given field.
  *
- * This function retrieves the old time field of a given field
+ * This function retrieves the old time field of a given field, the old time field is registered
+ * on the first call. The result is cached in the field, thus only the first call searches the
+ * database.
  *
  * @param field The field to retrieve the old time field from.
  * @return The old time field.
@@ -148,9 +157,12 @@ private:
 template<typename VectorType>
 VectorType& oldTime(VectorType& field)
 {
+    if (auto* cached = field.cachedOldTime()) return static_cast<VectorType&>(*cached);
     VectorCollection& fieldCollection = VectorCollection::instance(field);
     OldTimeCollection& oldTimeCollection = OldTimeCollection::instance(fieldCollection);
-    return oldTimeCollection.getOrInsert<VectorType>(field.key);
+    VectorType& oldField = oldTimeCollection.getOrInsert<VectorType>(field.key);
+    field.cacheOldTime(&oldField);
+    return oldField;
 }
 
 /**
@@ -164,9 +176,80 @@ VectorType& oldTime(VectorType& field)
 template<typename VectorType>
 const VectorType& oldTime(const VectorType& field)
 {
+    if (auto* cached = field.cachedOldTime()) return static_cast<const VectorType&>(*cached);
     const VectorCollection& fieldCollection = VectorCollection::instance(field);
     const OldTimeCollection& oldTimeCollection = OldTimeCollection::instance(fieldCollection);
-    return oldTimeCollection.get<VectorType>(field.key);
+    const VectorType& oldField = oldTimeCollection.get<VectorType>(field.key);
+    // the old time field is a non-const document of the collection, only the lookup is const
+    field.cacheOldTime(const_cast<VectorType*>(&oldField));
+    return oldField;
+}
+
+/**
+ * @brief Checks whether an old time field of a given field has been registered.
+ */
+template<typename VectorType>
+bool hasOldTime(const VectorType& field)
+{
+    if (field.cachedOldTime()) return true;
+    const VectorCollection& fieldCollection = VectorCollection::instance(field);
+    const std::string name = fieldCollection.name() + "_oldTime";
+    if (!field.db().contains(name)) return false;
+    return OldTimeCollection::instance(fieldCollection).findNextTime(field.key) != "";
+}
+
+/**
+ * @brief Retrieves the old time levels of a given field, ordered from the first old time field to
+ * the oldest one.
+ *
+ * The first old time field is registered if required. The levels are cached in the field, thus
+ * the database is only searched again after an old time field has been registered.
+ *
+ * @param field The field to retrieve the old time levels from.
+ * @return The old time levels, which can be cast to VectorType.
+ */
+template<typename VectorType>
+const std::vector<FieldDatabaseMixin*>& oldTimeLevels(VectorType& field)
+{
+    if (const auto* levels = field.cachedOldTimeLevels(OldTimeCollection::nRegistrations()))
+    {
+        return *levels;
+    }
+    std::vector<FieldDatabaseMixin*> levels {&oldTime(field)};
+    while (hasOldTime(static_cast<VectorType&>(*levels.back())))
+    {
+        levels.push_back(&oldTime(static_cast<VectorType&>(*levels.back())));
+    }
+    field.cacheOldTimeLevels(std::move(levels), OldTimeCollection::nRegistrations());
+    return *field.cachedOldTimeLevels(OldTimeCollection::nRegistrations());
+}
+
+/**
+ * @brief Advances a field and all its old time levels by one time step, i.e. it has to be called
+ * at the start of the time step.
+ *
+ * The current values become the first old time level and every old time level becomes the next
+ * older one. Instead of copying the values, the storage of the field and its old time levels is
+ * rotated as a ring, thus the field holds the values of the previously oldest level afterwards,
+ * which have to be overwritten, e.g. by the time integrator. The boundary data, which only
+ * covers the boundary faces, is copied.
+ *
+ * @param field The field to advance, its first old time field is registered if required.
+ */
+template<typename VectorType>
+void advanceTime(VectorType& field)
+{
+    const auto& oldLevels = oldTimeLevels(field);
+    auto level = [&](std::size_t i) -> VectorType&
+    { return i == 0 ? field : static_cast<VectorType&>(*oldLevels[i - 1]); };
+
+    // swapping from the oldest level upwards moves the storage of the oldest level into the
+    // field, while all other levels move down by one
+    for (std::size_t i = oldLevels.size(); i > 0; i--)
+    {
+        level(i).internalVector().swap(level(i - 1).internalVector());
+        level(i).boundaryData() = level(i - 1).boundaryData();
+    }
 }
 
 } // namespace NeoN
@@ -41,13 +41,18 @@ public:
      * @param environ The MPI environment.
      * @param sendSize The number of nodes, per rank, that this rank sends to.
      * @param receiveSize The number of nodes, per rank, that this rank receives from.
+     * @param exec The executor on which the buffers are packed and unpacked.
+     * @param space The memory handed to the MPI library for a GPU executor.
      */
     FullDuplexCommBuffer(
         MPIEnvironment mpiEnviron,
         std::vector<std::size_t> sendSize,
-        std::vector<std::size_t> receiveSize
+        std::vector<std::size_t> receiveSize,
+        Executor exec = SerialExecutor {},
+        BufferSpace space = BufferSpace::Host
     )
-        : send_(mpiEnviron, sendSize), receive_(mpiEnviron, receiveSize) {};
+        : send_(mpiEnviron, sendSize, exec, space), receive_(mpiEnviron, receiveSize, exec, space)
+    {}
 
     /**
      * @brief Check if the communication buffers are initialized.
@@ -91,6 +96,17 @@ public:
         return send_.get<valueType>(rank);
     }
 
+    /**
+     * @brief Gets a View of data for the send buffer of all ranks.
+     * @tparam valueType The type of the data.
+     * @return A view of data for the send buffer.
+     */
+    template<typename valueType>
+    View<valueType> getSend()
+    {
+        return send_.get<valueType>();
+    }
+
     /**
      * @brief Gets a view of data for the receive buffer for a specific rank.
      * @tparam valueType The type of the data.
@@ -115,6 +131,17 @@ public:
         return receive_.get<valueType>(rank);
     }
 
+    /**
+     * @brief Gets a view of data for the receive buffer of all ranks.
+     * @tparam valueType The type of the data.
+     * @return A view of data for the receive buffer.
+     */
+    template<typename valueType>
+    View<const valueType> getReceive() const
+    {
+        return receive_.get<valueType>();
+    }
+
     /**
      * @brief Start non-blocking communication by sending and receiving data.
      */
@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <typeindex>
 #include <vector>
 
 #include "NeoN/core/error.hpp"
+#include "NeoN/core/executor/executor.hpp"
 #include "NeoN/core/mpi/environment.hpp"
 #include "NeoN/core/mpi/operators.hpp"
 #include "NeoN/core/view.hpp"
@@ -22,20 +24,36 @@ namespace mpi
 {
 
 /**
- * @brief A hash function for a string.
+ * @brief Returns the tag of a communication name from a registry of all names.
  *
- * @param str The string to be hashed.
- * @return int The hash value of the string.
+ * A name is assigned the next free tag when it is first registered, thus distinct names never
+ * share a tag. The tags agree between ranks since the exchanges are collective, i.e. every rank
+ * registers the names in the same order.
+ *
+ * @param commName The name of the communication.
+ * @return int The tag of the communication.
  */
-inline int bufferHash(const std::string& str)
+int commTag(const std::string& commName);
+
+/**
+ * @brief The memory handed to the MPI library for buffers of a GPU executor.
+ */
+enum class BufferSpace
 {
-    // There is also an MPI environment value for that, but somehow it doesn't work using that
-    // Also reserve 10 tags for other uses
-    constexpr int maxTagValue = 32767 - 10;
-    std::size_t tag = std::hash<std::string> {}(str);
-    tag &= 0x7FFFFFFF; // turn 'int' signed bit to 0, MPI does not like negative tags.
-    return (static_cast<int>(tag) % maxTagValue) + 10;
-}
+    Host,  /*< Stage the data through page-locked host memory. */
+    Device /*< Pass device pointers directly, requires a GPU-aware MPI library. */
+};
+
+/**
+ * @brief Frees the memory of a communication buffer.
+ */
+struct CommBufferDeleter
+{
+    Executor exec; /*< The executor the memory was allocated on. */
+    bool pinned;   /*< Whether the memory is page-locked host memory. */
+
+    void operator()(char* ptr) const;
+};
 
 /**
  * @class HalfDuplexCommBuffer
@@ -46,6 +64,16 @@ inline int bufferHash(const std::string& str)
  * capable of handling various data types. The buffer does not shrink once initialized, minimizing
  * memory reallocation and improving memory efficiency. The class operates in a half-duplex mode,
  * meaning it is either sending or receiving data at any given time.
+ *
+ * The buffer is allocated in the memory of the executor, so that it can be packed and unpacked by
+ * a kernel. For a GPU executor the buffer space selects whether the device memory is handed to the
+ * MPI library or whether the data is staged through a page-locked host buffer, in which case the
+ * received data is copied back to the device in waitComplete.
+ *
+ * Only ranks with a non-empty share of the buffer are communicated with. For these neighbours
+ * persistent MPI requests are created on the first exchange and restarted by later exchanges, so
+ * that the per exchange overhead scales with the number of neighbours. The requests are recreated
+ * if the communication name, and thus the tag, or the data layout changes.
  */
 class HalfDuplexCommBuffer
 {
@@ -58,18 +86,33 @@ public:
     HalfDuplexCommBuffer() = default;
 
     /**
-     * @brief Default destructor
+     * @brief Destructor, frees the persistent requests.
      */
-    ~HalfDuplexCommBuffer() = default;
+    ~HalfDuplexCommBuffer();
+
+    HalfDuplexCommBuffer(const HalfDuplexCommBuffer&) = delete;
+
+    HalfDuplexCommBuffer& operator=(const HalfDuplexCommBuffer&) = delete;
+
+    HalfDuplexCommBuffer(HalfDuplexCommBuffer&&) = default;
+
+    HalfDuplexCommBuffer& operator=(HalfDuplexCommBuffer&&) = default;
 
     /**
      * @brief Construct a new Half Duplex Buffer object
      *
      * @param mpiEnviron The MPI environment.
      * @param rankCommSize The number of nodes per rank to be communicated with.
+     * @param exec The executor on which the buffer is packed and unpacked.
+     * @param space The memory handed to the MPI library for a GPU executor.
      */
-    HalfDuplexCommBuffer(MPIEnvironment mpiEnviron, std::vector<size_t> rankCommSize)
-        : mpiEnviron_(mpiEnviron)
+    HalfDuplexCommBuffer(
+        MPIEnvironment mpiEnviron,
+        std::vector<size_t> rankCommSize,
+        Executor exec = SerialExecutor {},
+        BufferSpace space = BufferSpace::Host
+    )
+        : mpiEnviron_(mpiEnviron), exec_(exec), space_(space)
     {
         setCommRankSize<char>(rankCommSize);
     }
@@ -106,7 +149,6 @@ public:
         );
         typeSize_ = sizeof(valueType);
         rankOffset_.resize(rankCommSize.size() + 1);
-        request_.resize(rankCommSize.size(), MPI_REQUEST_NULL);
         updateDataSize([&](const size_t rank) { return rankCommSize[rank]; }, sizeof(valueType));
     }
 
@@ -124,7 +166,7 @@ public:
         );
         setType<valueType>();
         commName_ = commName;
-        tag_ = bufferHash(commName);
+        tag_ = commTag(commName);
     }
 
     /**
@@ -140,6 +182,13 @@ public:
      */
     bool isComplete();
 
+    /**
+     * @brief Get the ranks this rank communicates with, i.e. with a non-empty buffer share.
+     *
+     * @return const std::vector<int>& The neighbour ranks in ascending order.
+     */
+    inline const std::vector<int>& neighbours() const { return neighbours_; }
+
     /**
      * @brief Post send for data to begin sending to all ranks this rank communicates with.
      */
@@ -152,7 +201,7 @@ public:
     void receive();
 
     /**
-     * @brief Blocking wait for the communication to finish.
+     * @brief Blocking wait for the communication to finish, received data is valid afterwards.
      */
     void waitComplete();
 
@@ -174,7 +223,7 @@ public:
         NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
         NF_DEBUG_ASSERT(typeSize_ == sizeof(valueType), "Data type (size) mismatch.");
         return View<valueType>(
-            reinterpret_cast<valueType*>(rankBuffer_.data() + rankOffset_[rank]),
+            reinterpret_cast<valueType*>(rankBuffer_.get() + rankOffset_[rank]),
             (rankOffset_[rank + 1] - rankOffset_[rank]) / sizeof(valueType)
         );
     }
@@ -192,22 +241,94 @@ public:
         NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
         NF_DEBUG_ASSERT(typeSize_ == sizeof(valueType), "Data type (size) mismatch.");
         return View<const valueType>(
-            reinterpret_cast<const valueType*>(rankBuffer_.data() + rankOffset_[rank]),
+            reinterpret_cast<const valueType*>(rankBuffer_.get() + rankOffset_[rank]),
             (rankOffset_[rank + 1] - rankOffset_[rank]) / sizeof(valueType)
         );
     }
 
+    /**
+     * @brief Get a View of the buffer data of all ranks, stored contiguously in rank order.
+     *
+     * @tparam valueType The type of the data to be stored in the buffer.
+     * @return View<valueType> A View of the data for all ranks.
+     */
+    template<typename valueType>
+    View<valueType> get()
+    {
+        NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
+        NF_DEBUG_ASSERT(typeSize_ == sizeof(valueType), "Data type (size) mismatch.");
+        return View<valueType>(
+            reinterpret_cast<valueType*>(rankBuffer_.get()), rankOffset_.back() / sizeof(valueType)
+        );
+    }
+
+    /**
+     * @brief Get a View of the buffer data of all ranks, stored contiguously in rank order.
+     *
+     * @tparam valueType The type of the data to be stored in the buffer.
+     * @return View<const valueType> A View of the data for all ranks.
+     */
+    template<typename valueType>
+    View<const valueType> get() const
+    {
+        NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
+        NF_DEBUG_ASSERT(typeSize_ == sizeof(valueType), "Data type (size) mismatch.");
+        return View<const valueType>(
+            reinterpret_cast<const valueType*>(rankBuffer_.get()),
+            rankOffset_.back() / sizeof(valueType)
+        );
+    }
+
 private:
 
-    int tag_ {-1};                        /*< The tag for the communication. */
-    std::string commName_ {"unassigned"}; /*< The name of the communication. */
-    std::size_t typeSize_ {sizeof(char)}; /*< The data type currently stored in the buffer. */
-    MPIEnvironment mpiEnviron_;           /*< The MPI environment. */
-    std::vector<MPI_Request> request_;    /*< The MPI request for communication with each rank. */
-    std::vector<char> rankBuffer_;        /*< The buffer data for all ranks. Never shrinks. */
+    int tag_ {-1};                          /*< The tag for the communication. */
+    std::string commName_ {"unassigned"};   /*< The name of the communication. */
+    std::size_t typeSize_ {sizeof(char)};   /*< The data type currently stored in the buffer. */
+    MPIEnvironment mpiEnviron_;             /*< The MPI environment. */
+    Executor exec_ {SerialExecutor {}};     /*< The executor holding the buffer data. */
+    BufferSpace space_ {BufferSpace::Host}; /*< The memory handed to MPI for a GPU executor. */
+    std::vector<int> neighbours_;           /*< The ranks with a non-empty buffer share. */
+    std::vector<MPI_Request> request_;      /*< The persistent request for each neighbour. */
+    int requestTag_ {-1};                   /*< The tag the requests were created for. */
+    bool requestSend_ {false};              /*< Whether the requests are send requests. */
+    std::unique_ptr<char, CommBufferDeleter>
+        rankBuffer_; /*< The buffer data for all ranks on the executor. Never shrinks. */
+    std::unique_ptr<char, CommBufferDeleter>
+        stageBuffer_;          /*< The page-locked host copy, if the data is staged. */
+    std::size_t capacity_ {0}; /*< The allocated size (in bytes) of the buffers. */
+    bool receiving_ {false};   /*< Whether a staged receive has to be copied to the device. */
     std::vector<std::size_t>
         rankOffset_; /*< The offset (in bytes) for a rank data in the buffer. */
 
+    /**
+     * @brief Whether the data is staged through host memory for the MPI library.
+     */
+    bool isStaged() const;
+
+    /**
+     * @brief The memory handed to the MPI library.
+     */
+    char* commData();
+
+    /**
+     * @brief Grow the buffers to hold at least the given number of bytes.
+     *
+     * @param dataSize The required size in bytes.
+     */
+    void reserve(std::size_t dataSize);
+
+    /**
+     * @brief Start the persistent requests, recreating them if they do not match the tag.
+     *
+     * @param send Whether to send or to receive.
+     */
+    void startRequests(bool send);
+
+    /**
+     * @brief Free the persistent requests, e.g. after the buffer layout changed.
+     */
+    void freeRequests();
+
     /**
      * @brief Set the data type for the buffer.
      */
@@ -244,7 +365,17 @@ private:
             dataSize += rankSize(rank) * newSize;
         }
         rankOffset_.back() = dataSize;
-        if (rankBuffer_.size() < dataSize) rankBuffer_.resize(dataSize); // we never size down.
+        if (capacity_ < dataSize) reserve(dataSize); // we never size down.
+
+        neighbours_.clear();
+        for (size_t rank = 0; rank < mpiEnviron_.sizeRank(); ++rank)
+        {
+            if (rankOffset_[rank + 1] != rankOffset_[rank])
+            {
+                neighbours_.push_back(static_cast<int>(rank));
+            }
+        }
+        freeRequests();
     }
 };
 
@@ -9,6 +9,7 @@
 #include <mpi.h>
 #endif
 #include <type_traits>
+#include <vector>
 
 #include "NeoN/core/error.hpp"
 #include "NeoN/core/primitives/vec3.hpp"
@@ -160,6 +161,46 @@ inline void allReduce(Vec3& vector, const ReduceOp op, MPI_Comm comm)
     );
 }
 
+/**
+ * @brief Gathers a value from all processes in the communicator on all processes.
+ *
+ * @tparam valueType The type of the value.
+ * @param value The value of this process.
+ * @param comm The communicator across which the values are gathered.
+ * @return The values of all processes, ordered by rank.
+ * @note Blocking MPI operation.
+ */
+template<typename valueType>
+std::vector<valueType> allGather(const valueType& value, MPI_Comm comm)
+{
+    int size;
+    MPI_Comm_size(comm, &size);
+    std::vector<valueType> result(static_cast<size_t>(size));
+    mpi_label_t err = MPI_Allgather(
+        &value, 1, getType<valueType>(), result.data(), 1, getType<valueType>(), comm
+    );
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Allgather failed.");
+    return result;
+}
+
+/**
+ * @brief Broadcasts a set of scalar values from the root rank to all processes in the
+ * communicator.
+ *
+ * @tparam valueType The type of the scalar value.
+ * @param buffer Pointer to the first scalar value, sent by the root and received by all others.
+ * @param size The size of the buffer, i.e. number of components/elements.
+ * @param root The rank index of the sender.
+ * @param comm The communicator across which the values are broadcast.
+ * @note Blocking MPI operation.
+ */
+template<typename valueType>
+void broadcast(valueType* buffer, const mpi_label_t size, mpi_label_t root, MPI_Comm comm)
+{
+    mpi_label_t err = MPI_Bcast(buffer, size, getType<valueType>(), root, comm);
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Bcast failed.");
+}
+
 /**
  * @brief Non-blocking send of a set of scalar values to a remote rank.
  *
@@ -213,6 +254,61 @@ void irecv(
     NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Irecv failed.");
 }
 
+/**
+ * @brief Creates a persistent send request of a set of scalar values to a remote rank.
+ *
+ * @tparam valueType The type of the scalar value.
+ * @param buffer Pointer to first scalar value to be sent, has to remain valid.
+ * @param size The size of the send buffer, i.e. number of components/elements.
+ * @param rankReceive The receiving rank index.
+ * @param tag The tag of the message, used to identify the communication.
+ * @param comm The MPI communicator across which the message is sent.
+ * @param request Pointer to the MPI_Request object, is populated by the function.
+ * @note The request is inactive until started and has to be freed with MPI_Request_free.
+ */
+template<typename valueType>
+void sendInit(
+    const valueType* buffer,
+    const mpi_label_t size,
+    mpi_label_t rankReceive,
+    mpi_label_t tag,
+    MPI_Comm comm,
+    MPI_Request* request
+)
+{
+    mpi_label_t err =
+        MPI_Send_init(buffer, size, getType<valueType>(), rankReceive, tag, comm, request);
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Send_init failed.");
+}
+
+/**
+ * @brief Creates a persistent receive request of a set of scalar values from a remote rank.
+ *
+ * @tparam valueType The type of the scalar value.
+ * @param buffer Pointer to the buffer where the received values will be stored, has to remain
+ * valid.
+ * @param size The size of the receive buffer, i.e. number of components/elements.
+ * @param rankSend The rank index of the sender.
+ * @param tag The tag of the message, used to identify the communication.
+ * @param comm The MPI communicator across which the message is received.
+ * @param request Pointer to the MPI_Request object, is populated by the function.
+ * @note The request is inactive until started and has to be freed with MPI_Request_free.
+ */
+template<typename valueType>
+void recvInit(
+    valueType* buffer,
+    const mpi_label_t size,
+    mpi_label_t rankSend,
+    mpi_label_t tag,
+    MPI_Comm comm,
+    MPI_Request* request
+)
+{
+    mpi_label_t err =
+        MPI_Recv_init(buffer, size, getType<valueType>(), rankSend, tag, comm, request);
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Recv_init failed.");
+}
+
 /**
  * @brief Tests if a non-blocking communication request has completed.
  *
@@ -147,6 +147,12 @@ public:
      */
     void operator=(const Vector<ValueType>& rhs);
 
+    /**
+     * @brief Exchanges the data with another field without copying.
+     * @param rhs The field to exchange the data with, has to be on the same executor.
+     */
+    void swap(Vector<ValueType>& rhs);
+
     /**
      * @brief Arithmetic add operator, addition of a second field.
      * @param rhs The field to add with this field.
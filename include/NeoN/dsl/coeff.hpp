@@ -10,6 +10,44 @@
 namespace NeoN::dsl
 {
 
+namespace detail
+{
+
+/* @brief The compile time variants of a Coeff, see Coeff::visit */
+struct UnitCoeff
+{
+    KOKKOS_INLINE_FUNCTION
+    scalar operator[](const localIdx) const { return 1.0; }
+};
+
+struct UniformCoeff
+{
+    scalar value;
+
+    KOKKOS_INLINE_FUNCTION
+    scalar operator[](const localIdx) const { return value; }
+};
+
+struct FieldCoeff
+{
+    View<const scalar> values;
+
+    KOKKOS_INLINE_FUNCTION
+    scalar operator[](const localIdx i) const { return values[i]; }
+};
+
+struct ScaledFieldCoeff
+{
+    scalar value;
+
+    View<const scalar> values;
+
+    KOKKOS_INLINE_FUNCTION
+    scalar operator[](const localIdx i) const { return values[i] * value; }
+};
+
+} // namespace detail
+
 /**
  * @class Coeff
  * @brief A class that represents a coefficient for the NeoN dsl.
@@ -36,7 +74,28 @@ public:
     KOKKOS_INLINE_FUNCTION
     scalar operator[](const localIdx i) const { return (hasView_) ? view_[i] * coeff_ : coeff_; }
 
-    bool hasView();
+    /* @brief Calls func with the compile time variant of this coefficient, i.e. one of
+     * detail::UnitCoeff, UniformCoeff, FieldCoeff or ScaledFieldCoeff. Kernels instantiated for
+     * the variant evaluate the coefficient without the branch of operator[].
+     */
+    template<typename Func>
+    void visit(Func&& func) const
+    {
+        if (hasView_)
+        {
+            if (coeff_ == 1.0) func(detail::FieldCoeff {view_});
+            else
+                func(detail::ScaledFieldCoeff {coeff_, view_});
+        }
+        else
+        {
+            if (coeff_ == 1.0) func(detail::UnitCoeff {});
+            else
+                func(detail::UniformCoeff {coeff_});
+        }
+    }
+
+    bool hasView() const;
 
     View<const scalar> view();
 
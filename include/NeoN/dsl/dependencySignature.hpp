@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/dsl/coeff.hpp"
+
+namespace NeoN::dsl
+{
+
+/* @class DependencySignature
+ * @brief Identifies the state of all inputs the implicit contribution of an operator depends on,
+ * e.g. the versions of the fields, the operator scaling and the time step size.
+ *
+ * Two equal signatures of the same operator imply an identical contribution to the linear
+ * system, which allows the Expression to reuse a previously assembled contribution.
+ */
+class DependencySignature
+{
+public:
+
+    DependencySignature() = default;
+
+    /* @brief adds the identity of an object and the version of its state */
+    DependencySignature& add(const void* object, std::size_t version)
+    {
+        keys_.push_back(reinterpret_cast<std::uintptr_t>(object));
+        keys_.push_back(version);
+        return *this;
+    }
+
+    DependencySignature& add(scalar value)
+    {
+        keys_.push_back(std::bit_cast<std::uint64_t>(value));
+        return *this;
+    }
+
+    /* @brief adds the operator scaling, only uniform coefficients are supported since the values
+     * of a coefficient view can change unnoticed
+     * @return false if the coefficient can not be part of a signature
+     */
+    bool add(const Coeff& coeff)
+    {
+        if (coeff.hasView()) return false;
+        add(coeff[0]);
+        return true;
+    }
+
+    bool operator==(const DependencySignature& rhs) const = default;
+
+private:
+
+    std::vector<std::uint64_t> keys_;
+};
+
+} // namespace NeoN::dsl
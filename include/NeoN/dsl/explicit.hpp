@@ -32,6 +32,14 @@ TemporalOperator<ValueType> ddt(fvcc::VolumeField<ValueType>& phi)
     return fvcc::DdtOperator(dsl::Operator::Type::Explicit, phi);
 }
 
+/* @brief ddt with a local time step size per cell, see fvcc::LocalTimeStep */
+template<typename ValueType>
+TemporalOperator<ValueType>
+ddt(fvcc::VolumeField<ValueType>& phi, const Vector<scalar>& rDeltaT)
+{
+    return fvcc::DdtOperator(dsl::Operator::Type::Explicit, phi, rDeltaT);
+}
+
 SpatialOperator<scalar>
 div(const fvcc::SurfaceField<scalar>& faceFlux, fvcc::VolumeField<scalar>& phi);
 
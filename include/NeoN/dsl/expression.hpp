@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <optional>
 #include <vector>
 
 #include "NeoN/core/error.hpp"
 #include "NeoN/core/primitives/scalar.hpp"
 #include "NeoN/fields/field.hpp"
 #include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/dsl/dependencySignature.hpp"
 #include "NeoN/dsl/spatialOperator.hpp"
 #include "NeoN/dsl/temporalOperator.hpp"
 
@@ -36,9 +39,23 @@ public:
 
     Expression(const Expression& exp)
         : exec_(exp.exec_), temporalOperators_(exp.temporalOperators_),
-          spatialOperators_(exp.spatialOperators_)
+          spatialOperators_(exp.spatialOperators_), cacheAssembly_(exp.cacheAssembly_)
     {}
 
+    /* @brief Enables the reuse of implicit operator contributions during the assembly.
+     *
+     * Operators which declare a dependency signature, e.g. a laplacian with a constant
+     * diffusivity, and whose signature did not change since the previous assembly are summed
+     * into a cached baseline system, which is added to the linear system instead of assembling
+     * these operators again. All other operators are assembled as usual. Fields have to be
+     * modified through their non-const accessors or marked as modified, see DomainMixin::version.
+     */
+    void cacheAssembly(bool enabled = true)
+    {
+        cacheAssembly_ = enabled;
+        cache_.reset();
+    }
+
     /* @brief dispatch read call to operator */
     void read(const Dictionary& input)
     {
@@ -56,11 +73,12 @@ public:
     Vector<ValueType> explicitOperation(localIdx nCells) const
     {
         Vector<ValueType> source(exec_, nCells, zero<ValueType>());
-        return explicitOperation(source);
+        explicitOperation(source);
+        return source;
     }
 
-    /* @brief perform all explicit operation and accumulate the result */
-    Vector<ValueType> explicitOperation(Vector<ValueType>& source) const
+    /* @brief perform all explicit operation and accumulate the result in place */
+    Vector<ValueType>& explicitOperation(Vector<ValueType>& source) const
     {
         for (auto& op : spatialOperators_)
         {
@@ -72,7 +90,7 @@ public:
         return source;
     }
 
-    Vector<ValueType> explicitOperation(Vector<ValueType>& source, scalar t, scalar dt) const
+    Vector<ValueType>& explicitOperation(Vector<ValueType>& source, scalar t, scalar dt) const
     {
         for (auto& op : temporalOperators_)
         {
@@ -87,12 +105,33 @@ public:
     /*@brief compute matrix coefficients based on all spatial operators */
     void assembleSpatialOperator(la::LinearSystem<ValueType, localIdx>& ls) const
     {
-        for (auto& op : spatialOperators_)
+        assembleSpatialOperator(ls, [](std::size_t) { return true; });
+    }
+
+    /*@brief compute matrix coefficients based on the selected spatial operators
+     * @param select predicate on the index of an operator
+     */
+    template<typename Select>
+    void assembleSpatialOperator(la::LinearSystem<ValueType, localIdx>& ls, Select select) const
+    {
+        // implicit Gauss-Green operators are assembled by fused kernels per field, all other
+        // operators by their own implicit operation
+        std::vector<finiteVolume::cellCentred::GaussGreenTerm<ValueType>> terms;
+        for (std::size_t i = 0; i < spatialOperators_.size(); i++)
         {
-            if (op.getType() == Operator::Type::Implicit)
+            const auto& op = spatialOperators_[i];
+            if (op.getType() != Operator::Type::Implicit || !select(i)) continue;
+            auto term = op.gaussGreenTerm();
+            if (term)
             {
-                op.implicitOperation(ls);
+                terms.push_back(std::move(*term));
+                continue;
             }
+            op.implicitOperation(ls);
+        }
+        if (!terms.empty())
+        {
+            finiteVolume::cellCentred::assembleGaussGreenTerms<ValueType>(ls, terms);
         }
     }
 
@@ -102,9 +141,18 @@ public:
     void
     assembleTemporalOperator(la::LinearSystem<ValueType, localIdx>& ls, scalar t, scalar dt) const
     {
-        for (auto& op : temporalOperators_)
+        assembleTemporalOperator(ls, t, dt, [](std::size_t) { return true; });
+    }
+
+    template<typename Select>
+    void assembleTemporalOperator(
+        la::LinearSystem<ValueType, localIdx>& ls, scalar t, scalar dt, Select select
+    ) const
+    {
+        for (std::size_t i = 0; i < temporalOperators_.size(); i++)
         {
-            if (op.getType() == Operator::Type::Implicit)
+            const auto& op = temporalOperators_[i];
+            if (op.getType() == Operator::Type::Implicit && select(i))
             {
                 op.implicitOperation(ls, t, dt);
             }
@@ -141,8 +189,15 @@ public:
         std::span<const PostAssemblyBase<ValueType>> ps = {}
     ) const
     {
-        assembleSpatialOperator(ls);         // add spatial operator
-        assembleTemporalOperator(ls, t, dt); // add temporal operators
+        if (cacheAssembly_)
+        {
+            assembleCached(ls, t, dt);
+        }
+        else
+        {
+            assembleSpatialOperator(ls);         // add spatial operator
+            assembleTemporalOperator(ls, t, dt); // add temporal operators
+        }
 
         // perform post assembly transformations
         for (auto p : ps)
@@ -196,11 +251,114 @@ public:
 
 private:
 
+    /* @brief The signatures of the implicit operators at the previous assembly and the summed
+     * contributions of the operators in the baseline, spatial operators are followed by the
+     * temporal operators.
+     */
+    struct AssemblyCache
+    {
+        std::vector<std::optional<DependencySignature>> signatures;
+
+        std::vector<bool> inBaseline;
+
+        std::optional<la::LinearSystem<ValueType, localIdx>> baseline;
+    };
+
+    /* @brief assembles all operators, which changed since the previous assembly, and adds the
+     * cached baseline of the unchanged operators, the baseline is rebuilt if the set of unchanged
+     * operators differs from the cached one
+     */
+    void assembleCached(la::LinearSystem<ValueType, localIdx>& ls, scalar t, scalar dt) const
+    {
+        const auto nSpatial = spatialOperators_.size();
+        std::vector<std::optional<DependencySignature>> signatures;
+        for (const auto& op : spatialOperators_)
+        {
+            signatures.push_back(
+                op.getType() == Operator::Type::Implicit ? op.dependencySignature() : std::nullopt
+            );
+        }
+        for (const auto& op : temporalOperators_)
+        {
+            signatures.push_back(
+                op.getType() == Operator::Type::Implicit ? op.dependencySignature(t, dt)
+                                                         : std::nullopt
+            );
+        }
+
+        std::vector<bool> unchanged(signatures.size(), false);
+        if (cache_ && cache_->signatures.size() == signatures.size())
+        {
+            for (std::size_t i = 0; i < signatures.size(); i++)
+            {
+                unchanged[i] = signatures[i] && signatures[i] == cache_->signatures[i];
+            }
+        }
+        auto inBaseline = [&](std::size_t i) { return bool(unchanged[i]); };
+        auto notInBaseline = [&](std::size_t i) { return !unchanged[i]; };
+
+        if (!cache_ || cache_->inBaseline != unchanged)
+        {
+            std::optional<la::LinearSystem<ValueType, localIdx>> baseline;
+            if (std::find(unchanged.begin(), unchanged.end(), true) != unchanged.end())
+            {
+                baseline.emplace(ls);
+                baseline->reset();
+                assembleSpatialOperator(*baseline, inBaseline);
+                assembleTemporalOperator(
+                    *baseline, t, dt, [&](std::size_t i) { return inBaseline(nSpatial + i); }
+                );
+            }
+            cache_ = AssemblyCache {signatures, unchanged, std::move(baseline)};
+        }
+        else
+        {
+            cache_->signatures = signatures;
+        }
+
+        if (cache_->baseline)
+        {
+            addLinearSystem(*cache_->baseline, ls);
+        }
+        assembleSpatialOperator(ls, notInBaseline);
+        assembleTemporalOperator(
+            ls, t, dt, [&](std::size_t i) { return notInBaseline(nSpatial + i); }
+        );
+    }
+
+    static void addLinearSystem(
+        const la::LinearSystem<ValueType, localIdx>& src, la::LinearSystem<ValueType, localIdx>& dst
+    )
+    {
+        dst.matrix().values() += src.matrix().values();
+        dst.rhs() += src.rhs();
+        if (src.auxiliaryCoefficients().contains("boundaryCoefficients"))
+        {
+            const auto& srcCoeffs = boundaryCoefficients(src);
+            auto& dstCoeffs = boundaryCoefficients(dst);
+            dstCoeffs.matrixValues += srcCoeffs.matrixValues;
+            dstCoeffs.rhsValues += srcCoeffs.rhsValues;
+        }
+    }
+
+    template<typename LinearSystemType>
+    static auto& boundaryCoefficients(LinearSystemType& ls)
+    {
+        using BoundaryCoefficients = la::BoundaryCoefficients<ValueType, localIdx>;
+        return ls.auxiliaryCoefficients().template get<BoundaryCoefficients>(
+            "boundaryCoefficients"
+        );
+    }
+
     const Executor exec_;
 
     std::vector<TemporalOperator<ValueType>> temporalOperators_;
 
     std::vector<SpatialOperator<ValueType>> spatialOperators_;
+
+    bool cacheAssembly_ = false;
+
+    mutable std::optional<AssemblyCache> cache_;
 };
 
 template<typename ValueType>
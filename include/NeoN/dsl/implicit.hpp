@@ -28,6 +28,14 @@ TemporalOperator<ValueType> ddt(fvcc::VolumeField<ValueType>& phi)
     return fvcc::DdtOperator(dsl::Operator::Type::Implicit, phi);
 }
 
+/* @brief ddt with a local time step size per cell, see fvcc::LocalTimeStep */
+template<typename ValueType>
+TemporalOperator<ValueType>
+ddt(fvcc::VolumeField<ValueType>& phi, const Vector<scalar>& rDeltaT)
+{
+    return fvcc::DdtOperator(dsl::Operator::Type::Implicit, phi, rDeltaT);
+}
+
 template<typename ValueType>
 SpatialOperator<ValueType>
 source(fvcc::VolumeField<scalar>& coeff, fvcc::VolumeField<ValueType>& phi)
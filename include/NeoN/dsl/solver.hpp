@@ -15,6 +15,7 @@
 #include "NeoN/core/input.hpp"
 #include "NeoN/core/primitives/label.hpp"
 #include "NeoN/dsl/expression.hpp"
+#include "NeoN/dsl/staticExpression.hpp"
 #include "NeoN/timeIntegration/timeIntegration.hpp"
 
 #include "NeoN/linearAlgebra/linearSystem.hpp"
@@ -59,9 +60,9 @@ la::SolverStats iterativeSolveImpl(
     return solver.solve(ls, solution.internalVector());
 }
 
-template<typename VectorType>
+template<typename ExpressionType, typename VectorType>
 la::SolverStats iterativeSolveImpl(
-    Expression<typename VectorType::ElementType>& exp,
+    ExpressionType& exp,
     VectorType& solution,
     scalar t,
     scalar dt,
@@ -129,4 +130,37 @@ la::SolverStats solve(
     }
 }
 
+/* @brief solve a static expression, see solve above
+ *
+ * Implicit time integration and steady problems are assembled directly from the static
+ * expression, explicit time integrators operate on its conversion to an Expression.
+ */
+template<typename VectorType, typename... Operators>
+la::SolverStats solve(
+    StaticExpression<Operators...>& exp,
+    VectorType& solution,
+    scalar t,
+    scalar dt,
+    const Dictionary& fvSchemes,
+    const Dictionary& fvSolution,
+    std::vector<PostAssemblyBase<typename VectorType::ElementType>> p = {}
+)
+{
+    exp.read(fvSchemes);
+    auto integrator =
+        timeIntegration::TimeIntegration<VectorType>(fvSchemes.subDict("ddtSchemes"), fvSolution);
+
+    constexpr bool hasTemporalOperators = (HasTemporalOperator<Operators> || ...);
+    if (hasTemporalOperators && integrator.explicitIntegration())
+    {
+        auto expr = exp.toExpression();
+        integrator.solve(expr, solution, t, dt);
+        return {.numIter = -1, .initResNorm = 0, .finalResNorm = 0, .solveTime = 0};
+    }
+    else
+    {
+        return detail::iterativeSolveImpl(exp, solution, t, dt, fvSolution, p);
+    }
+}
+
 } // namespace dsl
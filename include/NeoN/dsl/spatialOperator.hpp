@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <concepts>
+#include <optional>
 
 #include "NeoN/core/primitives/scalar.hpp"
 #include "NeoN/core/primitives/vec3.hpp"
@@ -13,7 +14,9 @@
 #include "NeoN/linearAlgebra/linearSystem.hpp"
 #include "NeoN/core/input.hpp"
 #include "NeoN/dsl/coeff.hpp"
+#include "NeoN/dsl/dependencySignature.hpp"
 #include "NeoN/dsl/operator.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedAssembly.hpp"
 
 namespace la = NeoN::la;
 
@@ -35,6 +38,21 @@ concept HasImplicitOperator = requires(T const t) {
     } -> std::same_as<void>; // Adjust return type and arguments as needed
 };
 
+template<typename T>
+concept HasGaussGreenTerm = requires(T const t) {
+    {
+        t.gaussGreenTerm()
+    } -> std::same_as<
+        std::optional<finiteVolume::cellCentred::GaussGreenTerm<typename T::VectorValueType>>>;
+};
+
+template<typename T>
+concept HasDependencySignature = requires(T const t) {
+    {
+        t.dependencySignature()
+    } -> std::same_as<std::optional<DependencySignature>>;
+};
+
 template<typename T>
 concept IsSpatialOperator = HasExplicitOperator<T> || HasImplicitOperator<T>;
 
@@ -78,6 +96,19 @@ public:
         model_->implicitOperation(ls);
     }
 
+    /* @brief the face data of an implicit Gauss-Green operator used by the fused assembly */
+    std::optional<finiteVolume::cellCentred::GaussGreenTerm<ValueType>> gaussGreenTerm() const
+    {
+        return model_->gaussGreenTerm();
+    }
+
+    /* @brief the state of the inputs of the implicit contribution, empty if the contribution
+     * has to be assembled every time */
+    std::optional<DependencySignature> dependencySignature() const
+    {
+        return model_->dependencySignature();
+    }
+
     /* returns the fundamental type of an operator, ie explicit, implicit */
     Operator::Type getType() const { return model_->getType(); }
 
@@ -107,6 +138,11 @@ private:
 
         virtual void implicitOperation(la::LinearSystem<ValueType, localIdx>& ls) const = 0;
 
+        virtual std::optional<finiteVolume::cellCentred::GaussGreenTerm<ValueType>>
+        gaussGreenTerm() const = 0;
+
+        virtual std::optional<DependencySignature> dependencySignature() const = 0;
+
         /* @brief Given an input this function reads required coeffs */
         virtual void read(const Input& input) = 0;
 
@@ -155,6 +191,25 @@ private:
             }
         }
 
+        virtual std::optional<finiteVolume::cellCentred::GaussGreenTerm<ValueType>>
+        gaussGreenTerm() const override
+        {
+            if constexpr (HasGaussGreenTerm<ConcreteOperatorType>)
+            {
+                return concreteOp_.gaussGreenTerm();
+            }
+            return std::nullopt;
+        }
+
+        virtual std::optional<DependencySignature> dependencySignature() const override
+        {
+            if constexpr (HasDependencySignature<ConcreteOperatorType>)
+            {
+                return concreteOp_.dependencySignature();
+            }
+            return std::nullopt;
+        }
+
         /* @brief Given an input this function reads required coeffs */
         virtual void read(const Input& input) override { concreteOp_.read(input); }
 
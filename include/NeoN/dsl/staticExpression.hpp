@@ -0,0 +1,316 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <concepts>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/dsl/coeff.hpp"
+#include "NeoN/dsl/expression.hpp"
+#include "NeoN/dsl/spatialOperator.hpp"
+#include "NeoN/dsl/temporalOperator.hpp"
+
+namespace NeoN::dsl
+{
+
+template<typename T>
+concept IsStaticOperator = IsSpatialOperator<T> || HasTemporalOperator<T>;
+
+/* @class StaticExpression
+ * @brief An expression whose operators are known at compile time.
+ *
+ * In contrast to the Expression, which stores type erased copies of the operators on the heap,
+ * the concrete operators are stored by value in a tuple. Thus building the expression does not
+ * allocate, the operations are resolved at compile time and can be inlined, and implicit
+ * Gauss-Green operators of the same field are assembled by fused kernels, see
+ * assembleGaussGreenTerms. The operations of the concrete operators have to be const.
+ *
+ * A StaticExpression is created from concrete operators and extended with operator+ and
+ * operator-, e.g.
+ *
+ *     auto eqn = staticExpression(fvcc::DdtOperator(...)) + fvcc::DivOperator(...);
+ *
+ * and converts to an Expression, e.g. for the time integrators or dictionary driven solvers.
+ *
+ * @ingroup dsl
+ */
+template<IsStaticOperator... Operators>
+class StaticExpression
+{
+public:
+
+    static_assert(sizeof...(Operators) > 0, "A StaticExpression requires at least one operator");
+
+    using VectorValueType =
+        typename std::tuple_element_t<0, std::tuple<Operators...>>::VectorValueType;
+
+    using ValueType = VectorValueType;
+
+    static_assert(
+        (std::same_as<typename Operators::VectorValueType, ValueType> && ...),
+        "All operators of a StaticExpression have to operate on the same value type"
+    );
+
+    explicit StaticExpression(Operators... operators) : operators_(std::move(operators)...) {}
+
+    explicit StaticExpression(std::tuple<Operators...> operators)
+        : operators_(std::move(operators))
+    {}
+
+    /* @brief dispatch read call to operator */
+    void read(const Dictionary& input)
+    {
+        std::apply([&](auto&... ops) { (ops.read(input), ...); }, operators_);
+    }
+
+    /* @brief perform all explicit operation and accumulate the result */
+    Vector<ValueType> explicitOperation(localIdx nCells) const
+    {
+        Vector<ValueType> source(exec(), nCells, zero<ValueType>());
+        explicitOperation(source);
+        return source;
+    }
+
+    /* @brief perform all explicit operation and accumulate the result in place */
+    Vector<ValueType>& explicitOperation(Vector<ValueType>& source) const
+    {
+        forEach(
+            [&]<typename OperatorType>(const OperatorType& op)
+            {
+                if constexpr (isSpatial<OperatorType> && HasExplicitOperator<OperatorType>)
+                {
+                    if (op.getType() == Operator::Type::Explicit) op.explicitOperation(source);
+                }
+            }
+        );
+        return source;
+    }
+
+    Vector<ValueType>& explicitOperation(Vector<ValueType>& source, scalar t, scalar dt) const
+    {
+        forEach(
+            [&]<typename OperatorType>(const OperatorType& op)
+            {
+                if constexpr (HasTemporalExplicitOperator<OperatorType>)
+                {
+                    if (op.getType() == Operator::Type::Explicit)
+                    {
+                        op.explicitOperation(source, t, dt);
+                    }
+                }
+            }
+        );
+        return source;
+    }
+
+    /*@brief compute matrix coefficients based on all spatial operators */
+    void assembleSpatialOperator(la::LinearSystem<ValueType, localIdx>& ls) const
+    {
+        // only expressions containing operators which can provide a Gauss-Green term need to
+        // collect the terms for the fused assembly
+        if constexpr ((HasGaussGreenTerm<Operators> || ...))
+        {
+            std::vector<finiteVolume::cellCentred::GaussGreenTerm<ValueType>> terms;
+            terms.reserve(sizeof...(Operators));
+            forEach(
+                [&]<typename OperatorType>(const OperatorType& op)
+                {
+                    if constexpr (HasGaussGreenTerm<OperatorType>)
+                    {
+                        if (op.getType() != Operator::Type::Implicit) return;
+                        auto term = op.gaussGreenTerm();
+                        if (term)
+                        {
+                            terms.push_back(std::move(*term));
+                            return;
+                        }
+                    }
+                    implicitOperation(op, ls);
+                }
+            );
+            if (!terms.empty())
+            {
+                finiteVolume::cellCentred::assembleGaussGreenTerms<ValueType>(ls, terms);
+            }
+        }
+        else
+        {
+            forEach([&](const auto& op) { implicitOperation(op, ls); });
+        }
+    }
+
+    /*@brief compute matrix coefficients based on all temporal operators
+     * assemble directly into linear system
+     */
+    void
+    assembleTemporalOperator(la::LinearSystem<ValueType, localIdx>& ls, scalar t, scalar dt) const
+    {
+        forEach(
+            [&]<typename OperatorType>(const OperatorType& op)
+            {
+                if constexpr (HasTemporalImplicitOperator<OperatorType>)
+                {
+                    if (op.getType() == Operator::Type::Implicit) op.implicitOperation(ls, t, dt);
+                }
+            }
+        );
+    }
+
+    /* @brief construct a linear system and force assembly
+     *
+     * @param ps a vector of functor performing transformation on the created linear system
+     * @return a tuple of the sparsity pattern and the assembled linear system
+     */
+    std::tuple<la::SparsityPattern, la::LinearSystem<ValueType, localIdx>> assemble(
+        const UnstructuredMesh& mesh,
+        scalar t,
+        scalar dt,
+        std::span<const PostAssemblyBase<ValueType>> ps = {}
+    ) const
+    {
+        auto sp = la::SparsityPattern(mesh);
+        auto ls = la::createEmptyLinearSystem<ValueType, localIdx>(mesh, sp);
+        assemble(t, dt, sp, ls, ps);
+        return {sp, ls};
+    }
+
+    /* @brief assemble into a given linear system
+     *
+     * @param ps a vector of functor performing transformation on the created linear system
+     */
+    void assemble(
+        scalar t,
+        scalar dt,
+        const la::SparsityPattern& sp,
+        la::LinearSystem<ValueType, localIdx>& ls,
+        std::span<const PostAssemblyBase<ValueType>> ps = {}
+    ) const
+    {
+        assembleSpatialOperator(ls);
+        assembleTemporalOperator(ls, t, dt);
+
+        // perform post assembly transformations
+        for (auto p : ps)
+        {
+            p(sp, ls);
+        }
+    }
+
+    /* @brief converts into an Expression holding type erased copies of the operators */
+    Expression<ValueType> toExpression() const
+    {
+        Expression<ValueType> expr(exec());
+        forEach(
+            [&]<typename OperatorType>(const OperatorType& op)
+            {
+                if constexpr (isSpatial<OperatorType>)
+                {
+                    expr.addOperator(SpatialOperator<ValueType>(op));
+                }
+                else
+                {
+                    expr.addOperator(TemporalOperator<ValueType>(op));
+                }
+            }
+        );
+        return expr;
+    }
+
+    operator Expression<ValueType>() const { return toExpression(); }
+
+    /* @brief getter for the total number of terms in the equation */
+    static constexpr localIdx size() { return static_cast<localIdx>(sizeof...(Operators)); }
+
+    const std::tuple<Operators...>& operators() const { return operators_; }
+
+    std::tuple<Operators...>& operators() { return operators_; }
+
+    const Executor& exec() const { return std::get<0>(operators_).exec(); }
+
+private:
+
+    /* @brief operators providing both interfaces are treated as temporal operators */
+    template<typename OperatorType>
+    static constexpr bool isSpatial = !HasTemporalOperator<OperatorType>;
+
+    template<typename Func>
+    void forEach(Func&& func) const
+    {
+        std::apply([&](const auto&... ops) { (func(ops), ...); }, operators_);
+    }
+
+    template<typename OperatorType>
+    static void implicitOperation(const OperatorType& op, la::LinearSystem<ValueType, localIdx>& ls)
+    {
+        if constexpr (isSpatial<OperatorType> && HasImplicitOperator<OperatorType>)
+        {
+            if (op.getType() == Operator::Type::Implicit) op.implicitOperation(ls);
+        }
+    }
+
+    std::tuple<Operators...> operators_;
+};
+
+/* @brief creates a StaticExpression from concrete operators */
+template<IsStaticOperator... Operators>
+[[nodiscard]] inline StaticExpression<Operators...> staticExpression(Operators... operators)
+{
+    return StaticExpression<Operators...>(std::move(operators)...);
+}
+
+template<typename... Operators, IsStaticOperator OperatorType>
+[[nodiscard]] inline StaticExpression<Operators..., OperatorType>
+operator+(StaticExpression<Operators...> lhs, OperatorType rhs)
+{
+    return StaticExpression<Operators..., OperatorType>(
+        std::tuple_cat(std::move(lhs.operators()), std::make_tuple(std::move(rhs)))
+    );
+}
+
+template<typename... LeftOperators, typename... RightOperators>
+[[nodiscard]] inline StaticExpression<LeftOperators..., RightOperators...>
+operator+(StaticExpression<LeftOperators...> lhs, StaticExpression<RightOperators...> rhs)
+{
+    return StaticExpression<LeftOperators..., RightOperators...>(
+        std::tuple_cat(std::move(lhs.operators()), std::move(rhs.operators()))
+    );
+}
+
+template<typename... Operators>
+[[nodiscard]] inline StaticExpression<Operators...>
+operator*(const Coeff& coeff, StaticExpression<Operators...> expr)
+{
+    std::apply([&](auto&... ops) { ((ops.getCoefficient() *= coeff), ...); }, expr.operators());
+    return expr;
+}
+
+template<typename... Operators>
+[[nodiscard]] inline StaticExpression<Operators...>
+operator*(scalar scale, StaticExpression<Operators...> expr)
+{
+    return Coeff(scale) * std::move(expr);
+}
+
+template<typename... Operators, IsStaticOperator OperatorType>
+[[nodiscard]] inline StaticExpression<Operators..., OperatorType>
+operator-(StaticExpression<Operators...> lhs, OperatorType rhs)
+{
+    rhs.getCoefficient() *= -1.0;
+    return std::move(lhs) + std::move(rhs);
+}
+
+template<typename... LeftOperators, typename... RightOperators>
+[[nodiscard]] inline StaticExpression<LeftOperators..., RightOperators...>
+operator-(StaticExpression<LeftOperators...> lhs, StaticExpression<RightOperators...> rhs)
+{
+    return std::move(lhs) + (-1.0 * std::move(rhs));
+}
+
+} // namespace dsl
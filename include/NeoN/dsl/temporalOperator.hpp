@@ -6,12 +6,14 @@
 
 #include <memory>
 #include <concepts>
+#include <optional>
 
 #include "NeoN/core/primitives/scalar.hpp"
 #include "NeoN/core/vector/vector.hpp"
 #include "NeoN/linearAlgebra/linearSystem.hpp"
 #include "NeoN/core/input.hpp"
 #include "NeoN/dsl/coeff.hpp"
+#include "NeoN/dsl/dependencySignature.hpp"
 #include "NeoN/dsl/operator.hpp"
 
 namespace NeoN::dsl
@@ -39,6 +41,13 @@ concept HasTemporalImplicitOperator = requires(T t) {
     } -> std::same_as<void>; // Adjust return type and arguments as needed
 };
 
+template<typename T>
+concept HasTemporalDependencySignature = requires(T const t) {
+    {
+        t.dependencySignature(std::declval<NeoN::scalar>(), std::declval<NeoN::scalar>())
+    } -> std::same_as<std::optional<DependencySignature>>;
+};
+
 template<typename T>
 concept HasTemporalOperator = HasTemporalExplicitOperator<T> || HasTemporalImplicitOperator<T>;
 
@@ -79,6 +88,13 @@ public:
         model_->implicitOperation(ls, t, dt);
     }
 
+    /* @brief the state of the inputs of the implicit contribution, empty if the contribution
+     * has to be assembled every time */
+    std::optional<DependencySignature> dependencySignature(scalar t, scalar dt) const
+    {
+        return model_->dependencySignature(t, dt);
+    }
+
     /* returns the fundamental type of an operator, ie explicit, implicit */
     Operator::Type getType() const { return model_->getType(); }
 
@@ -109,6 +125,9 @@ private:
         virtual void
         implicitOperation(la::LinearSystem<ValueType, localIdx>& ls, scalar t, scalar dt) = 0;
 
+        virtual std::optional<DependencySignature>
+        dependencySignature(scalar t, scalar dt) const = 0;
+
         /* @brief Given an input this function reads required properties */
         virtual void read(const Input& input) = 0;
 
@@ -160,6 +179,16 @@ private:
             }
         }
 
+        virtual std::optional<DependencySignature>
+        dependencySignature(scalar t, scalar dt) const override
+        {
+            if constexpr (HasTemporalDependencySignature<ConcreteTemporalOperatorType>)
+            {
+                return concreteOp_.dependencySignature(t, dt);
+            }
+            return std::nullopt;
+        }
+
         /* @brief Given an input this function reads required coeffs */
         virtual void read(const Input& input) override { concreteOp_.read(input); }
 
@@ -16,4 +16,13 @@ namespace NeoN::finiteVolume::cellCentred
  */
 std::pair<scalar, scalar> computeCoNum(const SurfaceField<scalar>& faceFlux, const scalar dt);
 
+/* @brief Calculates the maximum courant number from the face fluxes in a single reduction.
+ * @details The fluxes of the faces of every cell are gathered via the cached cell to face
+ * stencil, thus neither a temporary field nor atomics are required.
+ * @param faceFlux Scalar surface field with the flux values of all faces.
+ * @param dt Size of the time step.
+ * @return Maximum courant number.
+ */
+scalar computeMaxCoNum(const SurfaceField<scalar>& faceFlux, const scalar dt);
+
 } // namespace NeoN
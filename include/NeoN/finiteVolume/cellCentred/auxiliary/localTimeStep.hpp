@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @class LocalTimeStep
+ * @brief Per cell pseudo time step sizes for the acceleration of steady state computations.
+ *
+ * The reciprocal of the local time step size is computed from the cell Courant number and,
+ * optionally, the cell diffusion number:
+ *
+ * rDeltaT = max(1/maxDeltaT, sum|phi_f| / (2 maxCo V), sum(gamma_f |S_f| deltaCoeff_f) / (maxDi V))
+ *
+ * Afterwards the field is smoothed, such that the time step size of a cell does not exceed the
+ * time step size of its neighbours by more than a factor of 1 + smoothingCoeff.
+ *
+ * The following keys are read from the dictionary:
+ * - maxCo: the target Courant number of every cell (required)
+ * - maxDi: the target diffusion number of every cell (default 1.0)
+ * - maxDeltaT: upper limit of the local time step size (default unlimited)
+ * - smoothingCoeff: the allowed ratio of neighbouring time step sizes minus one (default 0.2)
+ * - nSmoothingSweeps: number of smoothing sweeps (default 2)
+ *
+ * The reciprocal time step sizes are consumed by the DdtOperator, see dsl::imp::ddt(phi, rDeltaT).
+ */
+class LocalTimeStep
+{
+public:
+
+    LocalTimeStep(const UnstructuredMesh& mesh, const Dictionary& dict);
+
+    /* @brief Computes the local time step sizes from the convective face fluxes. */
+    void update(const SurfaceField<scalar>& faceFlux);
+
+    /* @brief Computes the local time step sizes from the convective face fluxes and the face
+     * diffusivity.
+     */
+    void update(const SurfaceField<scalar>& faceFlux, const SurfaceField<scalar>& gamma);
+
+    /* @brief The reciprocal of the local time step size of every cell. */
+    const Vector<scalar>& rDeltaT() const { return rDeltaT_; }
+
+private:
+
+    void smooth();
+
+    const UnstructuredMesh& mesh_;
+
+    scalar maxCo_;
+
+    scalar maxDi_;
+
+    scalar maxDeltaT_;
+
+    scalar smoothingCoeff_;
+
+    label nSmoothingSweeps_;
+
+    Vector<scalar> rDeltaT_;
+};
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/segmentedVector.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief The error of mapping a field between two meshes. */
+struct MappingStatistics
+{
+    // the number of target cells whose centres are outside of the source mesh, these cells are
+    // mapped from the nearest source cell
+    localIdx nOutside = 0;
+
+    // the magnitude of the difference of the volume integrals of the target and the source field
+    // relative to the source volume times the largest magnitude of the source field
+    scalar integralError = 0.0;
+
+    // the amount by which the target field exceeds the range of the source field, the extrema
+    // of vectors refer to the magnitude
+    scalar boundednessError = 0.0;
+};
+
+/* @brief the largest number of samples per direction derived from the volume ratio of the meshes */
+constexpr localIdx maxDerivedSamples = 16;
+
+/* @class MeshToMesh
+ * @brief Maps volume fields from a source to a target mesh, e.g. to restart on a changed mesh.
+ *
+ * The value of a target cell is a weighted sum of source cell values. The source cells and
+ * weights are computed once with the cached MeshSearch of both meshes, afterwards every field
+ * is mapped in a single kernel. The following methods are configured by the key method:
+ * - nearest: the source cell with the closest centre to the target cell centre
+ * - conservative (default): the volume-weighted mean of the source cells overlapping the target
+ *   cell. The mesh stores no cell points, thus the overlap is estimated by nSamples^3 uniformly
+ *   distributed points in the box of the face centres of the target cell. By default nSamples is
+ *   the cube root of the volume ratio of the largest target and the smallest source cell rounded
+ *   up, but at least 2, and ratios requiring more than maxDerivedSamples are rejected unless
+ *   nSamples is set. The weights are exact for nested uniform hexahedral meshes if nSamples is a
+ *   multiple of the refinement ratio per direction, e.g. the default, otherwise they are
+ *   approximations whose error decreases with nSamples. Target cells without samples inside of
+ *   the source mesh are mapped from the nearest source cell.
+ * The samples are located in batches of at most batchSize target cells (defaults to 2^21
+ * samples per batch) to limit the memory consumption. Both meshes have to be on the same
+ * executor and the source mesh has to cover the target mesh, e.g. the reconstructed mesh of a
+ * previous run.
+ */
+class MeshToMesh
+{
+public:
+
+    MeshToMesh(
+        const UnstructuredMesh& source, const UnstructuredMesh& target, const Dictionary& dict = {}
+    );
+
+    const std::string& method() const { return method_; }
+
+    /* @brief the number of target cells whose centres are outside of the source mesh */
+    localIdx nOutside() const { return nOutside_; }
+
+    /* @brief the source cells of every target cell, i.e. one segment per target cell */
+    const SegmentedVector<localIdx, localIdx>& sources() const { return sources_; }
+
+    /* @brief the weight of every source cell, the weights of a target cell sum to one */
+    const Vector<scalar>& weights() const { return weights_; }
+
+    /* @brief Maps the internal field of the source to the target and corrects the boundary
+     * conditions of the target.
+     * @return The mapping error, which is computed in two additional reduction kernels.
+     */
+    template<typename ValueType>
+    MappingStatistics map(const VolumeField<ValueType>& source, VolumeField<ValueType>& target)
+        const;
+
+private:
+
+    void computeNearest(const Vector<localIdx>& nearest);
+
+    void
+    computeConservative(const Vector<localIdx>& nearest, localIdx nSamples, localIdx batchSize);
+
+    const UnstructuredMesh& source_;
+
+    const UnstructuredMesh& target_;
+
+    std::string method_;
+
+    localIdx nOutside_;
+
+    SegmentedVector<localIdx, localIdx> sources_;
+
+    Vector<scalar> weights_;
+};
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -13,11 +13,13 @@
 #include "boundary/volume/fixedValue.hpp"
 #include "boundary/volume/fixedGradient.hpp"
 #include "boundary/volume/symmetry.hpp"
+#include "boundary/volume/processor.hpp"
 
 #include "boundary/surface/empty.hpp"
 #include "boundary/surface/calculated.hpp"
 #include "boundary/surface/fixedValue.hpp"
 #include "boundary/surface/symmetry.hpp"
+#include "boundary/surface/processor.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -81,6 +83,9 @@ template class fvcc::volumeBoundary::Empty<Vec3>;
 template class fvcc::volumeBoundary::Symmetry<scalar>;
 template class fvcc::volumeBoundary::Symmetry<Vec3>;
 
+template class fvcc::volumeBoundary::Processor<scalar>;
+template class fvcc::volumeBoundary::Processor<Vec3>;
+
 template class fvcc::SurfaceBoundaryFactory<scalar>;
 template class fvcc::SurfaceBoundaryFactory<Vec3>;
 
@@ -96,4 +101,7 @@ template class fvcc::surfaceBoundary::Empty<Vec3>;
 template class fvcc::surfaceBoundary::Symmetry<scalar>;
 template class fvcc::surfaceBoundary::Symmetry<Vec3>;
 
+template class fvcc::surfaceBoundary::Processor<scalar>;
+template class fvcc::surfaceBoundary::Processor<Vec3>;
+
 }
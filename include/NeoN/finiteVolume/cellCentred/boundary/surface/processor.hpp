@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/finiteVolume/cellCentred/boundary/surfaceBoundaryFactory.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+
+namespace NeoN::finiteVolume::cellCentred::surfaceBoundary
+{
+
+namespace detail
+{
+// Without this function the compiler warns that calling a __host__ function
+// from a __device__ function is not allowed
+template<typename ValueType>
+void copyProcessorFaceValues(
+    Field<ValueType>& domainVector,
+    const UnstructuredMesh& mesh,
+    std::pair<localIdx, localIdx> range
+)
+{
+    const auto iVector = domainVector.internalVector().view();
+    auto value = domainVector.boundaryData().value().view();
+    auto nInternalFaces = mesh.nInternalFaces();
+
+    NeoN::parallelFor(
+        domainVector.exec(),
+        range,
+        KOKKOS_LAMBDA(const localIdx i) { value[i] = iVector[nInternalFaces + i]; },
+        "copyProcessorFaceValues"
+    );
+}
+}
+
+/* @class Processor
+ * @brief Coupled patch between two parts of a decomposed mesh.
+ *
+ * Processor faces are computed like internal faces from the cells on both sides, hence the
+ * boundary value is the computed face value.
+ */
+template<typename ValueType>
+class Processor : public SurfaceBoundaryFactory<ValueType>::template Register<Processor<ValueType>>
+{
+    using Base = SurfaceBoundaryFactory<ValueType>::template Register<Processor<ValueType>>;
+
+public:
+
+    using ProcessorType = Processor<ValueType>;
+
+    Processor(const UnstructuredMesh& mesh, const Dictionary& dict, localIdx patchID)
+        : Base(mesh, dict, patchID), mesh_(mesh), neighbourRank_(dict.get<label>("neighbourRank"))
+    {}
+
+    virtual void correctBoundaryCondition(Field<ValueType>& domainVector) override
+    {
+        detail::copyProcessorFaceValues(domainVector, mesh_, this->range());
+    }
+
+    label neighbourRank() const { return neighbourRank_; }
+
+    static std::string name() { return "processor"; }
+
+    static std::string doc() { return "Coupled patch to the neighbourRank of a decomposed mesh."; }
+
+    static std::string schema() { return "none"; }
+
+    virtual std::unique_ptr<SurfaceBoundaryFactory<ValueType>> clone() const override
+    {
+        return std::make_unique<Processor>(*this);
+    }
+
+private:
+
+    const UnstructuredMesh& mesh_;
+
+    label neighbourRank_;
+};
+}
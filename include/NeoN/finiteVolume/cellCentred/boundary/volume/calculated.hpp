@@ -22,7 +22,7 @@ public:
     using CalculatedType = Calculated<ValueType>;
 
     Calculated(const UnstructuredMesh& mesh, const Dictionary& dict, localIdx patchID)
-        : Base(mesh, dict, patchID, {.assignable = true})
+        : Base(mesh, dict, patchID, {.assignable = true, .fixedCoefficients = true})
     {}
 
     virtual void correctBoundaryCondition([[maybe_unused]] Field<ValueType>& domainVector) final {}
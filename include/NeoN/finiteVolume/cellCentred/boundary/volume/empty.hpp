@@ -20,7 +20,7 @@ class Empty : public VolumeBoundaryFactory<ValueType>::template Register<Empty<V
 public:
 
     Empty(const UnstructuredMesh& mesh, const Dictionary& dict, localIdx patchID)
-        : Base(mesh, dict, patchID, {.assignable = true})
+        : Base(mesh, dict, patchID, {.assignable = true, .fixedCoefficients = true})
     {}
 
     virtual void correctBoundaryCondition([[maybe_unused]] Field<ValueType>& domainVector) final {}
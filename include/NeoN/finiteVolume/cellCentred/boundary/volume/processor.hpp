@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/finiteVolume/cellCentred/boundary/volumeBoundaryFactory.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+
+namespace NeoN::finiteVolume::cellCentred::volumeBoundary
+{
+
+namespace detail
+{
+// Without this function the compiler warns that calling a __host__ function
+// from a __device__ function is not allowed
+template<typename ValueType>
+void setProcessorCoefficients(Field<ValueType>& domainVector, std::pair<localIdx, localIdx> range)
+{
+    auto [refGradient, valueFraction, refValue] = views(
+        domainVector.boundaryData().refGrad(),
+        domainVector.boundaryData().valueFraction(),
+        domainVector.boundaryData().refValue()
+    );
+
+    NeoN::parallelFor(
+        domainVector.exec(),
+        range,
+        KOKKOS_LAMBDA(const localIdx i) {
+            refGradient[i] = zero<ValueType>();
+            valueFraction[i] = 0.0;
+            refValue[i] = zero<ValueType>();
+        },
+        "setProcessorCoefficients"
+    );
+}
+}
+
+/* @class Processor
+ * @brief Coupled patch between two parts of a decomposed mesh.
+ *
+ * The boundary value holds the value of the cell on the other side of the face. It is not set by
+ * the patch itself but collectively for all processor patches by the ProcessorInterface of the
+ * mesh, when the boundary conditions of the field are corrected and, overlapped with the internal
+ * faces, whenever face values are interpolated.
+ * The coefficients of the patch are zero. Instead, implicit operators couple the processor faces to
+ * the neighbour cells explicitly, using the boundary value of the last exchange, and store the
+ * coupling coefficients in the boundary coefficients of the linear system, from which a
+ * DistributedLinearSystem assembles its non-local block.
+ */
+template<typename ValueType>
+class Processor : public VolumeBoundaryFactory<ValueType>::template Register<Processor<ValueType>>
+{
+    using Base = VolumeBoundaryFactory<ValueType>::template Register<Processor<ValueType>>;
+
+public:
+
+    using ProcessorType = Processor<ValueType>;
+
+    Processor(const UnstructuredMesh& mesh, const Dictionary& dict, localIdx patchID)
+        : Base(mesh, dict, patchID, {.assignable = false, .fixedCoefficients = true}),
+          neighbourRank_(dict.get<label>("neighbourRank"))
+    {}
+
+    virtual void correctBoundaryCondition(Field<ValueType>& domainVector) final
+    {
+        detail::setProcessorCoefficients(domainVector, this->range());
+    }
+
+    label neighbourRank() const { return neighbourRank_; }
+
+    static std::string name() { return "processor"; }
+
+    static std::string doc() { return "Coupled patch to the neighbourRank of a decomposed mesh."; }
+
+    static std::string schema() { return "none"; }
+
+    virtual std::unique_ptr<VolumeBoundaryFactory<ValueType>> clone() const final
+    {
+        return std::make_unique<Processor>(*this);
+    }
+
+private:
+
+    label neighbourRank_;
+};
+
+}
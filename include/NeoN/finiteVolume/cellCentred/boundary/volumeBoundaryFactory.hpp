@@ -20,6 +20,9 @@ namespace NeoN::finiteVolume::cellCentred
 struct BoundaryAttributes
 {
     bool assignable; ///< whether values can be assigned to the boundary patch
+    /// whether the correction sets refValue, refGrad and valueFraction independently of the
+    /// field values, i.e. rewrites the same coefficients on every correction
+    bool fixedCoefficients;
     // bool fixesValue;
 };
 
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "NeoN/core/executor/executor.hpp"
 #include "NeoN/fields/field.hpp"
 #include "NeoN/core/vector/vector.hpp"
@@ -13,6 +15,18 @@
 namespace NeoN::finiteVolume::cellCentred
 {
 
+namespace detail
+{
+
+/* @brief returns a new globally unique field version */
+inline std::size_t nextVersion()
+{
+    static std::atomic<std::size_t> version {0};
+    return ++version;
+}
+
+}
+
 /**
  * @class DomainMixin
  * @brief This class represents a mixin for a geometric field.
@@ -84,7 +98,11 @@ public:
      *
      * @return The reference to the internal field.
      */
-    Vector<ValueType>& internalVector() { return field_.internalVector(); }
+    Vector<ValueType>& internalVector()
+    {
+        markInternalModified();
+        return field_.internalVector();
+    }
 
     /**
      * @brief Returns the size of the internal field
@@ -105,7 +123,11 @@ public:
      *
      * @return The reference to the boundary field.
      */
-    BoundaryData<ValueType>& boundaryData() { return field_.boundaryData(); }
+    BoundaryData<ValueType>& boundaryData()
+    {
+        markModified();
+        return field_.boundaryData();
+    }
 
     /**
      * @brief Returns a const reference to the executor object.
@@ -121,13 +143,48 @@ public:
      */
     const UnstructuredMesh& mesh() const { return mesh_; }
 
+    /**
+     * @brief Returns the version of the field, which changes whenever the field is accessed
+     * through a non-const accessor and is unique across all fields.
+     *
+     * @note Writes through views obtained before the last call of a non-const accessor are not
+     * tracked, call markModified() afterwards.
+     */
+    std::size_t version() const { return version_; }
+
+    /**
+     * @brief Returns the version of the boundary data, which changes whenever the boundary data is
+     * accessed through a non-const accessor or the field is marked as modified, but not if only
+     * the internal values are modified.
+     */
+    std::size_t boundaryVersion() const { return boundaryVersion_; }
+
+    /**
+     * @brief Marks the field as modified by assigning a new version to the field and its boundary.
+     */
+    void markModified()
+    {
+        version_ = detail::nextVersion();
+        boundaryVersion_ = version_;
+    }
+
     std::string name; // The name of the field
 
 protected:
 
+    /**
+     * @brief Marks only the internal values as modified, the boundary version is kept.
+     */
+    void markInternalModified() { version_ = detail::nextVersion(); }
+
     Executor exec_;                // The executor object
     const UnstructuredMesh& mesh_; // The unstructured mesh object
     Field<ValueType> field_;       // The domain field object
+
+private:
+
+    std::size_t version_ = detail::nextVersion(); // The version of the field values
+    std::size_t boundaryVersion_ = version_;      // The version of the boundary data
 };
 
 } // namespace NeoN
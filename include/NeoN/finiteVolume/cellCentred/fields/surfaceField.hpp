@@ -138,6 +138,7 @@ public:
      */
     void correctBoundaryConditions()
     {
+        this->markModified();
         for (auto& boundaryCondition : boundaryConditions_)
         {
             boundaryCondition.correctBoundaryCondition(this->field_);
@@ -117,7 +117,8 @@ public:
      * @brief Corrects the boundary conditions of the surface field.
      *
      * This function applies the correctBoundaryConditions() method to each boundary condition in
-     * the field.
+     * the field. If all boundary conditions have fixed coefficients and the boundary data was not
+     * modified since the last correction, the boundary version is kept.
      */
     void correctBoundaryConditions();
 
@@ -130,6 +131,7 @@ private:
 
     std::vector<VolumeBoundary<ValueType>> boundaryConditions_; // The vector of boundary conditions
     std::optional<Database*> db_; // The optional pointer to the database
+    std::size_t correctedBoundaryVersion_ = 0; // The boundary version after the last correction
 };
 
 } // namespace NeoN
@@ -7,6 +7,8 @@
 #include "NeoN/core/vector/vector.hpp"
 #include "NeoN/core/executor/executor.hpp"
 #include "NeoN/core/input.hpp"
+#include "NeoN/dsl/coeff.hpp"
+#include "NeoN/dsl/dependencySignature.hpp"
 #include "NeoN/dsl/operator.hpp"
 #include "NeoN/linearAlgebra/linearSystem.hpp"
 #include "NeoN/linearAlgebra/sparsityPattern.hpp"
@@ -25,12 +27,27 @@ public:
 
     DdtOperator(dsl::Operator::Type termType, VolumeField<ValueType>& field);
 
+    /* @brief Creates a ddt operator with a local time step size per cell, eg. for pseudo time
+     * stepping towards a steady state, the time step size passed to the operations is ignored.
+     * @param rDeltaT The reciprocal of the local time step size, has to outlive the operator,
+     * see LocalTimeStep.
+     */
+    DdtOperator(
+        dsl::Operator::Type termType, VolumeField<ValueType>& field, const Vector<scalar>& rDeltaT
+    );
+
     ~DdtOperator();
 
     void explicitOperation(Vector<ValueType>& source, scalar, scalar dt) const;
 
     void implicitOperation(la::LinearSystem<ValueType, localIdx>& ls, scalar, scalar dt) const;
 
+    /* @brief The implicit contribution depends on the time step size and the old time field,
+     * thus it can be reused within the outer iterations of a time step. Local time steps are
+     * updated in place and always require a new assembly.
+     */
+    std::optional<dsl::DependencySignature> dependencySignature(scalar, scalar dt) const;
+
     void read(const Input&) {}
 
     const la::SparsityPattern& getSparsityPattern() const { return sparsityPattern_; }
@@ -39,8 +56,15 @@ public:
 
 private:
 
+    /* @brief The reciprocal time step size, either of the local time steps or the global one */
+    dsl::Coeff rDeltaT(scalar dt) const { return localTimeStep_ ? rDeltaT_ : dsl::Coeff(1.0 / dt); }
+
     // NOTE ddtOperator does not have a FactoryClass
     const la::SparsityPattern& sparsityPattern_;
+
+    bool localTimeStep_;
+
+    dsl::Coeff rDeltaT_;
 };
 
 
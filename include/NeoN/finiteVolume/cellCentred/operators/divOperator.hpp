@@ -9,8 +9,10 @@
 #include "NeoN/core/executor/executor.hpp"
 #include "NeoN/core/input.hpp"
 #include "NeoN/dsl/spatialOperator.hpp"
+#include "NeoN/dsl/dependencySignature.hpp"
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
 #include "NeoN/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedAssembly.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -67,6 +69,24 @@ public:
         const VolumeField<ValueType>& phi,
         const dsl::Coeff operatorScaling) const = 0;
 
+    /* @brief The face data for the fused assembly, empty if the scheme does not support it. */
+    virtual std::optional<GaussGreenTerm<ValueType>> gaussGreenTerm(
+        const SurfaceField<scalar>&, const VolumeField<ValueType>&, const dsl::Coeff
+    ) const
+    {
+        return std::nullopt;
+    }
+
+    /* @brief The dependency signature of the implicit contribution, empty if the contribution
+     * has to be assembled every time.
+     */
+    virtual std::optional<dsl::DependencySignature> dependencySignature(
+        const SurfaceField<scalar>&, const VolumeField<ValueType>&, const dsl::Coeff&
+    ) const
+    {
+        return std::nullopt;
+    }
+
     [[deprecated("This function will be removed")]] const la::SparsityPattern&
     getSparsityPattern() const
     {
@@ -103,6 +123,9 @@ public:
               divOp.divOperatorStrategy_ ? divOp.divOperatorStrategy_->clone() : nullptr
           ) {};
 
+    // move constructor, takes over the strategy instead of cloning it
+    DivOperator(DivOperator&& divOp) = default;
+
     DivOperator(
         dsl::Operator::Type termType,
         const SurfaceField<scalar>& faceFlux,
@@ -154,6 +177,22 @@ public:
         divOperatorStrategy_->div(ls, faceFlux_, this->getVector(), operatorScaling);
     }
 
+    std::optional<GaussGreenTerm<ValueType>> gaussGreenTerm() const
+    {
+        if (!divOperatorStrategy_) return std::nullopt;
+        return divOperatorStrategy_->gaussGreenTerm(
+            faceFlux_, this->getVector(), this->getCoefficient()
+        );
+    }
+
+    std::optional<dsl::DependencySignature> dependencySignature() const
+    {
+        if (!divOperatorStrategy_) return std::nullopt;
+        return divOperatorStrategy_->dependencySignature(
+            faceFlux_, this->getVector(), this->getCoefficient()
+        );
+    }
+
     [[deprecated("use explicit or implicit operation")]] void div(auto&&... args) const
     {
         const auto operatorScaling = this->getCoefficient();
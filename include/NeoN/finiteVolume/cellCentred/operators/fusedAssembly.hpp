@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <optional>
+#include <span>
+
+#include "NeoN/dsl/coeff.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief The maximum number of terms assembled by a single pair of fused kernels. */
+constexpr std::size_t maxFusedGaussGreenTerms = 4;
+
+/* @class GaussGreenTerm
+ * @brief The face data of an implicit Gauss-Green operator, which allows to assemble several
+ * operators of the same field in a single pass over the faces.
+ *
+ * Every internal face of a Gauss-Green operator contributes a coefficient c_o to the owner row
+ * and c_n to the neighbour row of the matrix and, since the operators are conservative,
+ * -c_n and -c_o to the diagonals of the owner and neighbour row, respectively:
+ * - divergence: c_o = F (1 - w), c_n = -w F, with the face flux F and interpolation weight w
+ * - laplacian: c_o = c_n = gamma |S| delta, with the diffusivity gamma and delta coefficient delta
+ */
+template<typename ValueType>
+struct GaussGreenTerm
+{
+    enum class Kind
+    {
+        Div,
+        Laplacian
+    };
+
+    Kind kind;
+
+    const VolumeField<ValueType>& phi;
+
+    /* the face flux of a divergence, the diffusivity of a laplacian */
+    const SurfaceField<scalar>& faceCoeffs;
+
+    dsl::Coeff operatorScaling;
+
+    /* the interpolation weights of a divergence */
+    std::optional<SurfaceField<scalar>> weights;
+
+    /* the delta coefficients of a laplacian */
+    const SurfaceField<scalar>* deltaCoeffs;
+};
+
+/* @brief Assembles implicit Gauss-Green operators into a linear system.
+ * The terms are grouped by their field and, instead of one face and two boundary kernels per
+ * operator, the coefficients of up to maxFusedGaussGreenTerms operators of a group are
+ * accumulated in a single internal face and a single boundary face kernel, thus the mesh connectivity and sparsity pattern are read and the
+ * diagonal is updated atomically only once per face. Like the matrix and the rhs, the boundary
+ * coefficients of the linear system accumulate the contributions of all terms and chunks, thus
+ * the linear system has to be reset before the assembly.
+ */
+template<typename ValueType>
+void assembleGaussGreenTerms(
+    la::LinearSystem<ValueType, localIdx>& ls, std::span<const GaussGreenTerm<ValueType>> terms
+);
+
+} // namespace NeoN
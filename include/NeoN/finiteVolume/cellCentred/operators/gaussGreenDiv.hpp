@@ -9,6 +9,7 @@
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
 #include "NeoN/linearAlgebra/sparsityPattern.hpp"
 #include "NeoN/finiteVolume/cellCentred/operators/divOperator.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/gaussGreenSignature.hpp"
 #include "NeoN/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
@@ -104,6 +105,34 @@ public:
         );
     };
 
+    /* @brief The weights of the available interpolation schemes depend on the face flux and the
+     * mesh only, hence the contribution does not depend on the cell values of phi.
+     */
+    std::optional<dsl::DependencySignature> dependencySignature(
+        const SurfaceField<scalar>& faceFlux,
+        const VolumeField<ValueType>& phi,
+        const dsl::Coeff& operatorScaling
+    ) const override
+    {
+        return gaussGreenSignature(this, faceFlux, phi, operatorScaling);
+    }
+
+    std::optional<GaussGreenTerm<ValueType>> gaussGreenTerm(
+        const SurfaceField<scalar>& faceFlux,
+        const VolumeField<ValueType>& phi,
+        const dsl::Coeff operatorScaling
+    ) const override
+    {
+        return GaussGreenTerm<ValueType> {
+            GaussGreenTerm<ValueType>::Kind::Div,
+            phi,
+            faceFlux,
+            operatorScaling,
+            surfaceInterpolation_.weight(faceFlux, phi),
+            nullptr
+        };
+    }
+
     std::unique_ptr<DivOperatorFactory<ValueType>> clone() const override
     {
         return std::make_unique<GaussGreenDiv<ValueType>>(*this);
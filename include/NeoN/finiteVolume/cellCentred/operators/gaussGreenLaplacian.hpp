@@ -9,6 +9,7 @@
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
 #include "NeoN/linearAlgebra/sparsityPattern.hpp"
 #include "NeoN/finiteVolume/cellCentred/operators/laplacianOperator.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/gaussGreenSignature.hpp"
 #include "NeoN/finiteVolume/cellCentred/interpolation/surfaceInterpolation.hpp"
 #include "NeoN/finiteVolume/cellCentred/faceNormalGradient/faceNormalGradient.hpp"
 
@@ -108,6 +109,31 @@ public:
         );
     };
 
+    std::optional<dsl::DependencySignature> dependencySignature(
+        const SurfaceField<scalar>& gamma,
+        const VolumeField<ValueType>& phi,
+        const dsl::Coeff& operatorScaling
+    ) const override
+    {
+        return gaussGreenSignature(this, gamma, phi, operatorScaling);
+    }
+
+    std::optional<GaussGreenTerm<ValueType>> gaussGreenTerm(
+        const SurfaceField<scalar>& gamma,
+        const VolumeField<ValueType>& phi,
+        const dsl::Coeff operatorScaling
+    ) const override
+    {
+        return GaussGreenTerm<ValueType> {
+            GaussGreenTerm<ValueType>::Kind::Laplacian,
+            phi,
+            gamma,
+            operatorScaling,
+            std::nullopt,
+            &faceNormalGradient_.deltaCoeffs()
+        };
+    }
+
     std::unique_ptr<LaplacianOperatorFactory<ValueType>> clone() const override
     {
         return std::make_unique<GaussGreenLaplacian<ValueType>>(*this);
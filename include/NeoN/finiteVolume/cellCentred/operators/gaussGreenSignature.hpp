@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <optional>
+
+#include "NeoN/dsl/coeff.hpp"
+#include "NeoN/dsl/dependencySignature.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief The dependency signature of an implicit Gauss-Green operator on a static mesh.
+ *
+ * The contribution depends on the face coefficients, i.e. the face flux or the diffusivity, the
+ * operator scaling and the boundary coefficients of phi, but not on the cell values of phi.
+ * Thus the boundary version of phi is used, which boundary conditions with fixed coefficients
+ * keep on correction. On processor faces the lagged values of the neighbouring cells are part of
+ * the contribution, which are tracked by the version of phi.
+ *
+ * @param scheme The operator strategy, a new strategy invalidates the signature.
+ * @return The signature or an empty optional if the operator scaling is not uniform.
+ */
+template<typename ValueType>
+std::optional<dsl::DependencySignature> gaussGreenSignature(
+    const void* scheme,
+    const SurfaceField<scalar>& faceCoeffs,
+    const VolumeField<ValueType>& phi,
+    const dsl::Coeff& operatorScaling
+)
+{
+    dsl::DependencySignature signature;
+    if (!signature.add(operatorScaling)) return std::nullopt;
+    const auto& mesh = phi.mesh();
+    signature.add(scheme, 0).add(&faceCoeffs, faceCoeffs.version());
+    signature.add(&phi, phi.boundaryVersion());
+    if (nPhysicalBoundaryFaces(mesh) < mesh.nBoundaryFaces())
+    {
+        signature.add(&phi, phi.version());
+    }
+    return signature;
+}
+
+} // namespace NeoN
@@ -12,6 +12,8 @@
 #include "NeoN/linearAlgebra/linearSystem.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedAssembly.hpp"
+#include "NeoN/dsl/dependencySignature.hpp"
 #include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
@@ -73,6 +75,24 @@ public:
         const dsl::Coeff operatorScaling
     ) = 0;
 
+    /* @brief The face data for the fused assembly, empty if the scheme does not support it. */
+    virtual std::optional<GaussGreenTerm<ValueType>> gaussGreenTerm(
+        const SurfaceField<scalar>&, const VolumeField<ValueType>&, const dsl::Coeff
+    ) const
+    {
+        return std::nullopt;
+    }
+
+    /* @brief The dependency signature of the implicit contribution, empty if the contribution
+     * has to be assembled every time.
+     */
+    virtual std::optional<dsl::DependencySignature> dependencySignature(
+        const SurfaceField<scalar>&, const VolumeField<ValueType>&, const dsl::Coeff&
+    ) const
+    {
+        return std::nullopt;
+    }
+
     // Pure virtual function for cloning
     virtual std::unique_ptr<LaplacianOperatorFactory<ValueType>> clone() const = 0;
 
@@ -109,6 +129,9 @@ public:
               lapOp.laplacianOperatorStrategy_ ? lapOp.laplacianOperatorStrategy_->clone() : nullptr
           ) {};
 
+    // move constructor, takes over the strategy instead of cloning it
+    LaplacianOperator(LaplacianOperator&& lapOp) = default;
+
     LaplacianOperator(
         dsl::Operator::Type termType,
         const SurfaceField<scalar>& gamma,
@@ -153,6 +176,22 @@ public:
         laplacianOperatorStrategy_->laplacian(ls, gamma_, this->field_, operatorScaling);
     }
 
+    std::optional<dsl::DependencySignature> dependencySignature() const
+    {
+        if (!laplacianOperatorStrategy_) return std::nullopt;
+        return laplacianOperatorStrategy_->dependencySignature(
+            gamma_, this->field_, this->getCoefficient()
+        );
+    }
+
+    std::optional<GaussGreenTerm<ValueType>> gaussGreenTerm() const
+    {
+        if (!laplacianOperatorStrategy_) return std::nullopt;
+        return laplacianOperatorStrategy_->gaussGreenTerm(
+            gamma_, this->field_, this->getCoefficient()
+        );
+    }
+
     [[deprecated("use explicit or implicit operation")]] void laplacian(VolumeField<scalar>& lapPhi)
     {
         const auto operatorScaling = this->getCoefficient();
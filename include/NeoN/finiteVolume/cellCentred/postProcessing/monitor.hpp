@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @brief Finds the cells whose centres are closest to the given points.
+ * @details The points are located with the cached MeshSearch of the mesh.
+ * @return The cell index of every point on the executor of the mesh.
+ */
+Vector<localIdx> findCells(const UnstructuredMesh& mesh, const std::vector<Vec3>& points);
+
+/* @brief Volume-weighted statistics of a field, the extrema of vectors refer to the magnitude.
+ *
+ * The type is used as value of a single reduction kernel, thus the default constructed object
+ * is the identity and operator+= joins the partial results.
+ */
+template<typename ValueType>
+struct VolumeStatistics
+{
+    scalar min = std::numeric_limits<scalar>::max();
+
+    scalar max = std::numeric_limits<scalar>::lowest();
+
+    ValueType weightedSum {};
+
+    scalar volume = 0.0;
+
+    KOKKOS_INLINE_FUNCTION
+    VolumeStatistics& operator+=(const VolumeStatistics& other)
+    {
+        min = other.min < min ? other.min : min;
+        max = other.max > max ? other.max : max;
+        weightedSum += other.weightedSum;
+        volume += other.volume;
+        return *this;
+    }
+
+    /* @brief the volume-weighted mean value */
+    ValueType mean() const { return (1.0 / volume) * weightedSum; }
+};
+
+/* @brief Computes the minimum, maximum and volume-weighted mean of the internal field.
+ * @details The statistics are computed in a single reduction kernel.
+ */
+template<typename ValueType>
+VolumeStatistics<ValueType> volumeStatistics(const VolumeField<ValueType>& field);
+
+/* @class Monitor
+ * @brief Writes sampled values of selected volume fields as compact time series.
+ *
+ * Instead of writing complete fields, the monitor samples the fields at a few locations and
+ * appends one line per output time to a text file per sampler. The following samplers are
+ * configured by a dictionary:
+ * - probes: a std::vector<Vec3> of points
+ * - lines: a sub dictionary of lines, each with the keys start, end and nPoints
+ * - planes: a sub dictionary of planes, each with the keys origin, e1, e2, nPoints1 and
+ *   nPoints2, the points are distributed uniformly on origin + a * e1 + b * e2 with a and b
+ *   in [0, 1]
+ * - patches: a std::vector<localIdx> of boundary patches, whose area-weighted mean is written
+ * - statistics: whether the volume-weighted min, max and mean are written (default true)
+ * - writeInterval: the number of calls of execute between two outputs (default 1)
+ *
+ * The sample points are mapped to the cells with the closest cell centre once, thus the values
+ * of the cells are written without interpolation. All samples of a field, i.e. the probes,
+ * lines, planes and patch means, are evaluated in a single kernel and the statistics in a single
+ * reduction. Only the sampled values are copied to the host.
+ *
+ * The sampler <sampler> is written to <directory>/<name>_<sampler>.dat, where the probes, patch
+ * means and statistics are named probes, patches and statistics.
+ */
+class Monitor
+{
+public:
+
+    Monitor(
+        const UnstructuredMesh& mesh,
+        const std::filesystem::path& directory,
+        const std::string& name,
+        const Dictionary& dict
+    );
+
+    /* @brief selects a field to be monitored */
+    void add(const VolumeField<scalar>& field);
+
+    /* @brief selects a field to be monitored */
+    void add(const VolumeField<Vec3>& field);
+
+    /* @brief evaluates the samplers if the output interval is reached
+     * @return whether the values have been written
+     */
+    bool execute(scalar time);
+
+    /* @brief the names of the samplers, which are written at every output time */
+    std::vector<std::string> samplers() const;
+
+    /* @brief the file of the sampler with the given name */
+    std::filesystem::path file(const std::string& sampler) const;
+
+private:
+
+    struct Sampler
+    {
+        std::string name;
+        localIdx start;
+        localIdx size;
+    };
+
+    template<typename ValueType>
+    void sample(const VolumeField<ValueType>& field, std::vector<std::string>& rows);
+
+    void openFiles();
+
+    const UnstructuredMesh& mesh_;
+
+    std::filesystem::path directory_;
+
+    std::string name_;
+
+    // the probes, lines and planes, the samples are stored contiguously in cells_
+    std::vector<Sampler> samplers_;
+
+    Vector<localIdx> cells_;
+
+    // the first and one past the last boundary face of every selected patch
+    Vector<localIdx> patchFaces_;
+
+    bool statistics_;
+
+    size_t writeInterval_;
+
+    size_t nCalls_ = 0;
+
+    std::vector<std::variant<const VolumeField<scalar>*, const VolumeField<Vec3>*>> fields_;
+
+    // one file per sampler, followed by the patches and statistics files
+    std::vector<std::unique_ptr<std::ofstream>> files_;
+};
+
+} // namespace NeoN::finiteVolume::cellCentred
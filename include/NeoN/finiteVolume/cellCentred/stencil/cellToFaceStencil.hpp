@@ -17,6 +17,11 @@ public:
 
     CellToFaceStencil(const UnstructuredMesh& mesh);
 
+    /* @brief Returns the stencil cached in the stencil database of the mesh, computes it on first
+     * use.
+     */
+    static const SegmentedVector<localIdx, localIdx>& readOrCreate(const UnstructuredMesh& mesh);
+
     SegmentedVector<localIdx, localIdx> computeStencil() const;
 
 private:
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/core/segmentedVector.hpp"
+#include "NeoN/mesh/unstructured/boundingVolumeHierarchy.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+/* @class MeshSearch
+ * @brief Bounding volume hierarchies over the cells and faces of a mesh.
+ *
+ * The mesh stores no points of the faces, thus the box of a face is estimated from its centre
+ * and area, i.e. the face is assumed to lie within a disk of radius sqrt(|Sf|) around its centre
+ * in the plane of the face. The box of a cell is the union of the boxes of its faces. The boxes
+ * are only used to skip parts of the tree, the queries test the cell and face centres and the
+ * face planes of the cells.
+ */
+class MeshSearch
+{
+public:
+
+    MeshSearch(const UnstructuredMesh& mesh);
+
+    /* @brief Returns the search cached in the stencil database of the mesh, builds it on first
+     * use.
+     */
+    static const MeshSearch& readOrCreate(const UnstructuredMesh& mesh);
+
+    const BoundingVolumeHierarchy& cells() const { return cells_; }
+
+    const BoundingVolumeHierarchy& faces() const { return faces_; }
+
+private:
+
+    MeshSearch(const UnstructuredMesh& mesh, const Array<BoundingBox>& faceBoxes);
+
+    BoundingVolumeHierarchy cells_;
+
+    BoundingVolumeHierarchy faces_;
+};
+
+/* @brief Finds the cell with the closest cell centre for every point in a single kernel. */
+Vector<localIdx> findNearestCells(const UnstructuredMesh& mesh, const Vector<Vec3>& points);
+
+/* @brief Finds the face with the closest face centre for every point in a single kernel. */
+Vector<localIdx> findNearestFaces(const UnstructuredMesh& mesh, const Vector<Vec3>& points);
+
+/* @brief Finds the cell containing every point in a single kernel.
+ * @details A point is inside a cell if it is behind all face planes of the cell, which requires
+ * convex cells with planar faces. Points on faces are assigned to one of the adjacent cells.
+ * @return The cell index of every point, -1 for points outside of the mesh.
+ */
+Vector<localIdx> findContainingCells(const UnstructuredMesh& mesh, const Vector<Vec3>& points);
+
+/* @brief Finds all cells whose centres are within the radius around every point.
+ * @details The cells are counted in a first and collected in a second kernel.
+ * @return The cells of every point, i.e. one segment per point.
+ */
+SegmentedVector<localIdx, localIdx>
+findCellsInRadius(const UnstructuredMesh& mesh, const Vector<Vec3>& points, scalar radius);
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#if NF_WITH_ADIOS2
+
+#include <deque>
+#include <string>
+#include <variant>
+
+#include <adios2.h>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/primitives/label.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/domain.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::io
+{
+
+/* @class Adios2Writer
+ * @brief Writes the mesh and volume or surface fields to an ADIOS2 engine.
+ *
+ * Every output time is an ADIOS2 step. The fields are put in deferred mode and handed to the
+ * engine at endStep(), thus the engine decides when the data is actually written. With the
+ * default BP5 engine the data is written asynchronously (AsyncWrite), i.e. endStep() returns
+ * once the data is buffered and the file system access overlaps with the next time steps. The
+ * in-situ engines, e.g. SST or Inline, hand the steps to a reader instead of a file.
+ *
+ * The writer is configured by a dictionary with the following keys:
+ * - engine: the ADIOS2 engine type (default BP5)
+ * - parameters: a sub dictionary of string values passed to the engine, e.g. NumAggregators,
+ *   AggregationType or NumSubFiles to configure the aggregation on large rank counts, or
+ *   AsyncWrite (default Guided for BP5)
+ *
+ * Each rank writes its part of the mesh and fields as a local block, the block id is the rank.
+ * On the first step the mesh is written to the mesh/ variables, each field is written to
+ * <name>/internal and <name>/boundary. Fields must not be modified between put() and endStep(),
+ * data of device executors is staged in host memory.
+ */
+class Adios2Writer
+{
+public:
+
+    Adios2Writer(
+        const UnstructuredMesh& mesh, const std::string& fileName, const Dictionary& dict = {}
+    );
+
+    Adios2Writer(const Adios2Writer&) = delete;
+
+    Adios2Writer& operator=(const Adios2Writer&) = delete;
+
+    /* @brief closes the engine, i.e. waits until all steps are written */
+    ~Adios2Writer();
+
+    /* @brief begins a new output step and writes the time */
+    void beginStep(scalar time);
+
+    /* @brief puts the internal and boundary values of a field into the current step */
+    template<typename ValueType>
+    void put(const finiteVolume::cellCentred::DomainMixin<ValueType>& field)
+    {
+        putVector(field.name + "/internal", field.internalVector());
+        putVector(field.name + "/boundary", field.boundaryData().value());
+    }
+
+    /* @brief hands the current step to the engine, returns before the data is written */
+    void endStep();
+
+    /* @brief closes the engine, further steps can not be written */
+    void close();
+
+    /* @brief number of completed steps */
+    size_t steps() const { return steps_; }
+
+private:
+
+    template<typename ValueType>
+    void putVector(const std::string& name, const Vector<ValueType>& vec);
+
+    void putMesh();
+
+    const UnstructuredMesh& mesh_;
+
+    adios2::ADIOS adios_;
+
+    adios2::IO io_;
+
+    adios2::Engine engine_;
+
+    // host copies of device data, kept alive until the deferred puts are performed
+    std::deque<std::variant<Vector<scalar>, Vector<Vec3>, Vector<label>>> staged_;
+
+    bool inStep_ = false;
+
+    size_t steps_ = 0;
+};
+
+/* @class Adios2Reader
+ * @brief Reads the steps written by an Adios2Writer from a file or an in-situ engine.
+ *
+ * The reader is configured by the same dictionary keys as the Adios2Writer. Like the writer,
+ * the reader uses the communicator of the mesh and each rank reads the block with its rank as
+ * id, thus the data has to be read with the same decomposition. The vectors are read on the
+ * executor of the mesh.
+ */
+class Adios2Reader
+{
+public:
+
+    Adios2Reader(
+        const UnstructuredMesh& mesh, const std::string& fileName, const Dictionary& dict = {}
+    );
+
+    Adios2Reader(const Adios2Reader&) = delete;
+
+    Adios2Reader& operator=(const Adios2Reader&) = delete;
+
+    ~Adios2Reader();
+
+    /* @brief begins the next step, returns false if no further steps are available */
+    bool beginStep();
+
+    /* @brief time of the current step */
+    scalar time();
+
+    /* @brief reads the internal and boundary values of a field of the current step */
+    template<typename ValueType>
+    void get(finiteVolume::cellCentred::DomainMixin<ValueType>& field)
+    {
+        get(field.name + "/internal", field.internalVector());
+        get(field.name + "/boundary", field.boundaryData().value());
+    }
+
+    /* @brief reads a variable of the current step into the existing allocation of a vector of
+     * the same size
+     */
+    template<typename ValueType>
+    void get(const std::string& name, Vector<ValueType>& vec);
+
+    /* @brief reads a variable of the current step, e.g. mesh/points, into a new vector
+     * on the executor of the reader
+     */
+    template<typename ValueType>
+    Vector<ValueType> get(const std::string& name);
+
+    void endStep();
+
+    void close();
+
+private:
+
+    /* @brief reads the block of this rank of a variable into a host vector */
+    template<typename ValueType>
+    Vector<ValueType> getHost(const std::string& name);
+
+    Executor exec_;
+
+    adios2::ADIOS adios_;
+
+    adios2::IO io_;
+
+    adios2::Engine engine_;
+
+    size_t block_ = 0;
+
+    bool inStep_ = false;
+};
+
+} // namespace NeoN::io
+
+#endif
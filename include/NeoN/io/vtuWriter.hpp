@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::io
+{
+
+/* @class VtuWriter
+ * @brief Writes a selected set of volume fields to VTK XML unstructured grid files.
+ *
+ * Every call of write() creates the file <name>_<index>.vtu in the output directory and adds
+ * it to the collection <name>.pvd, which lists the output times. The data is stored as binary
+ * appended data, optionally compressed with zlib.
+ *
+ * The UnstructuredMesh does not store the points of its faces, thus the cells are written as
+ * vertices at the cell centres and the fields as cell data. The mesh is encoded only once and
+ * reused for every output time, afterwards only the field data is encoded.
+ *
+ * write() copies the fields into host memory and passes the snapshot to a worker thread, which
+ * encodes, compresses and writes the files. The number of pending snapshots is bounded, write()
+ * only blocks if the worker falls behind by more than queueSize snapshots.
+ *
+ * The writer is configured by a dictionary with the following keys:
+ * - compression: none or zlib (default zlib if NeoN is built with zlib, otherwise none)
+ * - compressionLevel: the zlib compression level from 1 to 9 (default 1)
+ * - queueSize: the maximum number of pending snapshots (default 2)
+ */
+class VtuWriter
+{
+public:
+
+    VtuWriter(
+        const UnstructuredMesh& mesh,
+        const std::filesystem::path& directory,
+        const std::string& name,
+        const Dictionary& dict = {}
+    );
+
+    VtuWriter(const VtuWriter&) = delete;
+
+    VtuWriter& operator=(const VtuWriter&) = delete;
+
+    /* @brief writes all pending snapshots and stops the worker, errors are discarded */
+    ~VtuWriter();
+
+    /* @brief selects a field to be written at every output time */
+    void add(const finiteVolume::cellCentred::VolumeField<scalar>& field);
+
+    /* @brief selects a field to be written at every output time */
+    void add(const finiteVolume::cellCentred::VolumeField<Vec3>& field);
+
+    /* @brief snapshots the selected fields and queues them for writing */
+    void write(scalar time);
+
+    /* @brief blocks until all pending snapshots are written and rethrows errors of the worker */
+    void flush();
+
+    /* @brief the compression of the data blocks, either none or zlib */
+    const std::string& compression() const { return compression_; }
+
+    /* @brief the file of the output with the given index */
+    std::filesystem::path file(size_t index) const;
+
+private:
+
+    using HostVector = std::variant<Vector<scalar>, Vector<Vec3>>;
+
+    struct Snapshot
+    {
+        scalar time = 0;
+        size_t index = 0;
+        std::vector<std::pair<std::string, HostVector>> fields;
+    };
+
+    void run();
+
+    void writeSnapshot(const Snapshot& snapshot);
+
+    void writeCollection();
+
+    void encodeMesh();
+
+    void appendBlock(std::vector<char>& out, const char* data, size_t nBytes) const;
+
+    std::filesystem::path directory_;
+
+    std::string name_;
+
+    std::string compression_;
+
+    int compressionLevel_;
+
+    size_t queueSize_;
+
+    Vector<Vec3> cellCentres_;
+
+    std::vector<std::variant<
+        const finiteVolume::cellCentred::VolumeField<scalar>*,
+        const finiteVolume::cellCentred::VolumeField<Vec3>*>>
+        fields_;
+
+    // the encoded points and cells, which are identical for all output times
+    std::vector<char> encodedMesh_;
+
+    std::vector<size_t> meshOffsets_;
+
+    std::vector<std::pair<scalar, std::filesystem::path>> writtenFiles_;
+
+    size_t nWrites_ = 0;
+
+    std::mutex mutex_;
+
+    std::condition_variable queueChanged_;
+
+    std::deque<Snapshot> queue_;
+
+    bool busy_ = false;
+
+    bool stop_ = false;
+
+    std::exception_ptr error_;
+
+    std::thread worker_;
+};
+
+} // namespace NeoN::io
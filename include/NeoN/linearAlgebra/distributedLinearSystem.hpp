@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <vector>
+
+#include "NeoN/core/primitives/label.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/linearAlgebra/CSRMatrix.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN::la
+{
+
+/* @class DistributedSparsityPattern
+ * @brief global numbering and non-local block of the sparsity pattern of a decomposed mesh
+ *
+ * The rows of every rank are numbered contiguously in rank order, i.e. rank r owns the global rows
+ * [rankOffsets[r], rankOffsets[r + 1]) and a local row is mapped to its global row by adding
+ * rowStart. The non-local block couples the local rows to the cells on the other side of the
+ * processor faces. Its columns are boundary faces, such that the halo values exchanged into the
+ * boundary values of a field are multiplied without reordering, and globalColIdxs maps them to the
+ * global row of the neighbour cell.
+ * A mesh without ProcessorInterface is a single part with an empty non-local block.
+ */
+class DistributedSparsityPattern
+{
+public:
+
+    /* @brief create the pattern of the calling rank, collective over the parts of the mesh */
+    DistributedSparsityPattern(const UnstructuredMesh& mesh);
+
+    /* @brief the first global row of the calling rank */
+    [[nodiscard]] globalIdx rowStart() const { return rowStart_; }
+
+    [[nodiscard]] localIdx nLocalRows() const { return nLocalRows_; }
+
+    [[nodiscard]] globalIdx nGlobalRows() const { return rankOffsets_.back(); }
+
+    /* @brief the first global row of every rank, followed by the number of global rows */
+    [[nodiscard]] const std::vector<globalIdx>& rankOffsets() const { return rankOffsets_; }
+
+    /* @brief number of boundary faces preceding the processor faces */
+    [[nodiscard]] localIdx nPhysicalBoundaryFaces() const { return nPhysicalBoundaryFaces_; }
+
+    /* @brief the number of entries of the non-local block, i.e. the number of processor faces */
+    [[nodiscard]] localIdx nnz() const { return colIdxs_.size(); }
+
+    /*@brief getter for the row offsets of the non-local block */
+    [[nodiscard]] const Vector<localIdx>& rowOffs() const { return rowOffs_; }
+
+    /*@brief getter for the boundary face columns of the non-local block */
+    [[nodiscard]] const Vector<localIdx>& colIdxs() const { return colIdxs_; }
+
+    /*@brief getter for the position of every processor face in the non-local block */
+    [[nodiscard]] const Vector<localIdx>& faceOffset() const { return faceOffset_; }
+
+    /*@brief getter for the global row of the neighbour cell of every boundary face */
+    [[nodiscard]] const Vector<globalIdx>& globalColIdxs() const { return globalColIdxs_; }
+
+    static const DistributedSparsityPattern& readOrCreate(const UnstructuredMesh& mesh);
+
+private:
+
+    localIdx nLocalRows_;
+
+    globalIdx rowStart_;
+
+    localIdx nPhysicalBoundaryFaces_;
+
+    std::vector<globalIdx> rankOffsets_;
+
+    Vector<localIdx> rowOffs_; //! rowOffs map from local row to start index in values
+
+    Vector<localIdx> colIdxs_; //! boundary face of every value
+
+    Vector<localIdx> faceOffset_; //! mapping from processor face to index in values
+
+    Vector<globalIdx> globalColIdxs_; //! global row of the neighbour cell, -1 on physical faces
+};
+
+/* @class DistributedLinearSystem
+ * @brief A linear system of the calling rank split into a local and a non-local block.
+ *
+ * The local block is an ordinary LinearSystem with local columns. Implicit operators couple the
+ * processor faces explicitly, i.e. the boundary coefficients hold the coupling coefficient and the
+ * contribution of the lagged neighbour value to the right hand side. The constructor moves this
+ * coupling into the non-local block, whose columns are multiplied with the halo values.
+ */
+template<typename ValueType, typename IndexType>
+class DistributedLinearSystem
+{
+public:
+
+    DistributedLinearSystem(
+        const UnstructuredMesh& mesh, const LinearSystem<ValueType, IndexType>& localSystem
+    )
+        : mesh_(mesh), sparsityPattern_(DistributedSparsityPattern::readOrCreate(mesh)),
+          localSystem_(localSystem),
+          nonLocalMatrix_(
+              Vector<ValueType>(mesh.exec(), sparsityPattern_.nnz(), zero<ValueType>()),
+              sparsityPattern_.colIdxs(),
+              sparsityPattern_.rowOffs()
+          )
+    {
+        NF_ASSERT(
+            localSystem_.auxiliaryCoefficients().contains("boundaryCoefficients"),
+            "The local system has no boundary coefficients."
+        );
+        const auto& bcCoeffs =
+            localSystem_.auxiliaryCoefficients()
+                .template get<BoundaryCoefficients<ValueType, IndexType>>("boundaryCoefficients");
+
+        const auto nPhysical = sparsityPattern_.nPhysicalBoundaryFaces();
+        const auto [faceCells, faceOffset, coupling, laggedRhs] = views(
+            mesh.boundaryMesh().faceCells(),
+            sparsityPattern_.faceOffset(),
+            bcCoeffs.matrixValues,
+            bcCoeffs.rhsValues
+        );
+        auto nonLocalValues = nonLocalMatrix_.values().view();
+        auto rhs = localSystem_.rhs().view();
+
+        parallelFor(
+            mesh.exec(),
+            {0, faceOffset.size()},
+            KOKKOS_LAMBDA(const localIdx i) {
+                auto bfacei = nPhysical + i;
+                nonLocalValues[faceOffset[i]] = coupling[bfacei];
+                Kokkos::atomic_add(&rhs[faceCells[bfacei]], laggedRhs[bfacei]);
+            },
+            "DistributedLinearSystem::assembleNonLocal"
+        );
+    }
+
+    [[nodiscard]] LinearSystem<ValueType, IndexType>& localSystem() { return localSystem_; }
+
+    [[nodiscard]] const LinearSystem<ValueType, IndexType>& localSystem() const
+    {
+        return localSystem_;
+    }
+
+    [[nodiscard]] CSRMatrix<ValueType, IndexType>& nonLocalMatrix() { return nonLocalMatrix_; }
+
+    [[nodiscard]] const CSRMatrix<ValueType, IndexType>& nonLocalMatrix() const
+    {
+        return nonLocalMatrix_;
+    }
+
+    [[nodiscard]] const DistributedSparsityPattern& sparsityPattern() const
+    {
+        return sparsityPattern_;
+    }
+
+    [[nodiscard]] const UnstructuredMesh& mesh() const { return mesh_; }
+
+    const Executor& exec() const { return localSystem_.exec(); }
+
+private:
+
+    const UnstructuredMesh& mesh_;
+
+    const DistributedSparsityPattern& sparsityPattern_;
+
+    LinearSystem<ValueType, IndexType> localSystem_;
+
+    CSRMatrix<ValueType, IndexType> nonLocalMatrix_;
+};
+
+/* @brief computes y = Ax of a distributed system
+ *
+ * The halo exchange of x is overlapped with the product of the local block.
+ *
+ * @param[in] ls the distributed linear system
+ * @param[in] x the local part of the vector
+ * @param[out] y the local part of the result
+ */
+void spmv(
+    const DistributedLinearSystem<scalar, localIdx>& ls, const Vector<scalar>& x, Vector<scalar>& y
+);
+
+/* @brief computes the residual vector Ax-b of a distributed system
+ *
+ * @param[in] ls the distributed linear system
+ * @param[in] x the local part of the vector
+ * @param[out] res the local part of the residual
+ */
+void computeResidual(
+    const DistributedLinearSystem<scalar, localIdx>& ls,
+    const Vector<scalar>& x,
+    Vector<scalar>& res
+);
+
+} // namespace NeoN::la
@@ -17,6 +17,7 @@
 #include "NeoN/core/executor/executor.hpp"
 #include "NeoN/linearAlgebra/solver.hpp"
 #include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/linearAlgebra/distributedLinearSystem.hpp"
 #include "NeoN/linearAlgebra/utilities.hpp"
 
 
@@ -53,6 +54,16 @@ public:
 
     virtual SolverStats solve(const LinearSystem<Vec3, localIdx>& sys, Vector<Vec3>& x) const final;
 
+    /* @brief solves the system with a distributed Ginkgo matrix if Ginkgo is built with MPI
+     * support, otherwise only a single part is supported and the system is solved locally
+     */
+    virtual SolverStats
+    solve(const DistributedLinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const final;
+
+    /* @brief regenerates the solver factory with an additional absolute residual norm criterion
+     */
+    virtual void setAbsoluteTolerance(scalar tolerance) final;
+
     // TODO why use a smart pointer here?
     virtual std::unique_ptr<SolverFactory> clone() const final
     {
@@ -65,6 +76,8 @@ private:
     std::shared_ptr<const gko::Executor> gkoExec_;
     gko::config::pnode config_;
     std::shared_ptr<const gko::LinOpFactory> factory_;
+
+    scalar absoluteTolerance_ = 0.0;
 };
 
 
@@ -88,10 +88,22 @@ public:
         return LinearSystem(matrix_.copyToHost(), rhs_.copyToHost());
     }
 
+    /* @brief zeroes the matrix, the rhs and the boundary coefficients if present, since the
+     * operators accumulate into all of them
+     */
     void reset()
     {
         fill(matrix_.values(), zero<ValueType>());
         fill(rhs_, zero<ValueType>());
+        if (auxiliaryCoefficients_.contains("boundaryCoefficients"))
+        {
+            auto& bcCoeffs =
+                auxiliaryCoefficients_.template get<BoundaryCoefficients<ValueType, IndexType>>(
+                    "boundaryCoefficients"
+                );
+            fill(bcCoeffs.matrixValues, zero<ValueType>());
+            fill(bcCoeffs.rhsValues, zero<ValueType>());
+        }
     }
 
     [[nodiscard]] LinearSystemView<ValueType, IndexType> view() && = delete;
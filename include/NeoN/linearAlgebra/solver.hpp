@@ -7,6 +7,7 @@
 #include "NeoN/core/input.hpp"
 #include "NeoN/core/runtimeSelectionFactory.hpp"
 #include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/linearAlgebra/distributedLinearSystem.hpp"
 
 namespace NeoN::la
 {
@@ -47,6 +48,22 @@ public:
 
     virtual SolverStats solve(const LinearSystem<Vec3, localIdx>&, Vector<Vec3>&) const = 0;
 
+    /* @brief solves a system assembled across the parts of a decomposed mesh
+     * Backends without distributed support exit with an error.
+     */
+    virtual SolverStats
+    solve(const DistributedLinearSystem<scalar, localIdx>&, Vector<scalar>&) const
+    {
+        NF_ERROR_EXIT("The selected solver does not support distributed linear systems.");
+        return {};
+    }
+
+    /* @brief Adds a stopping criterion on the absolute residual norm to the configured criteria,
+     * e.g. the tolerance requested by an outer nonlinear solver.
+     * Backends without support ignore the tolerance, thus callers have to check the residual.
+     */
+    virtual void setAbsoluteTolerance(scalar) {}
+
     // Pure virtual function for cloning
     virtual std::unique_ptr<SolverFactory> clone() const = 0;
 
@@ -82,6 +99,17 @@ public:
         return solverInstance_->solve(ls, field);
     }
 
+    SolverStats
+    solve(const DistributedLinearSystem<scalar, localIdx>& ls, Vector<scalar>& field) const
+    {
+        return solverInstance_->solve(ls, field);
+    }
+
+    void setAbsoluteTolerance(scalar tolerance)
+    {
+        solverInstance_->setAbsoluteTolerance(tolerance);
+    }
+
 private:
 
     const Executor exec_;
@@ -0,0 +1,201 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/core/array.hpp"
+#include "NeoN/core/primitives/label.hpp"
+#include "NeoN/core/primitives/scalar.hpp"
+#include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/core/view.hpp"
+
+namespace NeoN
+{
+
+/* @brief An axis-aligned bounding box.
+ *
+ * The default constructed box is empty and operator+= computes the union of two boxes, thus the
+ * type can be used as value of a reduction kernel.
+ */
+struct BoundingBox
+{
+    Vec3 min = Vec3(
+        std::numeric_limits<scalar>::max(),
+        std::numeric_limits<scalar>::max(),
+        std::numeric_limits<scalar>::max()
+    );
+
+    Vec3 max = Vec3(
+        std::numeric_limits<scalar>::lowest(),
+        std::numeric_limits<scalar>::lowest(),
+        std::numeric_limits<scalar>::lowest()
+    );
+
+    KOKKOS_INLINE_FUNCTION
+    BoundingBox& operator+=(const BoundingBox& other)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            min[i] = other.min[i] < min[i] ? other.min[i] : min[i];
+            max[i] = other.max[i] > max[i] ? other.max[i] : max[i];
+        }
+        return *this;
+    }
+
+    /* @brief extends the box by a point */
+    KOKKOS_INLINE_FUNCTION
+    void add(const Vec3& point, const Vec3& extent = Vec3(0.0, 0.0, 0.0))
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            min[i] = point[i] - extent[i] < min[i] ? point[i] - extent[i] : min[i];
+            max[i] = point[i] + extent[i] > max[i] ? point[i] + extent[i] : max[i];
+        }
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    bool contains(const Vec3& point) const
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            if (point[i] < min[i] || point[i] > max[i]) return false;
+        }
+        return true;
+    }
+
+    /* @brief the squared distance of the point to the box, zero for points inside the box */
+    KOKKOS_INLINE_FUNCTION
+    scalar distanceSquared(const Vec3& point) const
+    {
+        scalar distance = 0.0;
+        for (int i = 0; i < 3; i++)
+        {
+            const scalar below = min[i] - point[i];
+            const scalar above = point[i] - max[i];
+            const scalar delta = below > 0.0 ? below : (above > 0.0 ? above : 0.0);
+            distance += delta * delta;
+        }
+        return distance;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    Vec3 centre() const { return 0.5 * (min + max); }
+};
+
+/* @brief A view of a BoundingVolumeHierarchy that can be traversed in kernels. */
+struct BoundingVolumeHierarchyView
+{
+    // the size of the traversal stack, the number of leaves is a localIdx, thus the tree has at
+    // most 32 levels
+    static constexpr int stackSize = 64;
+
+    View<const BoundingBox> nodes;
+
+    View<const localIdx> primitives;
+
+    localIdx nLeaves;
+
+    localIdx nPrimitives;
+
+    /* @brief the first position of the leaf in the primitives */
+    KOKKOS_INLINE_FUNCTION
+    localIdx leafBegin(localIdx leaf) const
+    {
+        return static_cast<localIdx>(std::int64_t(leaf) * nPrimitives / nLeaves);
+    }
+
+    /* @brief Visits the primitives of all leaves whose boxes are accepted.
+     *
+     * The boxes are tested once a node is reached, thus the predicate can tighten its criterion
+     * while primitives are visited. The child closer to the point is visited first. The traversal
+     * stops once the visitor returns false.
+     * @param accept A predicate taking a BoundingBox.
+     * @param visit A function taking the index of a primitive and returning whether to continue.
+     */
+    template<typename Accept, typename Visit>
+    KOKKOS_INLINE_FUNCTION void traverse(const Vec3& point, Accept accept, Visit visit) const
+    {
+        if (nPrimitives == 0) return;
+        localIdx stack[stackSize];
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0)
+        {
+            const localIdx node = stack[--top];
+            if (!accept(nodes[node])) continue;
+
+            const localIdx leaf = node - (nLeaves - 1);
+            if (leaf >= 0)
+            {
+                for (localIdx i = leafBegin(leaf); i < leafBegin(leaf + 1); i++)
+                {
+                    if (!visit(primitives[i])) return;
+                }
+                continue;
+            }
+
+            const localIdx left = 2 * node + 1;
+            const localIdx right = 2 * node + 2;
+            const bool leftFirst =
+                nodes[left].distanceSquared(point) <= nodes[right].distanceSquared(point);
+            stack[top++] = leftFirst ? right : left;
+            stack[top++] = leftFirst ? left : right;
+        }
+    }
+};
+
+/* @class BoundingVolumeHierarchy
+ * @brief A bounding volume hierarchy over a set of boxes, e.g. the cells or faces of a mesh.
+ *
+ * The primitives are sorted along a Morton curve through the centres of their boxes and split
+ * into a power of two number of leaves with at most leafSize primitives each. The leaves form a
+ * complete binary tree, which is stored implicitly, i.e. the children of node i are 2i + 1 and
+ * 2i + 2. All steps of the construction, i.e. the Morton codes, the sort and the bottom-up
+ * computation of the node boxes, are performed on the executor of the boxes.
+ */
+class BoundingVolumeHierarchy
+{
+public:
+
+    // the maximum number of primitives per leaf
+    static constexpr localIdx leafSize = 4;
+
+    BoundingVolumeHierarchy(const Array<BoundingBox>& boxes);
+
+    const Executor& exec() const { return nodes_.exec(); }
+
+    /* @brief the number of primitives, i.e. boxes */
+    localIdx size() const { return nPrimitives_; }
+
+    localIdx nLeaves() const { return nLeaves_; }
+
+    /* @brief the box of every node */
+    const Array<BoundingBox>& nodes() const { return nodes_; }
+
+    /* @brief the primitives sorted by leaves */
+    const Vector<localIdx>& primitives() const { return primitives_; }
+
+    BoundingVolumeHierarchyView view() const
+    {
+        return {nodes_.view(), primitives_.view(), nLeaves_, nPrimitives_};
+    }
+
+private:
+
+    localIdx nPrimitives_;
+
+    localIdx nLeaves_;
+
+    Array<BoundingBox> nodes_;
+
+    Vector<localIdx> primitives_;
+};
+
+} // namespace NeoN
@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include <deque>
 #include <vector>
 #include <unordered_map>
 #include <memory>
 
 
 #include "NeoN/fields/field.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/vector/vectorTypeDefs.hpp"
 
 #ifdef NF_WITH_MPI_SUPPORT
 #include "NeoN/core/mpi/fullDuplexCommBuffer.hpp"
@@ -20,7 +23,6 @@
 namespace NeoN
 {
 
-#ifdef NF_WITH_MPI_SUPPORT
 /**
  * @brief Represents a pair of indices for rank local and global indexing.
  */
@@ -39,12 +41,17 @@ using RankCommMap = std::vector<NodeCommMap>;
  */
 using CommMap = std::vector<RankCommMap>;
 
+#ifdef NF_WITH_MPI_SUPPORT
 /**
  * @class Communicator
  * @brief Manages communication between ranks in a parallel environment.
  * The Communicator class provides functionality to manage communication of field data exchange
  * between MPI ranks for unstructured meshes. The class maintains an MPI environment and maps for
  * rank-specific send and receive operations.
+ *
+ * The maps are stored flattened in rank order on the executor, matching the layout of the
+ * communication buffers, so that packing and unpacking is a single gather and scatter kernel per
+ * exchange into buffers resident on the executor.
  */
 class Communicator
 {
@@ -70,17 +77,24 @@ public:
      * @param rankReceiveMap The rank receive map.
      */
     Communicator(mpi::MPIEnvironment mpiEnviron, CommMap rankSendMap, CommMap rankReceiveMap)
-        : mpiEnviron_(mpiEnviron), sendMap_(rankSendMap), receiveMap_(rankReceiveMap)
-    {
-        NF_DEBUG_ASSERT(
-            mpiEnviron_.sizeRank() == rankSendMap.size(),
-            "Size of rankSendSize does not match MPI size."
-        );
-        NF_DEBUG_ASSERT(
-            mpiEnviron_.sizeRank() == rankReceiveMap.size(),
-            "Size of rankReceiveSize does not match MPI size."
-        );
-    };
+        : Communicator(mpiEnviron, SerialExecutor {}, rankSendMap, rankReceiveMap)
+    {}
+
+    /**
+     * @brief Constructor that initializes the Communicator for fields on the given executor.
+     * @param mpiEnviron The MPI environment.
+     * @param exec The executor of the communicated fields.
+     * @param rankSendMap The rank send map.
+     * @param rankReceiveMap The rank receive map.
+     * @param space The memory handed to the MPI library for a GPU executor.
+     */
+    Communicator(
+        mpi::MPIEnvironment mpiEnviron,
+        const Executor& exec,
+        const CommMap& rankSendMap,
+        const CommMap& rankReceiveMap,
+        mpi::BufferSpace space = mpi::BufferSpace::Host
+    );
 
     /**
      * @brief Starts the non-blocking communication for a given field and communication name.
@@ -89,26 +103,31 @@ public:
      * @param commName The communication name, typically a file and line number.
      */
     template<typename valueType>
-    void startComm(Vector<valueType>& field, const std::string& commName)
+    void startComm(const Vector<valueType>& field, const std::string& commName)
     {
         NF_DEBUG_ASSERT(
             CommBuffer_.find(commName) == CommBuffer_.end() || (!CommBuffer_[commName]),
             "There is already an ongoing communication for key " << commName << "."
         );
 
-        CommBuffer_[commName] = findDuplexBuffer();
+        CommBuffer_[commName] = findDuplexBuffer(commName);
         if (!CommBuffer_[commName])
         {
             CommBuffer_[commName] = createNewDuplexBuffer();
         }
+        lastBuffer_[commName] = CommBuffer_[commName];
 
+        NF_ASSERT(field.exec() == exec_, "Field and communicator executor mismatch.");
         CommBuffer_[commName]->initComm<valueType>(commName);
-        for (size_t rank = 0; rank < mpiEnviron_.sizeRank(); ++rank)
-        {
-            auto rankBuffer = CommBuffer_[commName]->getSend<valueType>(rank);
-            for (size_t data = 0; data < sendMap_[rank].size(); ++data)
-                rankBuffer[data] = field(static_cast<size_t>(sendMap_[rank][data].local_idx));
-        }
+        auto sendBuffer = CommBuffer_[commName]->getSend<valueType>();
+        const auto [src, sendIdx] = views(field, sendIdx_);
+        parallelFor(
+            exec_,
+            {0, sendIdx.size()},
+            KOKKOS_LAMBDA(const localIdx i) { sendBuffer[i] = src[sendIdx[i]]; },
+            "Communicator::startComm"
+        );
+        fence(exec_);
         CommBuffer_[commName]->startComm();
     }
 
@@ -133,32 +152,45 @@ public:
             "No communication associated with key: " << commName
         );
 
+        NF_ASSERT(field.exec() == exec_, "Field and communicator executor mismatch.");
         CommBuffer_[commName]->waitComplete();
-        for (size_t rank = 0; rank < mpiEnviron_.sizeRank(); ++rank)
-        {
-            auto rankBuffer = CommBuffer_[commName]->getReceive<valueType>(rank);
-            for (size_t data = 0; data < receiveMap_[rank].size(); ++data)
-                field(static_cast<size_t>(receiveMap_[rank][data].local_idx)) = rankBuffer[data];
-        }
+        auto receiveBuffer = CommBuffer_[commName]->getReceive<valueType>();
+        auto [dst, receiveIdx] = views(field, receiveIdx_);
+        parallelFor(
+            exec_,
+            {0, receiveIdx.size()},
+            KOKKOS_LAMBDA(const localIdx i) { dst[receiveIdx[i]] = receiveBuffer[i]; },
+            "Communicator::finaliseComm"
+        );
+        // the buffer may be reused by the next exchange once released
+        fence(exec_);
         CommBuffer_[commName]->finaliseComm();
         CommBuffer_[commName] = nullptr;
     }
 
 private:
 
-    mpi::MPIEnvironment mpiEnviron_; /**< The MPI environment. */
-    CommMap sendMap_;                /**< The rank send map. */
-    CommMap receiveMap_;             /**< The rank receive map. */
-    std::vector<bufferType> buffers; /**< Communication buffers. */
+    mpi::MPIEnvironment mpiEnviron_;                  /**< The MPI environment. */
+    Executor exec_ {SerialExecutor {}};               /**< The executor of the fields. */
+    mpi::BufferSpace space_ {mpi::BufferSpace::Host}; /**< The memory handed to MPI. */
+    std::vector<std::size_t> rankSendSize_;           /**< The number of sends per rank. */
+    std::vector<std::size_t> rankReceiveSize_;        /**< The number of receives per rank. */
+    labelVector sendIdx_ {SerialExecutor {}, 0};      /**< The flattened rank send map. */
+    labelVector receiveIdx_ {SerialExecutor {}, 0};   /**< The flattened rank receive map. */
+    std::deque<bufferType> buffers;                   /**< Communication buffers. */
     std::unordered_map<std::string, bufferType*>
         CommBuffer_; /**< The communication key to buffer map, nullptr indicates no assigned buffer.
                       */
+    std::unordered_map<std::string, bufferType*>
+        lastBuffer_; /**< The communication key to the buffer used by the previous communication. */
 
     /**
-     * @brief Finds an uninitialized communication buffer.
+     * @brief Finds an uninitialized communication buffer, preferring the buffer previously used for
+     * the communication name, as its persistent requests can be restarted.
+     * @param commName The communication name.
      * @return An pointer to a free communication buffer, or nullptr if no free buffer is found.
      */
-    bufferType* findDuplexBuffer();
+    bufferType* findDuplexBuffer(const std::string& commName);
 
     /**
      * @brief Creates a new communication buffer with the given name.
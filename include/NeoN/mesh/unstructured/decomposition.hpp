@@ -0,0 +1,234 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/runtimeSelectionFactory.hpp"
+#include "NeoN/mesh/unstructured/communicator.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN
+{
+
+/* @brief Load and edge-cut statistics of a cell to part assignment.
+ *
+ * The edge cut counts internal faces whose owner and neighbour cells are assigned to different
+ * parts, i.e. faces that become processor boundary faces after decomposition. Imbalances are
+ * given as the ratio of the maximum to the mean value over all parts, 1.0 is perfectly balanced.
+ */
+struct PartitionStats
+{
+    label nParts;
+
+    std::vector<localIdx> loads; //!< number of cells per part
+
+    std::vector<localIdx> cuts; //!< number of processor faces per part
+
+    localIdx edgeCut; //!< total number of cut internal faces
+
+    scalar loadImbalance; //!< max(loads) / mean(loads)
+
+    scalar edgeCutImbalance; //!< max(cuts) / mean(cuts), 1.0 if no face is cut
+};
+
+/* @brief Computes load and edge-cut statistics for a given cell to part assignment.
+ * @param mesh The undecomposed mesh.
+ * @param cellToPart The part of every cell, values in [0, nParts).
+ * @param nParts The number of parts.
+ */
+PartitionStats computePartitionStats(
+    const UnstructuredMesh& mesh, const std::vector<label>& cellToPart, label nParts
+);
+
+/* @class Partitioner
+ * @brief Base class of the dependency free mesh partitioners.
+ *
+ * A partitioner assigns every cell of a (serial) mesh to one of nParts parts. The partitioners
+ * work on host copies of the mesh data, since decomposition is a pre-processing step.
+ * The concrete partitioner is selected via the "method" key of the decomposition dictionary.
+ */
+class Partitioner : public RuntimeSelectionFactory<Partitioner, Parameters<const Dictionary&>>
+{
+public:
+
+    static std::unique_ptr<Partitioner> create(const Dictionary& dict)
+    {
+        auto key = dict.get<std::string>("method");
+        Partitioner::keyExistsOrError(key);
+        return Partitioner::table().at(key)(dict);
+    }
+
+    static std::string name() { return "Partitioner"; }
+
+    Partitioner(const Dictionary&) {};
+
+    virtual ~Partitioner() = default;
+
+    /* @brief assign every cell of the mesh to a part
+     * @return vector of size mesh.nCells() with the part of every cell
+     */
+    virtual std::vector<label> partition(const UnstructuredMesh& mesh, label nParts) const = 0;
+
+    virtual std::unique_ptr<Partitioner> clone() const = 0;
+};
+
+/* @class RCBPartitioner
+ * @brief Recursive coordinate bisection of the cell centres.
+ *
+ * The cell set is recursively split normal to the longest extent of its bounding box, such that
+ * the number of cells of both halves is proportional to the number of parts assigned to them.
+ * Hence, nParts does not need to be a power of two.
+ */
+class RCBPartitioner : public Partitioner::Register<RCBPartitioner>
+{
+    using Base = Partitioner::Register<RCBPartitioner>;
+
+public:
+
+    RCBPartitioner(const Dictionary& dict) : Base(dict) {};
+
+    static std::string name() { return "RCB"; }
+
+    static std::string doc() { return "Recursive coordinate bisection of the cell centres"; }
+
+    static std::string schema() { return "none"; }
+
+    std::vector<label> partition(const UnstructuredMesh& mesh, label nParts) const override;
+
+    std::unique_ptr<Partitioner> clone() const override
+    {
+        return std::make_unique<RCBPartitioner>(*this);
+    }
+};
+
+/* @class InertialPartitioner
+ * @brief Recursive inertial bisection of the cell centres.
+ *
+ * Like RCB, but the cell set is split normal to its principal axis of inertia, which is
+ * independent of the orientation of the mesh relative to the coordinate axes.
+ */
+class InertialPartitioner : public Partitioner::Register<InertialPartitioner>
+{
+    using Base = Partitioner::Register<InertialPartitioner>;
+
+public:
+
+    InertialPartitioner(const Dictionary& dict) : Base(dict) {};
+
+    static std::string name() { return "inertial"; }
+
+    static std::string doc() { return "Recursive inertial bisection of the cell centres"; }
+
+    static std::string schema() { return "none"; }
+
+    std::vector<label> partition(const UnstructuredMesh& mesh, label nParts) const override;
+
+    std::unique_ptr<Partitioner> clone() const override
+    {
+        return std::make_unique<InertialPartitioner>(*this);
+    }
+};
+
+/* @class MultilevelPartitioner
+ * @brief Multilevel k-way partitioner of the cell graph given by the internal faces.
+ *
+ * The graph is coarsened by heavy-edge matching, the coarsest graph is partitioned by
+ * recursive graph growing bisection, and the partition is projected back while a greedy
+ * boundary refinement reduces the edge cut under the load constraint.
+ *
+ * Optional dictionary entries:
+ *  - imbalanceTolerance (scalar, default 0.03): allowed relative excess of the largest part
+ *  - nRefinementSweeps (label, default 4): refinement sweeps per level
+ */
+class MultilevelPartitioner : public Partitioner::Register<MultilevelPartitioner>
+{
+    using Base = Partitioner::Register<MultilevelPartitioner>;
+
+public:
+
+    MultilevelPartitioner(const Dictionary& dict);
+
+    static std::string name() { return "multilevel"; }
+
+    static std::string doc() { return "Multilevel k-way partitioning of the face graph"; }
+
+    static std::string schema() { return "none"; }
+
+    std::vector<label> partition(const UnstructuredMesh& mesh, label nParts) const override;
+
+    std::unique_ptr<Partitioner> clone() const override
+    {
+        return std::make_unique<MultilevelPartitioner>(*this);
+    }
+
+private:
+
+    scalar imbalanceTolerance_;
+
+    label nRefinementSweeps_;
+};
+
+/* @brief The mesh of a single part and its relation to the undecomposed mesh.
+ *
+ * The boundary patches of the part mesh are the patches of the undecomposed mesh, in the same
+ * order so that patch indices of boundary condition dictionaries remain valid, followed by one
+ * processor patch per neighbouring part in ascending order of the neighbour part.
+ * The faces of the processor patch between two parts are ordered by their index in the
+ * undecomposed mesh on both sides, thus the i-th face on one side corresponds to the i-th face on
+ * the other side. The delta vector of a processor face is the distance from the local to the
+ * remote cell centre, weights and delta coefficients are those of the undecomposed internal face.
+ *
+ * The send and receive maps follow the Communicator convention: sendMap[rank] holds the local
+ * cells next to the processor faces shared with rank, receiveMap[rank] holds the corresponding
+ * boundary face indices, i.e. the indices into the boundary values of a field.
+ *
+ * NOTE: since the mesh does not store face to point connectivity, points are not decomposed and
+ * the part meshes carry an empty points vector.
+ */
+struct PartMesh
+{
+    label part;
+
+    UnstructuredMesh mesh;
+
+    std::vector<localIdx> cellMap; //!< local cell -> cell of the undecomposed mesh
+
+    std::vector<localIdx> faceMap; //!< local face -> face of the undecomposed mesh
+
+    localIdx nPhysicalBoundaries; //!< number of non processor patches
+
+    std::vector<label> neighbourParts; //!< neighbour part of every processor patch
+
+    CommMap sendMap;
+
+    CommMap receiveMap;
+};
+
+/* @brief Splits a mesh into per part meshes with processor patches and communication maps.
+ * @param mesh The undecomposed mesh.
+ * @param cellToPart The part of every cell, values in [0, nParts).
+ * @param nParts The number of parts.
+ * @param exec The executor of the created part meshes.
+ * @return A vector of size nParts with the mesh of every part.
+ */
+std::vector<PartMesh> decomposeMesh(
+    const UnstructuredMesh& mesh,
+    const std::vector<label>& cellToPart,
+    label nParts,
+    const Executor& exec
+);
+
+/* @brief Partitions and decomposes a mesh in one go.
+ *
+ * Reads the "method" and "nParts" entries of dict and creates the part meshes on the executor
+ * of the given mesh.
+ */
+std::vector<PartMesh> decomposeMesh(const UnstructuredMesh& mesh, const Dictionary& dict);
+
+} // namespace NeoN
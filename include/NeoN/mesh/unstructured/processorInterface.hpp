@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <any>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/core/vector/vectorTypeDefs.hpp"
+#include "NeoN/mesh/unstructured/communicator.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+namespace NeoN
+{
+
+/* @class ProcessorInterface
+ * @brief The processor patches of a decomposed mesh and the exchange of cell values across them.
+ *
+ * Processor patches follow the physical patches, see PartMesh, thus the boundary faces
+ * [0, nPhysicalBoundaryFaces) are physical and the remaining boundary faces are processor faces.
+ * After an exchange the boundary value of a processor face holds the value of the cell on the
+ * other side of the face. The send and receive maps follow the Communicator convention.
+ *
+ * The exchange is split into a start and a finish call, so that callers can compute the internal
+ * faces while the communication is in flight. Without MPI support only the coupling of a rank
+ * with itself, i.e. maps of size one, is possible, which is handled by a local copy.
+ *
+ * Operators that only read the neighbour values, e.g. interpolation schemes, receive them into a
+ * boundary sized buffer owned by the interface instead of copying the boundary values of the
+ * field, see the finishExchange overload returning the buffer.
+ *
+ * The interface is stored in the stencil data base of the mesh and has to be attached before any
+ * geometry scheme of the mesh is created. Meshes without interface are not decomposed.
+ */
+class ProcessorInterface
+{
+public:
+
+    /* @brief Creates the interface of the calling rank, using MPI_COMM_WORLD if MPI is enabled.
+     * @param mesh The mesh of the calling rank.
+     * @param nPhysicalBoundaries The number of non processor patches.
+     * @param sendMap The local cells to send to every rank.
+     * @param receiveMap The boundary faces to receive from every rank.
+     */
+    ProcessorInterface(
+        const UnstructuredMesh& mesh,
+        localIdx nPhysicalBoundaries,
+        const CommMap& sendMap,
+        const CommMap& receiveMap
+    );
+
+#ifdef NF_WITH_MPI_SUPPORT
+    /* @brief Creates the interface of the calling rank in the given MPI environment.
+     * @param space Whether a GPU-aware MPI library is handed the device buffers directly.
+     */
+    ProcessorInterface(
+        mpi::MPIEnvironment mpiEnviron,
+        const UnstructuredMesh& mesh,
+        localIdx nPhysicalBoundaries,
+        const CommMap& sendMap,
+        const CommMap& receiveMap,
+        mpi::BufferSpace space = mpi::BufferSpace::Host
+    );
+#endif
+
+    /* @brief the interface attached to the mesh or nullptr if the mesh is not decomposed */
+    static std::shared_ptr<ProcessorInterface> read(const UnstructuredMesh& mesh);
+
+    /* @brief attaches the interface to the mesh */
+    static void
+    attach(const UnstructuredMesh& mesh, std::shared_ptr<ProcessorInterface> procInterface);
+
+    localIdx nPhysicalBoundaryFaces() const { return nPhysicalBoundaryFaces_; }
+
+#ifdef NF_WITH_MPI_SUPPORT
+    /* @brief the MPI environment spanning the parts of the decomposed mesh */
+    const mpi::MPIEnvironment& mpiEnvironment() const { return mpiEnviron_; }
+#endif
+
+    /* @brief Starts the exchange of the cell values next to the processor faces.
+     * @param cellValues The internal vector of a volume field.
+     * @param commName The communication name, typically the calling function.
+     */
+    template<typename ValueType>
+    void startExchange(const Vector<ValueType>& cellValues, const std::string& commName)
+    {
+#ifdef NF_WITH_MPI_SUPPORT
+        communicator_->startComm(cellValues, commName);
+#else
+        // the local copy is done in finishExchange
+        (void)cellValues;
+        (void)commName;
+#endif
+    }
+
+    /* @brief Waits for the exchange and writes the values into the processor faces.
+     * @param cellValues The internal vector passed to startExchange.
+     * @param boundaryValues The boundary values of the same field.
+     * @param commName The communication name passed to startExchange.
+     */
+    template<typename ValueType>
+    void finishExchange(
+        const Vector<ValueType>& cellValues,
+        Vector<ValueType>& boundaryValues,
+        const std::string& commName
+    )
+    {
+#ifdef NF_WITH_MPI_SUPPORT
+        (void)cellValues;
+        communicator_->finaliseComm(boundaryValues, commName);
+#else
+        (void)commName;
+        const auto [src, sendCells, receiveFaces] = views(cellValues, sendCells_, receiveFaces_);
+        auto dst = boundaryValues.view();
+        parallelFor(
+            boundaryValues.exec(),
+            {0, sendCells.size()},
+            KOKKOS_LAMBDA(const localIdx i) { dst[receiveFaces[i]] = src[sendCells[i]]; },
+            "ProcessorInterface::finishExchange"
+        );
+#endif
+    }
+
+    /* @brief Waits for the exchange and writes the values into the persistent receive buffer.
+     * @param cellValues The internal vector passed to startExchange.
+     * @param commName The communication name passed to startExchange.
+     * @return The boundary sized buffer, only its processor faces are valid. The buffer is
+     * overwritten by the next exchange of the same value type.
+     */
+    template<typename ValueType>
+    const Vector<ValueType>&
+    finishExchange(const Vector<ValueType>& cellValues, const std::string& commName)
+    {
+        auto& buffer = receiveBuffer<ValueType>();
+        finishExchange(cellValues, buffer, commName);
+        return buffer;
+    }
+
+private:
+
+    /* @brief the receive buffer of the value type, which is allocated by the first call */
+    template<typename ValueType>
+    Vector<ValueType>& receiveBuffer()
+    {
+        auto [it, inserted] = receiveBuffers_.try_emplace(std::type_index(typeid(ValueType)));
+        if (inserted)
+        {
+            it->second = Vector<ValueType>(exec_, nBoundaryFaces_, zero<ValueType>());
+        }
+        return std::any_cast<Vector<ValueType>&>(it->second);
+    }
+
+    Executor exec_;
+
+    localIdx nBoundaryFaces_;
+
+    localIdx nPhysicalBoundaryFaces_;
+
+    std::unordered_map<std::type_index, std::any> receiveBuffers_;
+
+#ifdef NF_WITH_MPI_SUPPORT
+    mpi::MPIEnvironment mpiEnviron_;
+
+    std::shared_ptr<Communicator> communicator_;
+#else
+    labelVector sendCells_; //!< local cells coupled to the own rank
+
+    labelVector receiveFaces_; //!< boundary faces coupled to the own rank
+#endif
+};
+
+/* @brief the number of non processor boundary faces, all boundary faces if not decomposed */
+localIdx nPhysicalBoundaryFaces(const UnstructuredMesh& mesh);
+
+} // namespace NeoN
@@ -288,5 +288,14 @@ UnstructuredMesh createSingleCellMesh(const Executor exec);
  */
 UnstructuredMesh create1DUniformMesh(const Executor exec, const localIdx nCells);
 
+/** @brief A factory function for a 3D mesh of the unit cube with nx * ny * nz hexahedra
+ *
+ * The cell with the indices i, j, k has the index i + nx * (j + ny * k). The internal faces are
+ * ordered by owner and neighbour. The boundary faces form six patches in the order x = 0, x = 1,
+ * y = 0, y = 1, z = 0 and z = 1.
+ */
+UnstructuredMesh
+create3DUniformMesh(const Executor exec, const localIdx nx, const localIdx ny, const localIdx nz);
+
 
 } // namespace NeoN
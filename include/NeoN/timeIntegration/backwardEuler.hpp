@@ -41,9 +41,16 @@ public:
 
     static std::string schema() { return "none"; }
 
-    void solve(dsl::Expression<ValueType>&, SolutionVectorType&, scalar, scalar) override
+    void solve(
+        dsl::Expression<ValueType>& eqn, SolutionVectorType& solutionVector, scalar t, scalar dt
+    ) override
     {
-        NF_ERROR_EXIT("Not implemented, use NeoN::dsl::detail::iterative_solve_impl");
+        // the current values move to the old time field without a copy, the field is reset to
+        // them, since the explicit operators and the linear solver start from the field
+        fvcc::advanceTime(solutionVector);
+        solutionVector.internalVector() = fvcc::oldTime(solutionVector).internalVector();
+        dsl::detail::iterativeSolveImpl(eqn, solutionVector, t, dt, this->solutionDict_, {});
+        solutionVector.correctBoundaryConditions();
     };
 
     std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override
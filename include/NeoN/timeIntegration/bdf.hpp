@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#if NN_WITH_SUNDIALS
+
+#include <memory>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/fields/field.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
+#include "NeoN/timeIntegration/sundials.hpp"
+#include "NeoN/timeIntegration/sundialsLinearSolver.hpp"
+
+
+namespace NeoN::timeIntegration
+{
+
+/**
+ * @class BDF
+ * @brief Integrates in time, using CVODE of Sundials, a PDE expression with variable order and
+ * variable step size backward differentiation formulas.
+ * @tparam SolutionVectorType The Solution field type, should be a volume field.
+ *
+ * @details
+ * Every solve integrates from t to t + dt, where CVODE selects its internal step sizes and orders
+ * from the tolerances. CVODE does not split the right hand side, thus f contains the implicit and
+ * explicit spatial operators, while the Jacobian of the Newton iteration contains only the
+ * implicit operators assembled by the expression. The Newton systems are solved by the la::Solver
+ * configured by the solution dictionary, see sundialsLinearSolver.hpp.
+ *
+ * The following keys are read from the scheme dictionary:
+ * - maxOrder: the maximum order of the BDF methods (default 5)
+ * - relTol: the relative tolerance (default 1e-6)
+ * - absTol: the absolute tolerance (default 1e-10)
+ *
+ * @warning The stages are evaluated in the storage of the solution field, thus the operators need
+ * to be created from the solution field, see RungeKutta.
+ */
+template<typename SolutionVectorType>
+class BDF :
+    public TimeIntegratorBase<SolutionVectorType>::template Register<BDF<SolutionVectorType>>
+{
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+    using Base = TimeIntegratorBase<SolutionVectorType>::template Register<BDF<SolutionVectorType>>;
+
+    BDF(const Dictionary& schemeDict, const Dictionary& solutionDict)
+        : Base(schemeDict, solutionDict)
+    {}
+
+    /**
+     * @brief Copy constructor.
+     * @note The CVODE memory is not copied, the copy initializes Sundials in its first solve.
+     */
+    BDF(const BDF& other);
+
+    BDF& operator=(const BDF& other) = delete;
+
+    static std::string name() { return "BDF"; }
+
+    static std::string doc() { return "Implicit time integration using CVODE BDF methods."; }
+
+    static std::string schema() { return "none"; }
+
+    /**
+     * @brief Integrates from t to t + dt
+     * @param exp The expression to be solved
+     * @param solutionVector The field containing the solution.
+     * @param t The current time
+     * @param dt The time step size
+     */
+    void solve(
+        dsl::Expression<ValueType>& exp,
+        SolutionVectorType& solutionVector,
+        scalar t,
+        const scalar dt
+    ) override;
+
+    std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override;
+
+private:
+
+    sundials::NVectorPtr solution_ {nullptr}; /**< N_Vector wrapping the solution field. */
+    std::unique_ptr<sundials::RHSData<SolutionVectorType>> rhsData_ {
+        std::make_unique<sundials::RHSData<SolutionVectorType>>()
+    }; /**< The user data of the rhs callback and the linear solver. */
+    std::shared_ptr<SUNContext> context_ {
+        nullptr, sundials::SUN_CONTEXT_DELETER
+    }; /**< The SUNContext for the solve. */
+    sundials::LinearSolverPtr linearSolver_ {nullptr}; /**< The Newton linear solver. */
+    std::unique_ptr<char, decltype(sundials::SUN_CVODE_DELETER)> ODEMemory_ {
+        nullptr, sundials::SUN_CVODE_DELETER
+    }; /**< The 'memory' of the CVODE solver, freed before the linear solver. */
+    std::unique_ptr<NeoN::dsl::Expression<ValueType>> pdeExpr_ {nullptr
+    }; /**< Pointer to the pde system we are integrating in time. */
+
+    /**
+     * @brief Initializes the complete Sundials solver setup.
+     * @param exp The (DSL) expression being integrated in time
+     * @param field The solution field, its old time field holds the initial conditions
+     * @param t The current time
+     */
+    void initCVODESolver(dsl::Expression<ValueType>& exp, SolutionVectorType& field, scalar t);
+};
+
+} // namespace NeoN
+
+#endif
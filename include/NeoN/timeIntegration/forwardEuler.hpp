@@ -6,6 +6,7 @@
 
 #include "NeoN/core/database/fieldCollection.hpp"
 #include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/fields/field.hpp"
 #include "NeoN/timeIntegration/timeIntegration.hpp"
 
@@ -42,10 +43,21 @@ public:
     ) override
     {
         auto source = eqn.explicitOperation(solutionVector.size());
-        SolutionVectorType& oldSolutionVector =
-            NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
 
-        solutionVector.internalVector() = oldSolutionVector.internalVector() - source * dt;
+        // the current values move to the old time field and the field receives the new ones
+        NeoN::finiteVolume::cellCentred::advanceTime(solutionVector);
+        const SolutionVectorType& oldSolutionVector =
+            NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
+        auto [q, qOld, sourceView] =
+            views(solutionVector.internalVector(), oldSolutionVector.internalVector(), source);
+        parallelFor(
+            eqn.exec(),
+            {0, solutionVector.internalVector().size()},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                q[celli] = qOld[celli] - dt * sourceView[celli];
+            },
+            "ForwardEuler::step"
+        );
         solutionVector.correctBoundaryConditions();
 
         fence(eqn.exec());
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#if NN_WITH_SUNDIALS
+
+#include <memory>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/fields/field.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
+#include "NeoN/timeIntegration/sundials.hpp"
+#include "NeoN/timeIntegration/sundialsLinearSolver.hpp"
+
+
+namespace NeoN::timeIntegration
+{
+
+/**
+ * @class ImplicitRungeKutta
+ * @brief Integrates in time, using the ARKStep module of Sundials, a PDE expression with
+ * diagonally implicit (DIRK) or implicit-explicit (IMEX) additive Runge-Kutta methods.
+ * @tparam SolutionVectorType The Solution field type, should be a volume field.
+ *
+ * @details
+ * The expression is split on the operator type: the implicit spatial operators form the stiff
+ * part f_I, the explicit spatial operators the non-stiff part f_E. If the expression has no
+ * explicit operators, the implicit table of the method is used as DIRK method.
+ *
+ * The implicit operators are assembled by the expression into a linear system, which provides
+ * f_I = -(A y - b)/V as well as its Jacobian. The Newton systems are solved by a matrix embedded
+ * SUNLinearSolver wrapping the la::Solver configured by the solution dictionary, see
+ * sundialsLinearSolver.hpp. For linear implicit operators the Newton iteration converges in a
+ * single iteration.
+ *
+ * The method is selected by the Runge-Kutta-Method key:
+ * - SDIRK-2: 2 stage, 2nd order SDIRK (DIRK only)
+ * - ARK-2: 3 stage, 2nd order ARK
+ * - ARK-3: 4 stage, 3rd order ARK of Kennedy and Carpenter
+ * - ARK-4: 6 stage, 4th order ARK of Kennedy and Carpenter
+ * The optional keys relTol (default 1e-6) and absTol (default 1e-10) set the tolerances of the
+ * Newton iteration, the time step size is fixed to the time step size passed to solve.
+ *
+ * @warning The stages are evaluated in the storage of the solution field, thus the operators need
+ * to be created from the solution field, see RungeKutta.
+ */
+template<typename SolutionVectorType>
+class ImplicitRungeKutta :
+    public TimeIntegratorBase<SolutionVectorType>::template Register<
+        ImplicitRungeKutta<SolutionVectorType>>
+{
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+    using Base = TimeIntegratorBase<SolutionVectorType>::template Register<
+        ImplicitRungeKutta<SolutionVectorType>>;
+
+    ImplicitRungeKutta(const Dictionary& schemeDict, const Dictionary& solutionDict)
+        : Base(schemeDict, solutionDict)
+    {}
+
+    /**
+     * @brief Copy constructor.
+     * @note The ODE memory is not copied, the copy initializes Sundials in its first solve.
+     */
+    ImplicitRungeKutta(const ImplicitRungeKutta& other);
+
+    ImplicitRungeKutta& operator=(const ImplicitRungeKutta& other) = delete;
+
+    static std::string name() { return "Implicit-Runge-Kutta"; }
+
+    static std::string doc()
+    {
+        return "Implicit and implicit-explicit time integration using additive Runge-Kutta "
+               "methods.";
+    }
+
+    static std::string schema() { return "none"; }
+
+    /**
+     * @brief Solves one time step, from n to n+1
+     * @param exp The expression to be solved
+     * @param solutionVector The field containing the solution.
+     * @param t The current time
+     * @param dt The time step size
+     */
+    void solve(
+        dsl::Expression<ValueType>& exp,
+        SolutionVectorType& solutionVector,
+        scalar t,
+        const scalar dt
+    ) override;
+
+    std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override;
+
+private:
+
+    sundials::NVectorPtr solution_ {nullptr}; /**< N_Vector wrapping the solution field. */
+    std::unique_ptr<sundials::RHSData<SolutionVectorType>> rhsData_ {
+        std::make_unique<sundials::RHSData<SolutionVectorType>>()
+    }; /**< The user data of the rhs callbacks and the linear solver. */
+    std::shared_ptr<SUNContext> context_ {
+        nullptr, sundials::SUN_CONTEXT_DELETER
+    }; /**< The SUNContext for the solve. */
+    sundials::LinearSolverPtr linearSolver_ {nullptr}; /**< The Newton linear solver. */
+    std::unique_ptr<char, decltype(sundials::SUN_ARK_DELETER)> ODEMemory_ {
+        nullptr, sundials::SUN_ARK_DELETER
+    }; /**< The 'memory' of the ARKStep solver, freed before the linear solver. */
+    std::unique_ptr<NeoN::dsl::Expression<ValueType>> pdeExpr_ {nullptr
+    }; /**< Pointer to the pde system we are integrating in time. */
+
+    /**
+     * @brief Initializes the complete Sundials solver setup.
+     * @param exp The (DSL) expression being integrated in time
+     * @param field The solution field, its old time field holds the initial conditions
+     * @param t The current time
+     */
+    void initSUNARKSolver(dsl::Expression<ValueType>& exp, SolutionVectorType& field, scalar t);
+};
+
+} // namespace NeoN
+
+#endif
@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/fields/field.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
+
+namespace NeoN::timeIntegration
+{
+
+/* @class LowStorageRungeKutta
+ * @brief Explicit 2N-storage Runge-Kutta schemes working directly on the solution field.
+ *
+ * Every stage computes dq = A_s dq + dt f(q) and q = q + B_s dq, where f = -source is evaluated
+ * by the explicit operators of the expression. Besides the solution only the dq and the source
+ * register are stored, both are allocated once and reused. The stage update is a single kernel,
+ * which also resets the source register for the next stage. The solution is advanced in time
+ * after the source of the first stage is evaluated, thus the first stage reads q^n from the old
+ * time field, which receives the storage of the solution without a copy.
+ *
+ * The method is selected by the Runge-Kutta-Method key: Williamson-3 (3 stages, 3rd order) or
+ * Carpenter-Kennedy-4 (5 stages, 4th order).
+ *
+ * NOTE the stages are evaluated in the storage of the solution field, thus the explicit operators
+ * need to be created from the solution field and not from its old time field.
+ */
+template<typename SolutionVectorType>
+class LowStorageRungeKutta :
+    public TimeIntegratorBase<SolutionVectorType>::template Register<
+        LowStorageRungeKutta<SolutionVectorType>>
+{
+
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+    using Base = TimeIntegratorBase<SolutionVectorType>::template Register<
+        LowStorageRungeKutta<SolutionVectorType>>;
+
+    LowStorageRungeKutta(const Dictionary& schemeDict, const Dictionary& solutionDict)
+        : Base(schemeDict, solutionDict)
+    {
+        auto method = schemeDict.get<std::string>("Runge-Kutta-Method");
+        if (method == "Williamson-3")
+        {
+            A_ = {0.0, -5.0 / 9.0, -153.0 / 128.0};
+            B_ = {1.0 / 3.0, 15.0 / 16.0, 8.0 / 15.0};
+        }
+        else if (method == "Carpenter-Kennedy-4")
+        {
+            A_ = {
+                0.0,
+                -567301805773.0 / 1357537059087.0,
+                -2404267990393.0 / 2016746695238.0,
+                -3550918686646.0 / 2091501179385.0,
+                -1275806237668.0 / 842570457699.0
+            };
+            B_ = {
+                1432997174477.0 / 9575080441755.0,
+                5161836677717.0 / 13612068292357.0,
+                1720146321549.0 / 2090206949498.0,
+                3134564353537.0 / 4481467310338.0,
+                2277821191437.0 / 14882151754819.0
+            };
+        }
+        else
+        {
+            NF_ERROR_EXIT("Unsupported low storage Runge-Kutta method: " + method);
+        }
+    }
+
+    static std::string name() { return "lowStorageRungeKutta"; }
+
+    static std::string doc() { return "explicit 2N-storage Runge-Kutta time integration"; }
+
+    static std::string schema() { return "none"; }
+
+    void solve(
+        dsl::Expression<ValueType>& eqn,
+        SolutionVectorType& solutionVector,
+        [[maybe_unused]] scalar t,
+        scalar dt
+    ) override
+    {
+        SolutionVectorType& oldSolutionVector =
+            NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
+        const auto& exec = eqn.exec();
+        const auto nCells = solutionVector.internalVector().size();
+        if (!dq_ || dq_->size() != nCells || dq_->exec() != exec)
+        {
+            dq_.emplace(exec, nCells, zero<ValueType>());
+            source_.emplace(exec, nCells, zero<ValueType>());
+        }
+
+        solutionVector.correctBoundaryConditions();
+
+        const auto nStages = A_.size();
+        for (size_t stage = 0; stage < nStages; stage++)
+        {
+            eqn.explicitOperation(*source_);
+
+            const bool firstStage = stage == 0;
+            if (firstStage)
+            {
+                NeoN::finiteVolume::cellCentred::advanceTime(solutionVector);
+            }
+            auto [q, qOld, dq, source] = views(
+                solutionVector.internalVector(), oldSolutionVector.internalVector(), *dq_, *source_
+            );
+            const scalar a = A_[stage];
+            const scalar b = B_[stage];
+            parallelFor(
+                exec,
+                {0, nCells},
+                KOKKOS_LAMBDA(const localIdx celli) {
+                    const ValueType dqi = a * dq[celli] - dt * source[celli];
+                    dq[celli] = dqi;
+                    source[celli] = zero<ValueType>();
+                    q[celli] = (firstStage ? qOld[celli] : q[celli]) + b * dqi;
+                },
+                "LowStorageRungeKutta::stage"
+            );
+            solutionVector.correctBoundaryConditions();
+        }
+    };
+
+    std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override
+    {
+        return std::make_unique<LowStorageRungeKutta>(*this);
+    }
+
+private:
+
+    std::vector<scalar> A_;
+
+    std::vector<scalar> B_;
+
+    std::optional<Vector<ValueType>> dq_; //!< the second register of the 2N-storage scheme
+
+    std::optional<Vector<ValueType>> source_; //!< the explicit source of the current stage
+};
+
+
+} // namespace NeoN::timeIntegration
@@ -0,0 +1,343 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include "NeoN/core/mpi/operators.hpp"
+#endif
+
+namespace NeoN::timeIntegration
+{
+
+/* @brief Convergence and performance statistics of a Parareal solve. */
+struct PararealStats
+{
+    int nIterations = 0; /**< number of Parareal iterations */
+
+    bool converged = false; /**< whether the slice boundary states converged */
+
+    std::vector<scalar> residuals {}; /**< max change of the slice boundary states per iteration */
+
+    scalar coarseTime = 0.0; /**< wall time spent in coarse propagations of this rank [s] */
+
+    scalar fineTime = 0.0; /**< wall time spent in fine propagations of this rank [s] */
+
+    /** speed-up over the serial fine solve, estimated from the measured propagation costs and
+     * the number of ranks of the time communicator */
+    scalar speedUp = 0.0;
+};
+
+/* @class Parareal
+ * @brief Parallel-in-time driver combining a cheap coarse and an expensive fine integrator.
+ *
+ * The time interval is split into nSlices time slices. Starting from a coarse sweep, every
+ * iteration k propagates the slice boundary states U_n with the fine integrator F, which is
+ * independent for all slices, and corrects them sequentially with the coarse integrator G
+ *
+ *     U_{n+1}^{k+1} = G(U_n^{k+1}) + F(U_n^k) - G(U_n^k),
+ *
+ * until the maximum change of the boundary states is below the tolerance. After k iterations the
+ * first k slices equal the serial fine solution, thus their fine propagations are skipped.
+ *
+ * The driver is configured by a dictionary with the following keys:
+ * - coarse: the ddtSchemes dictionary of the coarse integrator, e.g. forwardEuler (required)
+ * - fine: the ddtSchemes dictionary of the fine integrator, e.g. SSPRungeKutta (required)
+ * - nSlices: number of time slices (required)
+ * - nCoarseSteps: number of coarse time steps per slice (default 1)
+ * - nFineSteps: number of fine time steps per slice (default 10)
+ * - maxIterations: maximum number of Parareal iterations (default nSlices)
+ * - tolerance: convergence tolerance of the slice boundary states (default 1e-8)
+ *
+ * Both integrators are copied from the dictionaries for every propagation, thus integrators with
+ * internal state, e.g. the Sundials based ones, start every slice from its boundary state.
+ *
+ * If a time communicator is given, the fine propagations of slice n are performed by rank
+ * n % size and the results are broadcast to all ranks, which perform the cheap coarse
+ * corrections redundantly. Every rank has to hold the complete mesh, i.e. the time parallelism
+ * is used once the spatial decomposition no longer scales. Without a communicator the slices
+ * are propagated sequentially, which yields the same iterates.
+ *
+ * NOTE as for the native integrators, the operators need to be created from the solution field.
+ */
+template<typename SolutionVectorType>
+class Parareal
+{
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+    using Expression = NeoN::dsl::Expression<ValueType>;
+
+    Parareal(const Dictionary& dict, const Dictionary& solutionDict)
+        : coarseDict_(dict.subDict("coarse")), fineDict_(dict.subDict("fine")),
+          solutionDict_(solutionDict), nSlices_(dict.get<int>("nSlices")), nCoarseSteps_(1),
+          nFineSteps_(10), maxIterations_(nSlices_), tolerance_(1.0e-8)
+    {
+        if (dict.contains("nCoarseSteps"))
+        {
+            nCoarseSteps_ = dict.get<int>("nCoarseSteps");
+        }
+        if (dict.contains("nFineSteps"))
+        {
+            nFineSteps_ = dict.get<int>("nFineSteps");
+        }
+        if (dict.contains("maxIterations"))
+        {
+            maxIterations_ = dict.get<int>("maxIterations");
+        }
+        if (dict.contains("tolerance"))
+        {
+            tolerance_ = dict.get<scalar>("tolerance");
+        }
+        NF_ASSERT(nSlices_ > 0, "nSlices has to be positive.");
+        NF_ASSERT(nCoarseSteps_ > 0 && nFineSteps_ > 0, "The number of steps has to be positive.");
+    }
+
+#ifdef NF_WITH_MPI_SUPPORT
+    /* @brief Distributes the fine propagations across the ranks of the time communicator. */
+    Parareal(const Dictionary& dict, const Dictionary& solutionDict, MPI_Comm timeComm)
+        : Parareal(dict, solutionDict)
+    {
+        timeComm_ = timeComm;
+    }
+#endif
+
+    /* @brief Integrates the expression from t0 to tEnd.
+     * @param eqn The expression, its operators have to be created from solutionVector.
+     * @param solutionVector The solution field, which holds the initial state, like for the time
+     * integrators.
+     * @param t0 The start time.
+     * @param tEnd The end time.
+     * @return The convergence and performance statistics, the solution and its old time field
+     * hold the state at tEnd.
+     */
+    PararealStats solve(Expression& eqn, SolutionVectorType& solutionVector, scalar t0, scalar tEnd)
+    {
+        auto& oldSolutionVector = NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
+        const scalar sliceDt = (tEnd - t0) / nSlices_;
+        auto sliceStart = [&](int n) { return t0 + n * sliceDt; };
+        auto [rank, nRanks] = ranks();
+        PararealStats stats;
+        int nCoarse = nSlices_;
+        int nFine = 0;
+
+        // U holds the slice boundary states, G and F the coarse and fine results of each slice
+        std::vector<Vector<ValueType>> u {solutionVector.internalVector()};
+        std::vector<Vector<ValueType>> g;
+        std::vector<Vector<ValueType>> f;
+        for (int n = 0; n < nSlices_; n++)
+        {
+            g.push_back(propagate(
+                coarseDict_, nCoarseSteps_, eqn, solutionVector, u[n], sliceStart(n), sliceDt,
+                stats.coarseTime
+            ));
+            u.push_back(g[n]);
+            f.push_back(g[n]);
+        }
+
+        for (int k = 0; k < maxIterations_ && !stats.converged; k++)
+        {
+            for (int n = k; n < nSlices_; n++)
+            {
+                if (n % nRanks == rank)
+                {
+                    f[n] = propagate(
+                        fineDict_, nFineSteps_, eqn, solutionVector, u[n], sliceStart(n), sliceDt,
+                        stats.fineTime
+                    );
+                    nFine++;
+                }
+            }
+            exchange(f, k, nRanks);
+
+            // slice k started from the exact state, thus its fine result is exact as well
+            scalar residual = maxDifference(f[k], u[k + 1]);
+            u[k + 1] = f[k];
+            for (int n = k + 1; n < nSlices_; n++)
+            {
+                auto gNew = propagate(
+                    coarseDict_, nCoarseSteps_, eqn, solutionVector, u[n], sliceStart(n), sliceDt,
+                    stats.coarseTime
+                );
+                residual = std::max(residual, correct(gNew, f[n], g[n], u[n + 1]));
+            }
+            nCoarse += nSlices_ - k - 1;
+
+            stats.nIterations = k + 1;
+            stats.residuals.push_back(residual);
+            stats.converged = residual < tolerance_ || stats.nIterations == nSlices_;
+        }
+
+        solutionVector.internalVector() = u[nSlices_];
+        oldSolutionVector.internalVector() = u[nSlices_];
+        solutionVector.correctBoundaryConditions();
+        if (nFine > 0)
+        {
+            stats.speedUp = estimateSpeedUp(
+                stats.nIterations, nRanks, stats.coarseTime / nCoarse, stats.fineTime / nFine
+            );
+        }
+        return stats;
+    }
+
+private:
+
+    /* @brief Propagates the state over one time slice with a fresh copy of the integrator. */
+    Vector<ValueType> propagate(
+        const Dictionary& schemeDict,
+        int nSteps,
+        Expression& eqn,
+        SolutionVectorType& solutionVector,
+        const Vector<ValueType>& state,
+        scalar t,
+        scalar sliceDt,
+        scalar& timer
+    ) const
+    {
+        const auto start = std::chrono::steady_clock::now();
+        solutionVector.internalVector() = state;
+        solutionVector.correctBoundaryConditions();
+
+        TimeIntegration<SolutionVectorType> integrator(schemeDict, solutionDict_);
+        const scalar dt = sliceDt / nSteps;
+        for (int step = 0; step < nSteps; step++)
+        {
+            integrator.solve(eqn, solutionVector, t + step * dt, dt);
+        }
+
+        fence(eqn.exec());
+        timer += std::chrono::duration<scalar>(std::chrono::steady_clock::now() - start).count();
+        return solutionVector.internalVector();
+    }
+
+    /* @brief Maximum norm of the difference of two states. */
+    static scalar maxDifference(const Vector<ValueType>& a, const Vector<ValueType>& b)
+    {
+        auto [aView, bView] = views(a, b);
+        scalar maxDiff {0.0};
+        Kokkos::Max<scalar> maxReducer(maxDiff);
+        parallelReduce(
+            a.exec(),
+            a.range(),
+            KOKKOS_LAMBDA(const localIdx i, scalar& lmax) {
+                const scalar diff = mag(aView[i] - bView[i]);
+                if (diff > lmax) lmax = diff;
+            },
+            maxReducer
+        );
+        return maxReducer.reference();
+    }
+
+    /* @brief Rank and size of the time communicator, a single rank without communicator. */
+    std::pair<int, int> ranks() const
+    {
+#ifdef NF_WITH_MPI_SUPPORT
+        if (timeComm_ != MPI_COMM_NULL)
+        {
+            int rank, size;
+            MPI_Comm_rank(timeComm_, &rank);
+            MPI_Comm_size(timeComm_, &size);
+            return {rank, size};
+        }
+#endif
+        return {0, 1};
+    }
+
+    /* @brief Broadcasts the fine results of the slices k to nSlices - 1 from their owners. */
+    void exchange([[maybe_unused]] std::vector<Vector<ValueType>>& f, int k, int nRanks) const
+    {
+        if (nRanks == 1) return;
+#ifdef NF_WITH_MPI_SUPPORT
+        const auto nComponents = sizeof(ValueType) / sizeof(scalar);
+        for (int n = k; n < nSlices_; n++)
+        {
+            auto hostF = f[n].copyToHost();
+            mpi::broadcast(
+                reinterpret_cast<scalar*>(hostF.data()),
+                static_cast<mpi_label_t>(hostF.size() * nComponents),
+                n % nRanks,
+                timeComm_
+            );
+            f[n] = hostF.copyToExecutor(f[n].exec());
+        }
+#else
+        (void)k;
+#endif
+    }
+
+    /* @brief Applies the Parareal correction u = gNew + f - g and stores gNew in g.
+     * @return The maximum change of u.
+     */
+    static scalar correct(
+        const Vector<ValueType>& gNew,
+        const Vector<ValueType>& f,
+        Vector<ValueType>& g,
+        Vector<ValueType>& u
+    )
+    {
+        auto [gNewView, fView, gView, uView] = views(gNew, f, g, u);
+        scalar maxDiff {0.0};
+        Kokkos::Max<scalar> maxReducer(maxDiff);
+        parallelReduce(
+            u.exec(),
+            u.range(),
+            KOKKOS_LAMBDA(const localIdx i, scalar& lmax) {
+                const ValueType uNew = gNewView[i] + fView[i] - gView[i];
+                const scalar diff = mag(uNew - uView[i]);
+                uView[i] = uNew;
+                gView[i] = gNewView[i];
+                if (diff > lmax) lmax = diff;
+            },
+            maxReducer
+        );
+        return maxReducer.reference();
+    }
+
+    /* @brief Estimates the speed-up over the serial fine solve from the mean propagation costs.
+     * The serial solve costs nSlices fine propagations. Parareal costs the coarse sweep and, in
+     * iteration k, the fine propagations of the nSlices - k open slices distributed across the
+     * ranks followed by the nSlices - k - 1 coarse corrections.
+     */
+    scalar estimateSpeedUp(int nIterations, int nRanks, scalar coarseCost, scalar fineCost) const
+    {
+        scalar cost = nSlices_ * coarseCost;
+        for (int k = 0; k < nIterations; k++)
+        {
+            const int nOpen = nSlices_ - k;
+            cost += ((nOpen + nRanks - 1) / nRanks) * fineCost + (nOpen - 1) * coarseCost;
+        }
+        return cost > 0.0 ? nSlices_ * fineCost / cost : 0.0;
+    }
+
+    Dictionary coarseDict_;
+
+    Dictionary fineDict_;
+
+    Dictionary solutionDict_;
+
+    int nSlices_;
+
+    int nCoarseSteps_;
+
+    int nFineSteps_;
+
+    int maxIterations_;
+
+    scalar tolerance_;
+
+#ifdef NF_WITH_MPI_SUPPORT
+    MPI_Comm timeComm_ = MPI_COMM_NULL;
+#endif
+};
+
+} // namespace NeoN::timeIntegration
@@ -26,26 +26,31 @@ namespace NeoN::timeIntegration
  * @tparam SolutionVectorType The Solution field type, should be a volume or surface field.
  *
  * @details
- * Implements explicit Runge-Kutta time integration using the Sundials library. The class manages
- * Sundials vectors and memory through RAII principles, handling the conversion between internal
- * field representations and Sundials' N_Vector format. Supports various (at present explicit)
- * Runge-Kutta methods which can be specified through the dictionary configuration. The main
- * interface for a solve is through the `solve` function.
+ * Implements explicit Runge-Kutta time integration using the Sundials library. The solution field
+ * is handed to Sundials as a NeoN N_Vector, see sundialsNVector.hpp, thus the vector operations
+ * run on the executor of the field and the result is written to the field without copies.
+ * Supports various (at present explicit) Runge-Kutta methods which can be specified through the
+ * dictionary configuration. The main interface for a solve is through the `solve` function.
+ *
+ * By default every solve takes a single step of the given size. If the optional keys relTol or
+ * absTol are given, the step size is adapted to the embedded error estimate of the method, which
+ * thus needs an embedding, e.g. not Forward-Euler. A solve then takes as many internal steps of at
+ * most the given size as needed to reach t + dt. The tolerances default to relTol 1e-6 and absTol
+ * 1e-10.
  *
  * @note
  * Useful Sundials documentation below, currently we have implemented only an explicit Runge-Kutta
  * interface, this simplifies things considerably as compared to some of the examples:
  * Initialization (and order thereof):
  * https://sundials.readthedocs.io/en/latest/arkode/Usage/Skeleton.html
- * Sundials-Kokkos:
- * https://sundials.readthedocs.io/en/latest/nvectors/NVector_links.html#the-nvector-kokkos-module
+ * Custom N_Vector implementations:
+ * https://sundials.readthedocs.io/en/latest/nvectors/NVector_API_link.html
  * Sundials Contexts (scroll to bottom eg, they don't like copying):
  * https://sundials.readthedocs.io/en/latest/sundials/SUNContext_link.html#c.SUNContext_Create
  *
  * @warning For developers:
- * 1. This class uses Sundials-Kokkos vectors for computation, which are immediately wrapped as
- *    Sundials N_Vectors. After initialization, only interact with the N_Vector interface as per
- *    Sundials guidelines.
+ * 1. The stages are evaluated in the storage of the solution field, thus the explicit operators
+ *    need to be created from the solution field.
  * 2. The Sundials context is supposed to only be created and freed once in a program, making
  *    copying less desirable, see above. However we need to copy, so the context is placed in a
  *    shared_ptr to prevent early freeing. Please read the documentation about multiple, concurrent
@@ -82,8 +87,8 @@ public:
     /**
      * @brief Copy constructor.
      * @param other The RungeKutta instance to copy from.
-     * @note Sundials Kokkos vectors have copy constructors, N_Vectors should be constructed from
-     * the Kokkos vectors.
+     * @note The ODE memory is not copied, the copy initializes Sundials from the old time field of
+     * the solution in its first solve.
      */
     RungeKutta(const RungeKutta& other);
 
@@ -140,10 +145,10 @@ public:
 
 private:
 
-    NeoN::sundials::SKVector<ValueType>
-        solution_; /**< Solution vector, contains the sundails N_Vector. */
-    NeoN::sundials::SKVector<ValueType>
-        initialConditions_; /**< Initial conditions vector, contains the sundails N_Vector. */
+    sundials::NVectorPtr solution_ {nullptr}; /**< N_Vector wrapping the solution field. */
+    std::unique_ptr<sundials::RHSData<SolutionVectorType>> rhsData_ {
+        std::make_unique<sundials::RHSData<SolutionVectorType>>()
+    }; /**< The user data of the rhs callback, on the heap since Sundials keeps a pointer. */
     std::shared_ptr<SUNContext> context_ {
         nullptr, sundials::SUN_CONTEXT_DELETER
     }; /**< The SUNContext for the solve. */
@@ -158,7 +163,6 @@ private:
      * @param exp The (DSL) expression being integrated in time
      * @param field The solution field
      * @param t The current time
-     * @param dt The time step size
      */
     void
     initSUNERKSolver(dsl::Expression<ValueType>& exp, SolutionVectorType& field, const scalar t);
@@ -175,23 +179,16 @@ private:
     void initSUNContext();
 
     /**
-     * @brief Initializes the Sundials vectors for solution storage.
-     * @param exec The executor of the field being integrated in time.
-     * @param size The size of the vectors to be initialized
-     */
-    void initSUNVector(const Executor& exec, size_t size);
-
-    /**
-     * @brief Initializes the initial conditions for the solver.
-     * @param solutionVector The field containing the initial conditions
+     * @brief Initializes the ODE memory and solver parameters.
+     * @param field The solution field, its old time field holds the initial conditions
+     * @param t The initial time for the solver
      */
-    void initSUNInitialConditions(const SolutionVectorType& solutionVector);
+    void initODEMemory(SolutionVectorType& field, const scalar t);
 
     /**
-     * @brief Initializes the ODE memory and solver parameters.
-     * @param t The initial time for the solver
+     * @brief Whether tolerances are given, i.e. the step size is adapted.
      */
-    void initODEMemory(const scalar t);
+    bool adaptive() const;
 };
 
 } // namespace NeoN
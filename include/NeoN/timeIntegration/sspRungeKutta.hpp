@@ -0,0 +1,200 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/fields/field.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
+
+namespace NeoN::timeIntegration
+{
+
+/* @class SSPRungeKutta
+ * @brief Explicit strong stability preserving Runge-Kutta schemes in Shu-Osher form.
+ *
+ * Every stage computes q = alpha_s q^n + (1 - alpha_s) (q + dt f(q)), where f = -source is
+ * evaluated by the explicit operators of the expression. The solution is advanced in time after
+ * the source of the first stage is evaluated, thus the old time field holds q^n without a copy
+ * and besides the solution only the source register is stored. The stage update is a single
+ * kernel, which also resets the source register for the next stage.
+ *
+ * The method is selected by the Runge-Kutta-Method key: SSP-2 (2 stages, 2nd order) or SSP-3
+ * (3 stages, 3rd order).
+ *
+ * If the absTol or relTol keys are given, the local error is estimated by the embedded forward
+ * Euler (SSP-2) or SSP-2 (SSP-3) solution, which is a linear combination of the solution before
+ * the last stage and q^n. The estimate is reduced in the last stage kernel, thus it requires
+ * neither an additional register nor an additional pass over the cells.
+ *
+ * NOTE the stages are evaluated in the storage of the solution field, thus the explicit operators
+ * need to be created from the solution field and not from its old time field.
+ */
+template<typename SolutionVectorType>
+class SSPRungeKutta :
+    public TimeIntegratorBase<SolutionVectorType>::template Register<
+        SSPRungeKutta<SolutionVectorType>>
+{
+
+public:
+
+    using ValueType = typename SolutionVectorType::VectorValueType;
+    using Base = TimeIntegratorBase<SolutionVectorType>::template Register<
+        SSPRungeKutta<SolutionVectorType>>;
+
+    SSPRungeKutta(const Dictionary& schemeDict, const Dictionary& solutionDict)
+        : Base(schemeDict, solutionDict)
+    {
+        auto method = schemeDict.get<std::string>("Runge-Kutta-Method");
+        if (method == "SSP-2")
+        {
+            alpha_ = {0.0, 0.5};
+        }
+        else if (method == "SSP-3")
+        {
+            alpha_ = {0.0, 0.75, 1.0 / 3.0};
+        }
+        else
+        {
+            NF_ERROR_EXIT("Unsupported SSP Runge-Kutta method: " + method);
+        }
+
+        estimateError_ = schemeDict.contains("absTol") || schemeDict.contains("relTol");
+        if (schemeDict.contains("absTol"))
+        {
+            absTol_ = schemeDict.get<scalar>("absTol");
+        }
+        if (schemeDict.contains("relTol"))
+        {
+            relTol_ = schemeDict.get<scalar>("relTol");
+        }
+    }
+
+    static std::string name() { return "SSPRungeKutta"; }
+
+    static std::string doc() { return "explicit strong stability preserving Runge-Kutta"; }
+
+    static std::string schema() { return "none"; }
+
+    void solve(
+        dsl::Expression<ValueType>& eqn,
+        SolutionVectorType& solutionVector,
+        [[maybe_unused]] scalar t,
+        scalar dt
+    ) override
+    {
+        SolutionVectorType& oldSolutionVector =
+            NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
+        const auto& exec = eqn.exec();
+        const auto nCells = solutionVector.internalVector().size();
+        if (!source_ || source_->size() != nCells || source_->exec() != exec)
+        {
+            source_.emplace(exec, nCells, zero<ValueType>());
+        }
+
+        solutionVector.correctBoundaryConditions();
+
+        const auto nStages = alpha_.size();
+        for (size_t stage = 0; stage < nStages; stage++)
+        {
+            eqn.explicitOperation(*source_);
+
+            // the first stage reads q^n from the old time field, since advancing the solution
+            // swaps its storage with the old time field
+            const bool firstStage = stage == 0;
+            if (firstStage)
+            {
+                NeoN::finiteVolume::cellCentred::advanceTime(solutionVector);
+            }
+            auto [q, qOld, source] = views(
+                solutionVector.internalVector(), oldSolutionVector.internalVector(), *source_
+            );
+            const scalar alpha = alpha_[stage];
+            const bool lastStage = stage + 1 == nStages;
+            if (lastStage && estimateError_)
+            {
+                error_ = lastStageWithErrorEstimate(exec, nCells, alpha, dt, q, qOld, source);
+                solutionVector.correctBoundaryConditions();
+                break;
+            }
+            parallelFor(
+                exec,
+                {0, nCells},
+                KOKKOS_LAMBDA(const localIdx celli) {
+                    const ValueType qi = firstStage ? qOld[celli] : q[celli];
+                    q[celli] = alpha * qOld[celli] + (1.0 - alpha) * (qi - dt * source[celli]);
+                    source[celli] = zero<ValueType>();
+                },
+                "SSPRungeKutta::stage"
+            );
+            solutionVector.correctBoundaryConditions();
+        }
+    };
+
+    std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> clone() const override
+    {
+        return std::make_unique<SSPRungeKutta>(*this);
+    }
+
+    std::optional<ErrorEstimate> errorEstimate() const override { return error_; }
+
+private:
+
+    /* @brief The last stage, which also reduces the maximum of the local error weighted by the
+     * tolerances.
+     * The embedded solution is q^n + c (q - q^n), with q the solution before the last stage and
+     * c = 1 for SSP-2 and c = 2 for SSP-3.
+     */
+    ErrorEstimate lastStageWithErrorEstimate(
+        const Executor& exec,
+        localIdx nCells,
+        scalar alpha,
+        scalar dt,
+        View<ValueType> q,
+        View<ValueType> qOld,
+        View<ValueType> source
+    ) const
+    {
+        const int embeddedOrder = static_cast<int>(alpha_.size()) - 1;
+        const scalar c = static_cast<scalar>(embeddedOrder);
+        const scalar absTol = absTol_;
+        const scalar relTol = relTol_;
+        scalar maxError {0.0};
+        Kokkos::Max<scalar> maxReducer(maxError);
+        parallelReduce(
+            exec,
+            {0, nCells},
+            KOKKOS_LAMBDA(const localIdx celli, scalar& lmax) {
+                const ValueType qEmbedded = qOld[celli] + c * (q[celli] - qOld[celli]);
+                q[celli] = alpha * qOld[celli] + (1.0 - alpha) * (q[celli] - dt * source[celli]);
+                source[celli] = zero<ValueType>();
+                const scalar error =
+                    mag(q[celli] - qEmbedded) / (absTol + relTol * mag(q[celli]));
+                if (error > lmax) lmax = error;
+            },
+            maxReducer
+        );
+        return ErrorEstimate {maxReducer.reference(), embeddedOrder};
+    }
+
+    std::vector<scalar> alpha_;
+
+    bool estimateError_ = false;
+
+    scalar absTol_ = 0.0;
+
+    scalar relTol_ = 0.0;
+
+    std::optional<ErrorEstimate> error_; //!< the error estimate of the last step
+
+    std::optional<Vector<ValueType>> source_; //!< the explicit source of the current stage
+};
+
+
+} // namespace NeoN::timeIntegration
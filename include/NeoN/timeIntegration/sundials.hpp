@@ -9,17 +9,22 @@
 #include <concepts>
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include <sundials/sundials_nvector.h>
 #include <sundials/sundials_core.hpp>
-#include <nvector/nvector_serial.h>
-#include <nvector/nvector_kokkos.hpp>
 #include <arkode/arkode_arkstep.h>
 #include <arkode/arkode_erkstep.h>
+#include <cvode/cvode.h>
 
 #include "NeoN/core/error.hpp"
-#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/dsl/expression.hpp"
 #include "NeoN/fields/field.hpp"
+#include "NeoN/linearAlgebra/linearSystem.hpp"
+#include "NeoN/linearAlgebra/solver.hpp"
+#include "NeoN/linearAlgebra/utilities.hpp"
+#include "NeoN/timeIntegration/sundialsNVector.hpp"
 
 namespace NeoN::sundials
 {
@@ -51,6 +56,19 @@ inline auto SUN_ARK_DELETER = [](char* ark)
     }
 };
 
+/**
+ * @brief Custom deleter for the CVODE memory for the unique pointers.
+ * @param cvode Pointer to the CVODE memory to be freed, can be nullptr.
+ */
+inline auto SUN_CVODE_DELETER = [](char* cvode)
+{
+    if (cvode != nullptr)
+    {
+        void* cvodeMem = reinterpret_cast<void*>(cvode);
+        CVodeFree(&cvodeMem);
+    }
+};
+
 /**
  * @brief Maps dictionary keywords to SUNDIALS RKButcher tableau identifiers.
  * @param key The name of the explicit Runge-Kutta method.
@@ -60,16 +78,8 @@ inline auto SUN_ARK_DELETER = [](char* ark)
 inline ARKODE_ERKTableID stringToERKTable(const std::string& key)
 {
     if (key == "Forward-Euler") return ARKODE_FORWARD_EULER_1_1;
-    if (key == "Heun")
-    {
-        NF_ERROR_EXIT("Currently unsupported until field time step-stage indexing resolved.");
-        return ARKODE_HEUN_EULER_2_1_2;
-    }
-    if (key == "Midpoint")
-    {
-        NF_ERROR_EXIT("Currently unsupported until field time step-stage indexing resolved.");
-        return ARKODE_EXPLICIT_MIDPOINT_EULER_2_1_2;
-    }
+    if (key == "Heun") return ARKODE_HEUN_EULER_2_1_2;
+    if (key == "Midpoint") return ARKODE_EXPLICIT_MIDPOINT_EULER_2_1_2;
     NF_ERROR_EXIT(
         "Unsupported Runge-Kutta time integration method selectied: " + key + ".\n"
         + "Supported methods are: Forward-Euler, Heun, Midpoint."
@@ -78,145 +88,83 @@ inline ARKODE_ERKTableID stringToERKTable(const std::string& key)
 }
 
 /**
- * @brief Converts NeoN Vector data to SUNDIALS N_Vector format.
- * @tparam SKVectorType The SUNDIALS Kokkos vector type
- * @tparam ValueType The field data type
- * @param field Source NeoN field
- * @param vector Target SUNDIALS N_Vector
- * @warning Assumes matching initialization and size between field and vector
+ * @brief Maps dictionary keywords to the implicit and explicit SUNDIALS Butcher tableau
+ * identifiers of additive Runge-Kutta methods.
+ * @param key The name of the additive Runge-Kutta method.
+ * @return The DIRK and the ERK table, the ERK table is ARKODE_ERK_NONE for pure DIRK methods.
+ * @throws Runtime error for unsupported methods.
  */
-template<typename SKVectorType, typename ValueType>
-void fieldToSunNVectorImpl(const NeoN::Vector<ValueType>& field, N_Vector& vector)
+inline std::pair<ARKODE_DIRKTableID, ARKODE_ERKTableID> stringToARKTables(const std::string& key)
 {
-    auto view = ::sundials::kokkos::GetVec<SKVectorType>(vector)->View();
-    auto fieldView = field.view();
-    NeoN::parallelFor(
-        field.exec(),
-        field.range(),
-        KOKKOS_LAMBDA(const localIdx i) { view(i) = fieldView[i]; },
-        "fieldToSunNVector"
+    if (key == "SDIRK-2") return {ARKODE_SDIRK_2_1_2, ARKODE_ERK_NONE};
+    if (key == "ARK-2") return {ARKODE_ARK2_DIRK_3_1_2, ARKODE_ARK2_ERK_3_1_2};
+    if (key == "ARK-3") return {ARKODE_ARK324L2SA_DIRK_4_2_3, ARKODE_ARK324L2SA_ERK_4_2_3};
+    if (key == "ARK-4") return {ARKODE_ARK436L2SA_DIRK_6_3_4, ARKODE_ARK436L2SA_ERK_6_3_4};
+    NF_ERROR_EXIT(
+        "Unsupported implicit Runge-Kutta time integration method selected: " + key + ".\n"
+        + "Supported methods are: SDIRK-2, ARK-2, ARK-3, ARK-4."
     );
-};
-
-/**
- * @brief Dispatcher for field to N_Vector conversion based on executor type.
- * @tparam ValueType The field data type
- * @param field Source NeoN field
- * @param vector Target SUNDIALS N_Vector
- * @throws Runtime error for unsupported executors
- */
-template<typename ValueType>
-void fieldToSunNVector(const NeoN::Vector<ValueType>& field, N_Vector& vector)
-{
-    // CHECK FOR N_Vector on correct space in DEBUG
-    if (std::holds_alternative<NeoN::GPUExecutor>(field.exec()))
-    {
-        fieldToSunNVectorImpl<::sundials::kokkos::Vector<Kokkos::DefaultExecutionSpace>>(
-            field, vector
-        );
-        return;
-    }
-    if (std::holds_alternative<NeoN::CPUExecutor>(field.exec()))
-    {
-        fieldToSunNVectorImpl<::sundials::kokkos::Vector<Kokkos::DefaultHostExecutionSpace>>(
-            field, vector
-        );
-        return;
-    }
-    if (std::holds_alternative<NeoN::SerialExecutor>(field.exec()))
-    {
-        fieldToSunNVectorImpl<::sundials::kokkos::Vector<Kokkos::Serial>>(field, vector);
-        return;
-    }
-    NF_ERROR_EXIT("Unsupported NeoN executor for field.");
-};
+    return {ARKODE_DIRK_NONE, ARKODE_ERK_NONE}; // avoids compiler warnings.
+}
 
 /**
- * @brief Converts SUNDIALS N_Vector data back to NeoN Vector format.
- * @tparam SKVectorType The SUNDIALS Kokkos vector type
- * @tparam ValueType The field data type
- * @param vector Source SUNDIALS N_Vector
- * @param field Target NeoN field
- * @warning Assumes matching initialization and size between vector and field
+ * @brief The user data of the right hand side callback.
+ * @tparam SolutionVectorType The solution field type.
  */
-template<typename SKVectorType, typename ValueType>
-void sunNVectorToVectorImpl(const N_Vector& vector, NeoN::Vector<ValueType>& field)
+template<typename SolutionVectorType>
+struct RHSData
 {
-    auto view = ::sundials::kokkos::GetVec<SKVectorType>(vector)->View();
-    ValueType* fieldData = field.data();
-    NeoN::parallelFor(
-        field.exec(),
-        field.range(),
-        KOKKOS_LAMBDA(const localIdx i) { fieldData[i] = view(i); },
-        "sunNVectorToVectorImpl"
-    );
-};
+    using ValueType = typename SolutionVectorType::VectorValueType;
 
-/**
- * @brief Dispatcher for N_Vector to field conversion based on executor type.
- * @tparam ValueType The field data type
- * @param vector Source SUNDIALS N_Vector
- * @param field Target NeoN field
- */
-template<typename ValueType>
-void sunNVectorToVector(const N_Vector& vector, NeoN::Vector<ValueType>& field)
-{
-    if (std::holds_alternative<NeoN::GPUExecutor>(field.exec()))
-    {
-        sunNVectorToVectorImpl<::sundials::kokkos::Vector<Kokkos::DefaultExecutionSpace>>(
-            vector, field
-        );
-        return;
-    }
-    if (std::holds_alternative<NeoN::CPUExecutor>(field.exec()))
-    {
-        sunNVectorToVectorImpl<::sundials::kokkos::Vector<Kokkos::DefaultHostExecutionSpace>>(
-            vector, field
-        );
-        return;
-    }
-    if (std::holds_alternative<NeoN::SerialExecutor>(field.exec()))
-    {
-        sunNVectorToVectorImpl<::sundials::kokkos::Vector<Kokkos::Serial>>(vector, field);
-        return;
-    }
-    NF_ERROR_EXIT("Unsupported NeoN executor for field.");
+    NeoN::dsl::Expression<ValueType>* expression;
+    SolutionVectorType* solution; /**< The field the explicit operators were created from. */
+
+    // only used by the implicit integrators
+    /** The implicit spatial operators, assembled in every implicit rhs evaluation. */
+    std::optional<la::LinearSystem<ValueType, localIdx>> implicitSystem {};
+    /** The Newton system V/gamma I + A of the implicit spatial operators A. */
+    std::optional<la::LinearSystem<ValueType, localIdx>> newtonSystem {};
+    std::optional<la::Solver> linearSolver {}; /**< The solver of the Newton system. */
+    /** Returns gamma of the Newton matrix I - gamma J of the integrator. */
+    std::function<scalar()> currentGamma {};
+    scalar newtonGamma {0.0}; /**< The gamma the Newton system was set up with. */
+    scalar minCellVolume {0.0}; /**< The smallest rank local cell volume of the mesh. */
 };
 
 /**
- * @brief Performs a single explicit Runge-Kutta stage evaluation.
+ * @brief Evaluates the right hand side of the explicit Runge-Kutta stages.
  * @param t Current time value
- * @param y Current solution vector
+ * @param y Current stage vector
  * @param ydot Output RHS vector
- * @param userData Pointer to Expression object
+ * @param userData Pointer to the RHSData
  * @return 0 on success, non-zero on error
  *
- * @details This is our implementation of the RHS of explicit spacial integration, to be integrated
- * in time. In our case user_data is a unique_ptr to an expression. In this function a 'working
- * source' vector is created and parsed to the explicitOperation, which should contain the field
- * variable at the start of the time step. Currently 'multi-stage RK' is not supported until y
- * can be copied to this field.
+ * @details The explicit operators read the solution field, thus stage vectors held by Sundials are
+ * written to the field before the evaluation. If Sundials passes the vector wrapping the field
+ * nothing is copied. The explicit operators accumulate directly into ydot, which is negated in
+ * place, i.e. no temporary vector is created.
  */
 template<typename SolutionVectorType>
 int explicitRKSolve([[maybe_unused]] sunrealtype t, N_Vector y, N_Vector ydot, void* userData)
 {
-    // Pointer wrangling
-    using ValueType = typename SolutionVectorType::VectorValueType;
-    NeoN::dsl::Expression<ValueType>* pdeExpre =
-        reinterpret_cast<NeoN::dsl::Expression<ValueType>*>(userData);
-    sunrealtype* yDotArray = N_VGetArrayPointer(ydot);
-    sunrealtype* yArray = N_VGetArrayPointer(y);
-
+    auto* data = reinterpret_cast<RHSData<SolutionVectorType>*>(userData);
     NF_ASSERT(
-        yDotArray != nullptr && yArray != nullptr && pdeExpre != nullptr,
+        data != nullptr && data->expression != nullptr && data->solution != nullptr,
         "Failed to dereference pointers in sundails."
     );
 
-    auto size = static_cast<localIdx>(N_VGetLength(y));
-    // Copy initial value from y to source.
-    NeoN::Vector<NeoN::scalar> source = pdeExpre->explicitOperation(size) * -1.0; // compute spatial
-    fence(pdeExpre->exec());
-    NeoN::sundials::fieldToSunNVector(source, ydot); // assign rhs to ydot.
+    auto& solution = data->solution->internalVector();
+    auto& stage = getVector(y);
+    if (stage.data() != solution.data())
+    {
+        solution = stage;
+    }
+    data->solution->correctBoundaryConditions();
+
+    auto& source = getVector(ydot);
+    fill(source, 0.0);
+    data->expression->explicitOperation(source);
+    source *= -1.0;
     return 0;
 }
 
@@ -224,274 +172,87 @@ namespace detail
 {
 
 /**
- * @brief Initializes a vector wrapper with specified size and context.
- * @tparam Vector Vector wrapper type implementing initNVector interface
- * @param[in] size Number of elements
- * @param[in] context SUNDIALS context for vector operations
- * @param[in,out] vec Vector to initialize
+ * @brief Assembles the implicit spatial operators, ie. operators of Type::Implicit, at the current
+ * solution and computes their residual A y - b.
+ * @return The residual, which is stored in place of the rhs b of the implicit system.
  */
-template<typename Vector>
-void initNVector(size_t size, std::shared_ptr<SUNContext> context, Vector& vec)
-{
-    vec.initNVector(size, context);
-}
-
-/**
- * @brief Provides const access to underlying N_Vector.
- * @tparam Vector Vector wrapper type implementing NVector interface
- * @param vec Source vector wrapper
- * @return Const reference to wrapped N_Vector
- */
-template<typename Vector>
-const N_Vector& sunNVector(const Vector& vec)
+template<typename SolutionVectorType>
+Vector<scalar>& implicitResidual(RHSData<SolutionVectorType>& data)
 {
-    return vec.sunNVector();
+    NF_ASSERT(data.implicitSystem, "The implicit system is not initialized.");
+    auto& ls = *data.implicitSystem;
+    ls.reset();
+    data.expression->assembleSpatialOperator(ls);
+    // every row only reads its own entry of b, thus the residual can overwrite b
+    la::computeResidual(ls.matrix(), ls.rhs(), data.solution->internalVector(), ls.rhs());
+    return ls.rhs();
 }
 
-/**
- * @brief Provides mutable access to underlying N_Vector.
- * @tparam Vector Vector wrapper type implementing NVector interface
- * @param[in,out] vec Source vector wrapper
- * @return Mutable reference to wrapped N_Vector
- */
-template<typename Vector>
-N_Vector& sunNVector(Vector& vec)
-{
-    return vec.sunNVector();
-}
 }
 
 /**
- * @brief Serial executor SUNDIALS Kokkos vector wrapper.
- * @tparam ValueType The vector data type
- * @details Provides RAII management of SUNDIALS Kokkos vectors for serial execution.
- */
-template<typename ValueType>
-class SKVectorSerial
-{
-public:
-
-    SKVectorSerial() {};
-    ~SKVectorSerial() = default;
-    SKVectorSerial(const SKVectorSerial& other)
-        : kvector_(other.kvector_), svector_(other.kvector_) {};
-    SKVectorSerial(SKVectorSerial&& other) noexcept
-        : kvector_(std::move(other.kvector_)), svector_(std::move(other.svector_)) {};
-    SKVectorSerial& operator=(const SKVectorSerial& other) = delete;
-    SKVectorSerial& operator=(SKVectorSerial&& other) = delete;
-
-
-    using KVector = ::sundials::kokkos::Vector<Kokkos::Serial>;
-    void initNVector(size_t size, std::shared_ptr<SUNContext> context)
-    {
-        kvector_ = KVector(size, *context);
-        svector_ = kvector_;
-    };
-    const N_Vector& sunNVector() const { return svector_; };
-    N_Vector& sunNVector() { return svector_; };
-
-private:
-
-    KVector kvector_ {}; /**< The Sundails, kokkos initial conditions vector (do not use).*/
-    N_Vector svector_ {nullptr};
-};
-
-/**
- * @brief Host default executor SUNDIALS Kokkos vector wrapper.
- * @tparam ValueType The vector data type
- * @details Provides RAII management of SUNDIALS Kokkos vectors for CPU execution.
- */
-template<typename ValueType>
-class SKVectorHostDefault
-{
-public:
-
-    using KVector = ::sundials::kokkos::Vector<Kokkos::DefaultHostExecutionSpace>;
-
-    SKVectorHostDefault() = default;
-    ~SKVectorHostDefault() = default;
-    SKVectorHostDefault(const SKVectorHostDefault& other)
-        : kvector_(other.kvector_), svector_(other.kvector_) {};
-    SKVectorHostDefault(SKVectorHostDefault&& other) noexcept
-        : kvector_(std::move(other.kvector_)), svector_(std::move(other.svector_)) {};
-    SKVectorHostDefault& operator=(const SKVectorHostDefault& other) = delete;
-    SKVectorHostDefault& operator=(SKVectorHostDefault&& other) = delete;
-
-    void initNVector(size_t size, std::shared_ptr<SUNContext> context)
-    {
-        kvector_ = KVector(size, *context);
-        svector_ = kvector_;
-    };
-    const N_Vector& sunNVector() const { return svector_; };
-    N_Vector& sunNVector() { return svector_; };
-
-private:
-
-    KVector kvector_ {}; /**< The Sundails, kokkos initial conditions vector (do not use).*/
-    N_Vector svector_ {nullptr};
-};
-
-/**
- * @brief Default executor SUNDIALS Kokkos vector wrapper.
- * @tparam ValueType The vector data type
- * @details Provides RAII management of SUNDIALS Kokkos vectors for GPU execution.
+ * @brief Evaluates the right hand side of the implicit operators, f_I(y) = -(A y - b) / V.
+ * @param t Current time value
+ * @param y Current stage vector
+ * @param ydot Output RHS vector
+ * @param userData Pointer to the RHSData
+ * @return 0 on success, non-zero on error
+ *
+ * @details The implicit spatial operators are assembled into the implicit system of the RHSData,
+ * whose matrix is reused by the linear solver as the Jacobian of the implicit part, see
+ * sundialsLinearSolver.hpp.
  */
-template<typename ValueType>
-class SKVectorDefault
+template<typename SolutionVectorType>
+int implicitRKSolve([[maybe_unused]] sunrealtype t, N_Vector y, N_Vector ydot, void* userData)
 {
-public:
-
-    using KVector = ::sundials::kokkos::Vector<Kokkos::DefaultExecutionSpace>;
-
-    SKVectorDefault() = default;
-    ~SKVectorDefault() = default;
-    SKVectorDefault(const SKVectorDefault& other)
-        : kvector_(other.kvector_), svector_(other.kvector_) {};
-    SKVectorDefault(SKVectorDefault&& other) noexcept
-        : kvector_(std::move(other.kvector_)), svector_(std::move(other.svector_)) {};
-    SKVectorDefault& operator=(const SKVectorDefault& other) = delete;
-    SKVectorDefault& operator=(SKVectorDefault&& other) = delete;
+    auto* data = reinterpret_cast<RHSData<SolutionVectorType>*>(userData);
+    NF_ASSERT(
+        data != nullptr && data->expression != nullptr && data->solution != nullptr,
+        "Failed to dereference pointers in sundails."
+    );
 
-    void initNVector(size_t size, std::shared_ptr<SUNContext> context)
+    auto& solution = data->solution->internalVector();
+    auto& stage = getVector(y);
+    if (stage.data() != solution.data())
     {
-        kvector_ = KVector(size, *context);
-        svector_ = kvector_;
-    };
-
-    const N_Vector& sunNVector() const { return svector_; };
-
-    N_Vector& sunNVector() { return svector_; };
-
-private:
-
-    KVector kvector_ {}; /**< The Sundails, kokkos initial conditions vector (do not use).*/
-    N_Vector svector_ {nullptr};
-};
+        solution = stage;
+    }
+    data->solution->correctBoundaryConditions();
+
+    auto& source = getVector(ydot);
+    auto [sourceView, residual, vol] =
+        views(source, detail::implicitResidual(*data), data->solution->mesh().cellVolumes());
+    parallelFor(
+        source.exec(),
+        source.range(),
+        KOKKOS_LAMBDA(const localIdx celli) { sourceView[celli] = -residual[celli] / vol[celli]; },
+        "implicitRKSolve"
+    );
+    return 0;
+}
 
 /**
- * @brief Unified interface for SUNDIALS Kokkos vector management.
- * @tparam ValueType The vector data type
- * @details Manages executor-specific vector implementations through variant storage.
- * Provides common interface for vector initialization and access.
+ * @brief Evaluates the right hand side of all operators, f(y) = f_E(y) + f_I(y), for integrators
+ * without splitting, eg. CVODE.
  */
-template<typename ValueType>
-class SKVector
+template<typename SolutionVectorType>
+int fullRHSSolve(sunrealtype t, N_Vector y, N_Vector ydot, void* userData)
 {
-public:
-
-    using SKVectorSerialV = SKVectorSerial<ValueType>;
-    using SKVectorHostDefaultV = SKVectorHostDefault<ValueType>;
-    using SKDefaultVectorV = SKVectorDefault<ValueType>;
-    using SKVectorVariant = std::variant<SKVectorSerialV, SKVectorHostDefaultV, SKDefaultVectorV>;
-
-    /**
-     * @brief Default constructor. Initializes with host-default vector.
-     */
-    SKVector() { vector_.template emplace<SKVectorHostDefaultV>(); };
-
-    /**
-     * @brief Default destructor.
-     */
-    ~SKVector() = default;
-
-    /**
-     * @brief Copy constructor.
-     * @param[in] other Source SKVector to copy from
-     */
-    SKVector(const SKVector&) = default;
-
-    /**
-     * @brief Copy assignment operator (deleted).
-     */
-    SKVector& operator=(const SKVector&) = delete;
-
-    /**
-     * @brief Move constructor.
-     * @param[in] other Source SKVector to move from
-     */
-    SKVector(SKVector&&) noexcept = default;
-
-    /**
-     * @brief Move assignment operator (deleted).
-     */
-    SKVector& operator=(SKVector&&) noexcept = delete;
-
-    /**
-     * @brief Sets appropriate vector implementation based on executor type.
-     * @param[in] exec NeoN executor specifying computation space
-     */
-    void setExecutor(const NeoN::Executor& exec)
-    {
-        if (std::holds_alternative<NeoN::GPUExecutor>(exec))
-        {
-            vector_.template emplace<SKDefaultVectorV>();
-            return;
-        }
-        if (std::holds_alternative<NeoN::CPUExecutor>(exec))
-        {
-            vector_.template emplace<SKVectorHostDefaultV>();
-            return;
-        }
-        if (std::holds_alternative<NeoN::SerialExecutor>(exec))
-        {
-            vector_.template emplace<SKVectorSerialV>();
-            return;
-        }
-
-        NF_ERROR_EXIT(
-            "Unsupported NeoN executor: "
-            << std::visit([](const auto& e) { return e.name(); }, exec) << "."
-        );
-    }
-
-    /**
-     * @brief Initializes underlying vector with given size and context.
-     * @param size Number of vector elements
-     * @param context SUNDIALS context for vector operations
-     */
-    void initNVector(size_t size, std::shared_ptr<SUNContext> context)
-    {
-        std::visit(
-            [size, &context](auto& vec) { detail::initNVector(size, context, vec); }, vector_
-        );
-    }
-
-    /**
-     * @brief Gets const reference to underlying N_Vector.
-     * @return Const reference to wrapped SUNDIALS N_Vector
-     */
-    const N_Vector& sunNVector() const
-    {
-        return std::visit(
-            [](const auto& vec) -> const N_Vector& { return detail::sunNVector(vec); }, vector_
-        );
-    }
-
-    /**
-     * @brief Gets mutable reference to underlying N_Vector.
-     * @return Mutable reference to wrapped SUNDIALS N_Vector
-     */
-    N_Vector& sunNVector()
-    {
-        return std::visit([](auto& vec) -> N_Vector& { return detail::sunNVector(vec); }, vector_);
-    }
-
-    /**
-     * @brief Gets const reference to variant storing implementation.
-     * @return Const reference to vector variant
-     */
-    const SKVectorVariant& variant() const { return vector_; }
-
-    /**
-     * @brief Gets mutable reference to variant storing implementation.
-     * @return Mutable reference to vector variant
-     */
-    SKVectorVariant& variant() { return vector_; }
-
-private:
+    explicitRKSolve<SolutionVectorType>(t, y, ydot, userData);
+
+    auto* data = reinterpret_cast<RHSData<SolutionVectorType>*>(userData);
+    auto& source = getVector(ydot);
+    auto [sourceView, residual, vol] =
+        views(source, detail::implicitResidual(*data), data->solution->mesh().cellVolumes());
+    parallelFor(
+        source.exec(),
+        source.range(),
+        KOKKOS_LAMBDA(const localIdx celli) { sourceView[celli] -= residual[celli] / vol[celli]; },
+        "fullRHSSolve"
+    );
+    return 0;
+}
 
-    SKVectorVariant vector_; /**< Variant storing executor-specific vector implementation */
-};
 }
 
 #endif
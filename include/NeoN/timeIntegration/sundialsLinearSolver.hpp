@@ -0,0 +1,221 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#if NN_WITH_SUNDIALS
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include <sundials/sundials_linearsolver.h>
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/linearAlgebra/sparsityPattern.hpp"
+#include "NeoN/timeIntegration/sundials.hpp"
+
+namespace NeoN::sundials
+{
+
+/**
+ * @brief Custom deleter for SUNLinearSolvers created by createLinearSolver.
+ */
+struct LinearSolverDeleter
+{
+    void operator()(SUNLinearSolver solver) const
+    {
+        if (solver != nullptr)
+        {
+            SUNLinSolFree(solver);
+        }
+    }
+};
+
+using LinearSolverPtr =
+    std::unique_ptr<std::remove_pointer_t<SUNLinearSolver>, LinearSolverDeleter>;
+
+namespace detail
+{
+
+/**
+ * @brief Sets the Newton system to V/gamma I + A, where A is the matrix of the implicit system.
+ * @details The Newton matrix of the integrators is M = I - gamma J with the Jacobian
+ * J = -A/V of the implicit rhs, thus M x = b is solved as (V/gamma I + A) x = V/gamma b.
+ */
+template<typename SolutionVectorType>
+void updateNewtonSystem(RHSData<SolutionVectorType>& data, scalar gamma)
+{
+    NF_ASSERT(data.implicitSystem && data.newtonSystem, "The implicit system is not initialized.");
+    const auto& mesh = data.solution->mesh();
+    auto& newtonSystem = *data.newtonSystem;
+    newtonSystem.matrix().values() = data.implicitSystem->matrix().values();
+
+    const auto [diagOffs, vol] =
+        views(la::SparsityPattern::readOrCreate(mesh).diagOffset(), mesh.cellVolumes());
+    auto [matrix, rhs] = newtonSystem.view();
+    const scalar rGamma = 1.0 / gamma;
+    parallelFor(
+        newtonSystem.exec(),
+        {0, rhs.size()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            matrix.values[matrix.rowOffs[celli] + diagOffs[celli]] += vol[celli] * rGamma;
+        },
+        "updateNewtonSystem"
+    );
+    data.newtonGamma = gamma;
+}
+
+template<typename SolutionVectorType>
+RHSData<SolutionVectorType>& getRHSData(SUNLinearSolver solver)
+{
+    NF_ASSERT(solver->content != nullptr, "Failed to dereference pointers in sundails.");
+    return *reinterpret_cast<RHSData<SolutionVectorType>*>(solver->content);
+}
+
+inline SUNLinearSolver_Type linearSolverType(SUNLinearSolver)
+{
+    return SUNLINEARSOLVER_MATRIX_EMBEDDED;
+}
+
+inline SUNLinearSolver_ID linearSolverID(SUNLinearSolver) { return SUNLINEARSOLVER_CUSTOM; }
+
+/**
+ * @brief Assembles the Newton system for the current gamma of the integrator.
+ * @details The matrix of the implicit system was assembled by the last evaluation of the
+ * implicit rhs, which the integrators perform at the current state before the setup.
+ */
+template<typename SolutionVectorType>
+int linearSolverSetup(SUNLinearSolver solver, SUNMatrix)
+{
+    auto& data = getRHSData<SolutionVectorType>(solver);
+    updateNewtonSystem(data, data.currentGamma());
+    return 0;
+}
+
+/**
+ * @brief Solves M x = b with the la::Solver configured by the solution dictionary.
+ * @details The integrators require ||b - M x||_2 < tol. As b - M x = gamma/V (rhs - N x) for the
+ * Newton system N x = rhs, the la::Solver stops at the absolute residual tol min(V)/gamma, which
+ * is sufficient. Since backends may ignore the tolerance, the residual is checked after the solve.
+ * @return 0 on success, SUNLS_CONV_FAIL if the tolerance was not reached, which lets the
+ * integrators retry with a new setup or a smaller step.
+ */
+template<typename SolutionVectorType>
+int linearSolverSolve(SUNLinearSolver solver, SUNMatrix, N_Vector x, N_Vector b, sunrealtype tol)
+{
+    auto& data = getRHSData<SolutionVectorType>(solver);
+    const scalar gamma = data.currentGamma();
+    if (gamma != data.newtonGamma)
+    {
+        updateNewtonSystem(data, gamma);
+    }
+
+    auto& newtonSystem = *data.newtonSystem;
+    const auto& vol = data.solution->mesh().cellVolumes();
+    auto [rhs, bView, volView] = views(newtonSystem.rhs(), getVector(b), vol);
+    const scalar rGamma = 1.0 / gamma;
+    parallelFor(
+        newtonSystem.exec(),
+        {0, rhs.size()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            rhs[celli] = volView[celli] * rGamma * bView[celli];
+        },
+        "linearSolverSolve"
+    );
+
+    auto& solution = getVector(x);
+    fill(solution, 0.0);
+    data.linearSolver->setAbsoluteTolerance(tol * data.minCellVolume * rGamma);
+    data.linearSolver->solve(newtonSystem, solution);
+
+    // the rhs is not needed anymore and every row only reads its own entry, thus the residual
+    // N x - rhs can overwrite it
+    la::computeResidual(newtonSystem.matrix(), newtonSystem.rhs(), solution, newtonSystem.rhs());
+    auto [residual, cellVol] = views(newtonSystem.rhs(), vol);
+    scalar squareSum = 0.0;
+    parallelReduce(
+        newtonSystem.exec(),
+        {0, residual.size()},
+        KOKKOS_LAMBDA(const localIdx celli, scalar& sum) {
+            const scalar r = gamma * residual[celli] / cellVol[celli];
+            sum += r * r;
+        },
+        squareSum
+    );
+    squareSum = sumOverRanks(x, squareSum);
+    return std::sqrt(squareSum) < tol ? 0 : SUNLS_CONV_FAIL;
+}
+
+/**
+ * @brief Frees the solver, the RHSData is owned by the integrator.
+ */
+inline SUNErrCode linearSolverFree(SUNLinearSolver solver)
+{
+    solver->content = nullptr;
+    SUNLinSolFreeEmpty(solver);
+    return SUN_SUCCESS;
+}
+
+}
+
+/**
+ * @brief Creates the implicit and Newton systems and the linear solver of the RHSData.
+ * @param data The RHSData, its solution has to be set.
+ * @param solutionDict The dictionary of the la::Solver solving the Newton systems.
+ */
+template<typename SolutionVectorType>
+void initImplicitSystems(RHSData<SolutionVectorType>& data, const Dictionary& solutionDict)
+{
+    using ValueType = typename RHSData<SolutionVectorType>::ValueType;
+    const auto& mesh = data.solution->mesh();
+    const auto& sparsityPattern = la::SparsityPattern::readOrCreate(mesh);
+    data.implicitSystem.emplace(
+        la::createEmptyLinearSystem<ValueType, localIdx>(mesh, sparsityPattern)
+    );
+    data.newtonSystem.emplace(
+        la::createEmptyLinearSystem<ValueType, localIdx>(mesh, sparsityPattern)
+    );
+    data.linearSolver.emplace(mesh.exec(), solutionDict);
+    data.newtonGamma = 0.0;
+
+    const auto vol = mesh.cellVolumes().view();
+    scalar minCellVolume = std::numeric_limits<scalar>::max();
+    Kokkos::Min<scalar> minReducer(minCellVolume);
+    parallelReduce(
+        mesh.exec(),
+        {0, vol.size()},
+        KOKKOS_LAMBDA(const localIdx celli, scalar& lmin) {
+            if (vol[celli] < lmin) lmin = vol[celli];
+        },
+        minReducer
+    );
+    data.minCellVolume = minReducer.reference();
+}
+
+/**
+ * @brief Creates a matrix embedded SUNLinearSolver solving the Newton systems of the implicit
+ * integrators with a la::Solver.
+ * @param data The RHSData of the integrator, its implicit and Newton systems and linear solver
+ * have to be initialized, has to outlive the linear solver.
+ * @param context The SUNContext of the integrator.
+ */
+template<typename SolutionVectorType>
+SUNLinearSolver createLinearSolver(RHSData<SolutionVectorType>& data, SUNContext context)
+{
+    SUNLinearSolver solver = SUNLinSolNewEmpty(context);
+    NF_ASSERT(solver != nullptr, "SUNLinSolNewEmpty failed");
+    solver->content = &data;
+    solver->ops->gettype = detail::linearSolverType;
+    solver->ops->getid = detail::linearSolverID;
+    solver->ops->setup = detail::linearSolverSetup<SolutionVectorType>;
+    solver->ops->solve = detail::linearSolverSolve<SolutionVectorType>;
+    solver->ops->free = detail::linearSolverFree;
+    return solver;
+}
+
+}
+
+#endif
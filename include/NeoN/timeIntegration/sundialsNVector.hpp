@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#if NN_WITH_SUNDIALS
+
+#include <memory>
+#include <type_traits>
+
+#include <sundials/sundials_nvector.h>
+
+#include "NeoN/core/vector/vector.hpp"
+#include "NeoN/mesh/unstructured/unstructuredMesh.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include <mpi.h>
+#endif
+
+namespace NeoN::sundials
+{
+
+/**
+ * @brief The content of a NeoN N_Vector.
+ * @details The vector operations required by Sundials are implemented with NeoN's parallel
+ * primitives on the executor of the wrapped vector, thus the data never leaves the executor.
+ * The vector may be the rank local part of a distributed vector, then the dot products, norms and
+ * other reductions are reduced over the ranks of the communicator.
+ */
+struct NVectorContent
+{
+    Vector<scalar>* vector; /**< The wrapped vector. */
+    bool owning;            /**< Whether the N_Vector deletes the vector when destroyed. */
+#ifdef NF_WITH_MPI_SUPPORT
+    MPI_Comm comm = MPI_COMM_NULL; /**< The communicator of distributed vectors. */
+#endif
+};
+
+/**
+ * @brief Custom deleter for N_Vectors created by the functions below.
+ */
+struct NVectorDeleter
+{
+    void operator()(N_Vector v) const
+    {
+        if (v != nullptr)
+        {
+            N_VDestroy(v);
+        }
+    }
+};
+
+using NVectorPtr = std::unique_ptr<std::remove_pointer_t<N_Vector>, NVectorDeleter>;
+
+/**
+ * @brief Creates an N_Vector viewing the given vector without copying its data.
+ * @param vector The vector to wrap, has to outlive the N_Vector.
+ * @param context The SUNContext of the integrator.
+ * @return The N_Vector, clones created by Sundials own a vector on the same executor.
+ */
+N_Vector wrapVector(Vector<scalar>& vector, SUNContext context);
+
+/**
+ * @brief Creates an N_Vector viewing a vector of cell values of the given mesh.
+ * @details If the mesh is decomposed, the N_Vector is the rank local part of the distributed
+ * vector, thus the reductions are global over the ranks of the processor interface.
+ * @param vector The vector to wrap, has to outlive the N_Vector.
+ * @param context The SUNContext of the integrator.
+ * @param mesh The mesh of the vector.
+ */
+N_Vector wrapVector(Vector<scalar>& vector, SUNContext context, const UnstructuredMesh& mesh);
+
+/**
+ * @brief Creates an N_Vector owning a new vector.
+ * @param exec The executor of the new vector.
+ * @param size The size of the new vector.
+ * @param context The SUNContext of the integrator.
+ */
+N_Vector newVector(const Executor& exec, localIdx size, SUNContext context);
+
+/**
+ * @brief Points a non owning N_Vector to another vector, e.g. the solution field of the next step.
+ * @param v The N_Vector created by wrapVector.
+ * @param vector The vector to view, of the same size and executor as the previous vector.
+ */
+void rewrapVector(N_Vector v, Vector<scalar>& vector);
+
+/**
+ * @brief The vector viewed or owned by an N_Vector created by the functions above.
+ */
+Vector<scalar>& getVector(N_Vector v);
+
+/**
+ * @brief Sums a rank local value over the ranks the N_Vector is distributed on.
+ * @param v The N_Vector created by the functions above.
+ * @param value The rank local value.
+ * @return The sum, or the value itself if the N_Vector is not distributed.
+ */
+scalar sumOverRanks(N_Vector v, scalar value);
+
+}
+
+#endif
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <functional>
+#include <optional>
 
 #include "NeoN/fields/field.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
@@ -13,6 +14,15 @@
 namespace NeoN::timeIntegration
 {
 
+/* @brief Local error of the last step estimated by an embedded method.
+ * A norm below one means the error is within the tolerances of the integrator.
+ */
+struct ErrorEstimate
+{
+    scalar norm; /**< norm of the error weighted by the tolerances */
+    int order;   /**< order of the embedded method */
+};
+
 /* @class Factory class to create time integration method by a given name
  * using NeoNs runTimeFactory mechanism
  */
@@ -45,6 +55,9 @@ public:
 
     virtual bool explicitIntegration() const { return true; }
 
+    /* @brief Error estimate of the last step, empty if the method has no embedded estimate. */
+    virtual std::optional<ErrorEstimate> errorEstimate() const { return std::nullopt; }
+
 protected:
 
     const Dictionary& schemeDict_;
@@ -84,6 +97,11 @@ public:
 
     bool explicitIntegration() const { return timeIntegratorStrategy_->explicitIntegration(); }
 
+    std::optional<ErrorEstimate> errorEstimate() const
+    {
+        return timeIntegratorStrategy_->errorEstimate();
+    }
+
 private:
 
     std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> timeIntegratorStrategy_;
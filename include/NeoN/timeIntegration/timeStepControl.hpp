@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <optional>
+
+#include "NeoN/core/dictionary.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
+#include "NeoN/timeIntegration/timeIntegration.hpp"
+
+namespace NeoN::timeIntegration
+{
+
+/* @class TimeStepControl
+ * @brief Adaptive time step size controller based on a target maximum Courant number.
+ *
+ * The next time step size is dt * min(maxCo / Co, safety * error^(-1/(p + 1))), where Co is the
+ * maximum Courant number of the current face fluxes and the error term is only used if the
+ * integrator provides an embedded error estimate of order p. The factor is limited to
+ * [maxShrink, maxGrowth] and the resulting time step size to maxDeltaT. The controller only
+ * proposes the next time step size, steps are not rejected.
+ *
+ * The controller is configured by a dictionary with the following keys:
+ * - maxCo: the target maximum Courant number (required)
+ * - maxGrowth: upper limit of the change factor (default 1.2)
+ * - maxShrink: lower limit of the change factor (default 0.1)
+ * - maxDeltaT: upper limit of the time step size (default unlimited)
+ * - safetyFactor: safety factor of the error based change factor (default 0.9)
+ *
+ * Since it only depends on the face fluxes, the controller works with the native as well as the
+ * Sundials based integrators, which both take the time step size as argument of solve.
+ */
+class TimeStepControl
+{
+public:
+
+    TimeStepControl(const Dictionary& dict);
+
+    /* @brief Computes the next time step size.
+     * @param faceFlux The face fluxes of the current solution.
+     * @param dt The current time step size.
+     * @param error The error estimate of the last step, see TimeIntegration::errorEstimate.
+     * @return The next time step size.
+     */
+    scalar deltaT(
+        const finiteVolume::cellCentred::SurfaceField<scalar>& faceFlux,
+        scalar dt,
+        std::optional<ErrorEstimate> error = std::nullopt
+    ) const;
+
+    scalar maxCo() const { return maxCo_; }
+
+private:
+
+    scalar maxCo_;
+
+    scalar maxGrowth_;
+
+    scalar maxShrink_;
+
+    scalar maxDeltaT_;
+
+    scalar safetyFactor_;
+};
+
+} // namespace NeoN::timeIntegration
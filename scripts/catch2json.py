@@ -22,7 +22,10 @@ def parse_xml_dict(d):
             test_type = test_case_raw_name[-1]
         else:
             test_type = ""
-        for d in cases["Section"]:
+        sections = cases.get("Section", [])
+        if isinstance(sections, dict):
+            sections = [sections]
+        for d in sections:
             size = d["@name"]
             res = {}
             for k, v in d["BenchmarkResults"].items():
@@ -0,0 +1,139 @@
+# SPDX-FileCopyrightText: 2025 NeoN authors
+#
+# SPDX-License-Identifier: MIT
+
+"""Strong and weak scaling driver of bench_scaling.
+
+Runs the benchmark for every combination of MPI ranks and Kokkos threads, collects the rows the
+benchmark appends to scaling.csv and writes them together with the speedup and the parallel
+efficiency relative to the layout with the fewest workers. The efficiencies are also printed as
+one table per mode, size and executor.
+
+Example:
+    python3 scripts/scaling.py build/bin/benchmarks/bench_scaling --ranks 1 2 4 --threads 1 2 4
+"""
+
+import argparse
+import csv
+import os
+import subprocess
+import sys
+from collections import defaultdict
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("bench", help="path to bench_scaling")
+    parser.add_argument("--ranks", type=int, nargs="+", default=[1])
+    parser.add_argument("--threads", type=int, nargs="+", default=[1])
+    parser.add_argument(
+        "--modes", nargs="+", choices=["strong", "weak"], default=["strong", "weak"]
+    )
+    parser.add_argument("--executor", default="CPUExecutor", help="the executor section to run")
+    parser.add_argument("--size", help="the size section to run, i.e. cells per direction")
+    parser.add_argument("--samples", type=int, default=10, help="runs per kernel and layout")
+    parser.add_argument(
+        "--mpirun",
+        default="mpirun --bind-to none",
+        help="launcher of runs with more than one rank, -np <ranks> is appended",
+    )
+    parser.add_argument(
+        "--oversubscribe",
+        action="store_true",
+        help="also run layouts with more workers than cores",
+    )
+    parser.add_argument("--workdir", default=".", help="working directory of the benchmark")
+    parser.add_argument("--output", default="scaling_efficiency.csv")
+    return parser.parse_args()
+
+
+def run_layouts(args):
+    """runs the benchmark for every layout and returns the rows of scaling.csv"""
+    raw = os.path.join(args.workdir, "scaling.csv")
+    if os.path.exists(raw):
+        os.remove(raw)
+    env = dict(os.environ)
+    env.setdefault("OMP_PROC_BIND", "spread")
+    env.setdefault("OMP_PLACES", "threads")
+    for ranks in args.ranks:
+        for threads in args.threads:
+            if ranks * threads > os.cpu_count() and not args.oversubscribe:
+                print(
+                    f"skipping {ranks} ranks x {threads} threads, "
+                    f"which exceeds {os.cpu_count()} cores"
+                )
+                continue
+            cmd = args.mpirun.split() + ["-np", str(ranks)] if ranks > 1 else []
+            cmd += [
+                os.path.abspath(args.bench),
+                ",".join(f"Scaling::{mode}" for mode in args.modes),
+                "-c",
+                args.executor,
+            ]
+            if args.size:
+                cmd += ["-c", args.size]
+            cmd += [f"--benchmark-samples={args.samples}", f"--kokkos-num-threads={threads}"]
+            print(" ".join(cmd), flush=True)
+            subprocess.run(cmd, cwd=args.workdir, env=env, check=True, stdout=subprocess.DEVNULL)
+    if not os.path.exists(raw):
+        sys.exit("no results, check the executor and size sections")
+    with open(raw, "r") as fh:
+        return list(csv.DictReader(fh))
+
+
+def add_efficiencies(rows):
+    """adds the speedup and efficiency relative to the layout with the fewest workers
+
+    The strong speedup is t_1 / t_p, the weak efficiency is t_1 / t_p and the weak speedup is
+    the scaled speedup, i.e. the weak efficiency times the relative number of workers.
+    """
+    groups = defaultdict(list)
+    for row in rows:
+        groups[(row["mode"], row["size"], row["executor"], row["kernel"])].append(row)
+    for (mode, _, _, _), group in groups.items():
+        base = min(group, key=lambda r: (int(r["nWorkers"]), int(r["nRanks"])))
+        for row in group:
+            ratio = float(base["mean"]) / float(row["mean"])
+            workers = int(row["nWorkers"]) / int(base["nWorkers"])
+            if mode == "strong":
+                row["speedup"] = ratio
+                row["efficiency"] = ratio / workers
+            else:
+                row["speedup"] = ratio * workers
+                row["efficiency"] = ratio
+    return rows
+
+
+def print_tables(rows):
+    """prints the efficiency of every kernel and layout in percent"""
+    tables = defaultdict(dict)
+    for row in rows:
+        layout = (int(row["nWorkers"]), int(row["nRanks"]), int(row["nThreads"]))
+        key = (row["mode"], row["size"], row["executor"])
+        tables[key].setdefault(row["kernel"], {})[layout] = row["efficiency"]
+    for (mode, size, executor), kernels in tables.items():
+        layouts = sorted({layout for values in kernels.values() for layout in values})
+        names = [f"{ranks}x{threads}" for _, ranks, threads in layouts]
+        width = max(len(kernel) for kernel in kernels)
+        print(f"\n{mode} scaling, size {size}, {executor}, efficiency in % (ranks x threads)")
+        print(" " * width + "".join(f"{name:>10}" for name in names))
+        for kernel, values in kernels.items():
+            cells = [
+                f"{100.0 * values[layout]:>10.1f}" if layout in values else " " * 10
+                for layout in layouts
+            ]
+            print(f"{kernel:<{width}}" + "".join(cells))
+
+
+def main():
+    args = parse_args()
+    rows = add_efficiencies(run_layouts(args))
+    with open(args.output, "w", newline="") as fh:
+        writer = csv.DictWriter(fh, fieldnames=list(rows[0].keys()))
+        writer.writeheader()
+        writer.writerows(rows)
+    print_tables(rows)
+
+
+if __name__ == "__main__":
+    main()
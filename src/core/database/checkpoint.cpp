@@ -0,0 +1,519 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/core/database/checkpoint.hpp"
+#include "NeoN/core/database/fieldCollection.hpp"
+#include "NeoN/core/database/oldTimeCollection.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
+#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace detail
+{
+
+constexpr std::array<char, 8> magic {'N', 'E', 'O', 'N', 'C', 'K', 'P', 'T'};
+
+constexpr std::uint32_t formatVersion = 1;
+
+enum class FieldKind : std::uint8_t
+{
+    Volume,
+    Surface
+};
+
+enum class ValueKind : std::uint8_t
+{
+    Scalar,
+    Vec3
+};
+
+#ifdef KOKKOS_HAS_SHARED_HOST_PINNED_SPACE
+using PinnedSpace = Kokkos::SharedHostPinnedSpace;
+#else
+using PinnedSpace = Kokkos::HostSpace;
+#endif
+
+/* @brief the location of a vector in the staging buffer */
+struct StagedVector
+{
+    std::size_t offset;
+    std::uint64_t size;
+    std::size_t bytes;
+};
+
+/* @brief the staged internal and boundary values of a field */
+struct FieldSnapshot
+{
+    StagedVector internal;
+    StagedVector value;
+    StagedVector refValue;
+    StagedVector valueFraction;
+    StagedVector refGrad;
+};
+
+/* @brief The layout of the snapshot in the page-locked staging buffer and the copies into it.
+ *
+ * The copies are enqueued on the default instance of the execution space of every executor, thus
+ * device to host copies do not block the caller, and later kernels modifying the fields are
+ * ordered after them. Only the writer waits for them before it reads the buffer.
+ */
+struct Staging
+{
+    std::size_t size = 0;
+
+    std::vector<std::function<void(char*)>> copies;
+
+    std::vector<Executor> executors;
+
+    template<typename ValueType>
+    StagedVector add(const Vector<ValueType>& vec)
+    {
+        constexpr std::size_t alignment = alignof(std::max_align_t);
+        const std::size_t offset = (size + alignment - 1) / alignment * alignment;
+        const auto nElements = static_cast<std::size_t>(vec.size());
+        size = offset + nElements * sizeof(ValueType);
+        copies.push_back(
+            [&vec, offset, nElements](char* buffer)
+            {
+                Kokkos::View<ValueType*, PinnedSpace, Kokkos::MemoryUnmanaged> staged(
+                    reinterpret_cast<ValueType*>(buffer + offset), nElements
+                );
+                std::visit(
+                    [&](const auto& exec)
+                    {
+                        using ExecSpace = typename std::decay_t<decltype(exec)>::exec;
+                        Kokkos::deep_copy(
+                            ExecSpace(), staged, exec.createKokkosView(vec.data(), nElements)
+                        );
+                    },
+                    vec.exec()
+                );
+            }
+        );
+        if (std::find(executors.begin(), executors.end(), vec.exec()) == executors.end())
+        {
+            executors.push_back(vec.exec());
+        }
+        return {offset, static_cast<std::uint64_t>(nElements), nElements * sizeof(ValueType)};
+    }
+
+    void enqueueCopies(char* buffer) const
+    {
+        for (const auto& copy : copies)
+        {
+            copy(buffer);
+        }
+    }
+};
+
+/* @brief waits for the copies into the staging buffer enqueued by Staging */
+void fenceCopies(const std::vector<Executor>& executors)
+{
+    for (const auto& exec : executors)
+    {
+        std::visit(
+            [](const auto& concreteExec)
+            {
+                using ExecSpace = typename std::decay_t<decltype(concreteExec)>::exec;
+                ExecSpace().fence("Checkpoint::fenceCopies");
+            },
+            exec
+        );
+    }
+}
+
+/* @brief meta data stored in front of the values of every field */
+struct RecordHeader
+{
+    std::string collection;
+    std::string name;
+    // name of the field this field is the old time level of, empty for current fields
+    std::string parent;
+    std::int32_t level = 0;
+    FieldKind fieldKind = FieldKind::Volume;
+    ValueKind valueKind = ValueKind::Scalar;
+    std::int64_t timeIndex = 0;
+    std::int64_t iterationIndex = 0;
+    std::int64_t subCycleIndex = 0;
+};
+
+struct Record
+{
+    RecordHeader header;
+    FieldSnapshot data;
+};
+
+template<typename ValueType>
+FieldSnapshot snapshot(const DomainMixin<ValueType>& field, Staging& staging)
+{
+    const auto& bd = field.boundaryData();
+    return {
+        staging.add(field.internalVector()),
+        staging.add(bd.value()),
+        staging.add(bd.refValue()),
+        staging.add(bd.valueFraction()),
+        staging.add(bd.refGrad())
+    };
+}
+
+template<typename VectorType>
+bool tryAddRecord(
+    const VectorDocument& doc, RecordHeader header, std::vector<Record>& records, Staging& staging
+)
+{
+    if (!doc.doc().isType<VectorType>("field")) return false;
+    using ValueType = typename VectorType::VectorValueType;
+    header.fieldKind = std::is_same_v<VectorType, VolumeField<ValueType>> ? FieldKind::Volume
+                                                                           : FieldKind::Surface;
+    header.valueKind = std::is_same_v<ValueType, scalar> ? ValueKind::Scalar : ValueKind::Vec3;
+    records.push_back({std::move(header), snapshot(doc.field<VectorType>(), staging)});
+    return true;
+}
+
+/* @brief the records of all fields of the database and their layout in the staging buffer
+ *
+ * The records are ordered by collection and level, such that the field owning an old time level
+ * is restored before its old time levels.
+ */
+std::vector<Record> collectRecords(const Database& db, Staging& staging)
+{
+    std::vector<Record> records;
+    for (const auto& collectionName : db.keys())
+    {
+        if (db.at(collectionName).type() != VectorDocument::typeName()) continue;
+        const auto& collection = VectorCollection::instance(db, collectionName);
+
+        // maps the key of an old field to the key of the next newer field and its level
+        std::unordered_map<std::string, std::pair<std::string, std::int32_t>> oldFields;
+        if (db.contains(collectionName + "_oldTime"))
+        {
+            const auto& oldTimeCollection =
+                OldTimeCollection::instance(db, collectionName + "_oldTime");
+            for (const auto& key : oldTimeCollection.sortedKeys())
+            {
+                const auto& oldTimeDoc = oldTimeCollection.oldTimeDoc(key);
+                oldFields.emplace(
+                    oldTimeDoc.previousTime(),
+                    std::make_pair(oldTimeDoc.nextTime(), oldTimeDoc.level())
+                );
+            }
+        }
+
+        const auto begin = static_cast<std::ptrdiff_t>(records.size());
+        for (const auto& key : collection.sortedKeys())
+        {
+            const auto& doc = collection.fieldDoc(key);
+            RecordHeader header;
+            header.collection = collectionName;
+            header.name = doc.name();
+            header.timeIndex = doc.timeIndex();
+            header.iterationIndex = doc.iterationIndex();
+            header.subCycleIndex = doc.subCycleIndex();
+            if (auto oldField = oldFields.find(key); oldField != oldFields.end())
+            {
+                header.parent = collection.fieldDoc(oldField->second.first).name();
+                header.level = oldField->second.second;
+            }
+            bool added = tryAddRecord<VolumeField<scalar>>(doc, header, records, staging)
+                      || tryAddRecord<VolumeField<Vec3>>(doc, header, records, staging)
+                      || tryAddRecord<SurfaceField<scalar>>(doc, header, records, staging)
+                      || tryAddRecord<SurfaceField<Vec3>>(doc, header, records, staging);
+            if (!added)
+            {
+                NF_THROW(
+                    "Checkpoint: field " + doc.name() + " of collection " + collectionName
+                    + " has an unsupported type"
+                );
+            }
+        }
+        std::stable_sort(
+            records.begin() + begin,
+            records.end(),
+            [](const Record& a, const Record& b) { return a.header.level < b.header.level; }
+        );
+    }
+    return records;
+}
+
+template<typename T>
+void writeValue(std::ostream& out, const T& value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void writeString(std::ostream& out, const std::string& str)
+{
+    writeValue(out, static_cast<std::uint64_t>(str.size()));
+    out.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+void writeVector(std::ostream& out, const char* buffer, const StagedVector& vec)
+{
+    writeValue(out, vec.size);
+    out.write(buffer + vec.offset, static_cast<std::streamsize>(vec.bytes));
+}
+
+void writeRecords(
+    const std::vector<Record>& records, const char* buffer, const std::filesystem::path& file
+)
+{
+    auto tmpFile = file;
+    tmpFile += ".tmp";
+    {
+        std::ofstream out(tmpFile, std::ios::binary | std::ios::trunc);
+        if (!out) NF_THROW("Checkpoint: could not open " + tmpFile.string() + " for writing");
+
+        out.write(magic.data(), magic.size());
+        writeValue(out, formatVersion);
+        writeValue(out, static_cast<std::uint32_t>(sizeof(scalar)));
+        writeValue(out, static_cast<std::uint64_t>(records.size()));
+        for (const auto& [header, data] : records)
+        {
+            writeString(out, header.collection);
+            writeString(out, header.name);
+            writeString(out, header.parent);
+            writeValue(out, header.level);
+            writeValue(out, header.fieldKind);
+            writeValue(out, header.valueKind);
+            writeValue(out, header.timeIndex);
+            writeValue(out, header.iterationIndex);
+            writeValue(out, header.subCycleIndex);
+            writeVector(out, buffer, data.internal);
+            writeVector(out, buffer, data.value);
+            writeVector(out, buffer, data.refValue);
+            writeVector(out, buffer, data.valueFraction);
+            writeVector(out, buffer, data.refGrad);
+        }
+        out.close();
+        if (!out) NF_THROW("Checkpoint: writing " + tmpFile.string() + " failed");
+    }
+    std::filesystem::rename(tmpFile, file);
+}
+
+template<typename T>
+T readValue(std::istream& in)
+{
+    T value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!in) NF_THROW("Checkpoint: unexpected end of file");
+    return value;
+}
+
+std::string readString(std::istream& in)
+{
+    std::string str(readValue<std::uint64_t>(in), '\0');
+    in.read(str.data(), static_cast<std::streamsize>(str.size()));
+    if (!in) NF_THROW("Checkpoint: unexpected end of file");
+    return str;
+}
+
+RecordHeader readHeader(std::istream& in)
+{
+    RecordHeader header;
+    header.collection = readString(in);
+    header.name = readString(in);
+    header.parent = readString(in);
+    header.level = readValue<std::int32_t>(in);
+    header.fieldKind = readValue<FieldKind>(in);
+    header.valueKind = readValue<ValueKind>(in);
+    header.timeIndex = readValue<std::int64_t>(in);
+    header.iterationIndex = readValue<std::int64_t>(in);
+    header.subCycleIndex = readValue<std::int64_t>(in);
+    return header;
+}
+
+/* @brief reads the values into a new vector on the executor of target and swaps them in */
+template<typename ValueType>
+void readVector(std::istream& in, Vector<ValueType>& target, const std::string& fieldName)
+{
+    auto size = readValue<std::uint64_t>(in);
+    if (size != static_cast<std::uint64_t>(target.size()))
+    {
+        NF_THROW(
+            "Checkpoint: size of field " + fieldName + " does not match, expected "
+            + std::to_string(target.size()) + " but got " + std::to_string(size)
+        );
+    }
+    Vector<ValueType> hostVector(SerialExecutor {}, target.size());
+    in.read(
+        reinterpret_cast<char*>(hostVector.data()),
+        static_cast<std::streamsize>(size * sizeof(ValueType))
+    );
+    if (!in) NF_THROW("Checkpoint: unexpected end of file");
+    // copy into the existing allocation, thus views of the target stay valid
+    std::visit(
+        NeoN::detail::deepCopyVisitor(target.size(), hostVector.data(), target.data()),
+        hostVector.exec(),
+        target.exec()
+    );
+}
+
+template<typename VectorType>
+VectorType& lookup(VectorCollection& collection, const std::string& name)
+{
+    auto keys =
+        collection.find([&](const Document& doc) { return NeoN::name(doc) == name; });
+    if (keys.size() != 1)
+    {
+        NF_THROW(
+            "Checkpoint: field " + name + " is not registered in collection " + collection.name()
+        );
+    }
+    VectorDocument& doc = collection.fieldDoc(keys[0]);
+    if (!doc.doc().isType<VectorType>("field"))
+    {
+        NF_THROW("Checkpoint: field " + name + " is registered with a different type");
+    }
+    return doc.template field<VectorType>();
+}
+
+template<typename VectorType>
+void restoreField(std::istream& in, Database& db, const RecordHeader& header)
+{
+    auto& collection = VectorCollection::instance(db, header.collection);
+    VectorType& field = header.parent.empty()
+                          ? lookup<VectorType>(collection, header.name)
+                          : oldTime(lookup<VectorType>(collection, header.parent));
+    if (field.name != header.name)
+    {
+        NF_THROW("Checkpoint: old time field " + field.name + " does not match " + header.name);
+    }
+
+    auto& doc = collection.fieldDoc(field.key);
+    doc.timeIndex() = header.timeIndex;
+    doc.iterationIndex() = header.iterationIndex;
+    doc.subCycleIndex() = header.subCycleIndex;
+
+    auto& bd = field.boundaryData();
+    readVector(in, field.internalVector(), header.name);
+    readVector(in, bd.value(), header.name);
+    readVector(in, bd.refValue(), header.name);
+    readVector(in, bd.valueFraction(), header.name);
+    readVector(in, bd.refGrad(), header.name);
+}
+
+template<typename ValueType>
+void restore(std::istream& in, Database& db, const RecordHeader& header)
+{
+    switch (header.fieldKind)
+    {
+    case FieldKind::Volume:
+        restoreField<VolumeField<ValueType>>(in, db, header);
+        break;
+    case FieldKind::Surface:
+        restoreField<SurfaceField<ValueType>>(in, db, header);
+        break;
+    default:
+        NF_THROW("Checkpoint: unknown field kind of field " + header.name);
+    }
+}
+
+void PinnedHostDeleter::operator()(char* ptr) const { Kokkos::kokkos_free<PinnedSpace>(ptr); }
+
+} // namespace detail
+
+Checkpoint::~Checkpoint()
+{
+    if (!pendingWrite_.valid()) return;
+    try
+    {
+        pendingWrite_.get();
+    }
+    catch (...)
+    {
+        // destructors must not throw, call wait() to handle errors of the write
+    }
+}
+
+void Checkpoint::write(const Database& db, const std::filesystem::path& file)
+{
+    wait();
+    detail::Staging staging;
+    auto records = detail::collectRecords(db, staging);
+    if (staging.size > stagingSize_)
+    {
+        staging_.reset(static_cast<char*>(
+            Kokkos::kokkos_malloc<detail::PinnedSpace>("Checkpoint::staging", staging.size)
+        ));
+        stagingSize_ = staging.size;
+    }
+    staging.enqueueCopies(staging_.get());
+    pendingWrite_ = std::async(
+        std::launch::async,
+        [records = std::move(records),
+         executors = std::move(staging.executors),
+         buffer = staging_.get(),
+         file]()
+        {
+            detail::fenceCopies(executors);
+            detail::writeRecords(records, buffer, file);
+        }
+    );
+}
+
+void Checkpoint::wait()
+{
+    if (pendingWrite_.valid()) pendingWrite_.get();
+}
+
+void Checkpoint::read(Database& db, const std::filesystem::path& file)
+{
+    std::ifstream in(file, std::ios::binary);
+    if (!in) NF_THROW("Checkpoint: could not open " + file.string() + " for reading");
+
+    std::array<char, 8> fileMagic {};
+    in.read(fileMagic.data(), fileMagic.size());
+    if (!in || fileMagic != detail::magic)
+    {
+        NF_THROW("Checkpoint: " + file.string() + " is no checkpoint");
+    }
+    if (detail::readValue<std::uint32_t>(in) != detail::formatVersion)
+    {
+        NF_THROW("Checkpoint: unsupported version of " + file.string());
+    }
+    if (detail::readValue<std::uint32_t>(in) != sizeof(scalar))
+    {
+        NF_THROW("Checkpoint: " + file.string() + " was written with a different scalar type");
+    }
+
+    auto nRecords = detail::readValue<std::uint64_t>(in);
+    for (std::uint64_t i = 0; i < nRecords; i++)
+    {
+        auto header = detail::readHeader(in);
+        if (!db.contains(header.collection))
+        {
+            NF_THROW("Checkpoint: collection " + header.collection + " is not registered");
+        }
+        switch (header.valueKind)
+        {
+        case detail::ValueKind::Scalar:
+            detail::restore<scalar>(in, db, header);
+            break;
+        case detail::ValueKind::Vec3:
+            detail::restore<Vec3>(in, db, header);
+            break;
+        default:
+            NF_THROW("Checkpoint: unknown value type of field " + header.name);
+        }
+    }
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -7,6 +7,17 @@
 namespace NeoN::finiteVolume::cellCentred
 {
 
+namespace detail
+{
+
+std::size_t& nOldTimeRegistrations()
+{
+    static std::size_t nRegistrations = 0;
+    return nRegistrations;
+}
+
+}
+
 OldTimeDocument::OldTimeDocument(const Document& doc) : doc_(doc) {}
 
 OldTimeDocument::OldTimeDocument(
@@ -95,9 +106,12 @@ bool OldTimeCollection::insert(const OldTimeDocument& otd)
         return false;
     }
     docs_.emplace(id, otd);
+    detail::nOldTimeRegistrations()++;
     return true;
 }
 
+std::size_t OldTimeCollection::nRegistrations() { return detail::nOldTimeRegistrations(); }
+
 std::string OldTimeCollection::findNextTime(std::string id) const
 {
     auto keys = find([id](const Document& doc) { return doc.get<std::string>("nextTime") == id; });
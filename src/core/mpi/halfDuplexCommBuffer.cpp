@@ -2,6 +2,12 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <mutex>
+#include <unordered_map>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/core/mpi/halfDuplexCommBuffer.hpp"
 
 namespace NeoN
@@ -10,16 +16,134 @@ namespace NeoN
 namespace mpi
 {
 
-bool HalfDuplexCommBuffer::isComplete()
+#ifdef KOKKOS_HAS_SHARED_HOST_PINNED_SPACE
+using PinnedSpace = Kokkos::SharedHostPinnedSpace;
+#else
+using PinnedSpace = Kokkos::HostSpace;
+#endif
+
+int commTag(const std::string& commName)
+{
+    // There is also an MPI environment value for that, but somehow it doesn't work using that
+    // Also reserve 10 tags for other uses
+    constexpr int firstTag = 10;
+    constexpr int maxTagValue = 32767;
+    static std::mutex mutex;
+    static std::unordered_map<std::string, int> tags;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto [it, inserted] = tags.try_emplace(commName, firstTag + static_cast<int>(tags.size()));
+    if (inserted && it->second > maxTagValue)
+    {
+        NF_ERROR_EXIT("No free MPI tag for communication name: " << commName);
+    }
+    return it->second;
+}
+
+void CommBufferDeleter::operator()(char* ptr) const
+{
+    if (pinned)
+    {
+        Kokkos::kokkos_free<PinnedSpace>(ptr);
+        return;
+    }
+    std::visit([ptr](const auto& concreteExec) { concreteExec.free(ptr); }, exec);
+}
+
+bool HalfDuplexCommBuffer::isStaged() const
+{
+    return space_ == BufferSpace::Host && std::holds_alternative<GPUExecutor>(exec_);
+}
+
+char* HalfDuplexCommBuffer::commData()
+{
+    return isStaged() ? stageBuffer_.get() : rankBuffer_.get();
+}
+
+void HalfDuplexCommBuffer::reserve(std::size_t dataSize)
+{
+    rankBuffer_ = std::unique_ptr<char, CommBufferDeleter>(
+        static_cast<char*>(std::visit(
+            [dataSize](const auto& concreteExec) { return concreteExec.alloc(dataSize); }, exec_
+        )),
+        CommBufferDeleter {exec_, false}
+    );
+    if (isStaged())
+    {
+        stageBuffer_ = std::unique_ptr<char, CommBufferDeleter>(
+            static_cast<char*>(Kokkos::kokkos_malloc<PinnedSpace>("CommBuffer", dataSize)),
+            CommBufferDeleter {exec_, true}
+        );
+    }
+    capacity_ = dataSize;
+}
+
+HalfDuplexCommBuffer::~HalfDuplexCommBuffer()
+{
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (!finalized) freeRequests();
+}
+
+void HalfDuplexCommBuffer::freeRequests()
 {
-    NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
-    int flag;
     for (auto& request : request_)
     {
-        int err = MPI_Test(&request, &flag, MPI_STATUS_IGNORE);
-        NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Test failed.");
-        if (!flag) return false;
+        if (request != MPI_REQUEST_NULL) MPI_Request_free(&request);
     }
+    request_.clear();
+    requestTag_ = -1;
+}
+
+void HalfDuplexCommBuffer::startRequests(bool send)
+{
+    if (requestTag_ != tag_ || requestSend_ != send)
+    {
+        freeRequests();
+        request_.resize(neighbours_.size(), MPI_REQUEST_NULL);
+        for (size_t i = 0; i < neighbours_.size(); ++i)
+        {
+            auto rank = static_cast<size_t>(neighbours_[i]);
+            auto size = static_cast<mpi_label_t>(rankOffset_[rank + 1] - rankOffset_[rank]);
+            if (send)
+            {
+                sendInit<char>(
+                    commData() + rankOffset_[rank],
+                    size,
+                    neighbours_[i],
+                    tag_,
+                    mpiEnviron_.comm(),
+                    &request_[i]
+                );
+            }
+            else
+            {
+                recvInit<char>(
+                    commData() + rankOffset_[rank],
+                    size,
+                    neighbours_[i],
+                    tag_,
+                    mpiEnviron_.comm(),
+                    &request_[i]
+                );
+            }
+        }
+        requestTag_ = tag_;
+        requestSend_ = send;
+    }
+    if (request_.empty()) return;
+    int err = MPI_Startall(static_cast<int>(request_.size()), request_.data());
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Startall failed.");
+}
+
+bool HalfDuplexCommBuffer::isComplete()
+{
+    NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
+    // inactive persistent requests are complete
+    int flag = 1;
+    int err = MPI_Testall(
+        static_cast<int>(request_.size()), request_.data(), &flag, MPI_STATUSES_IGNORE
+    );
+    NF_DEBUG_ASSERT(err == MPI_SUCCESS, "MPI_Testall failed.");
     return static_cast<bool>(flag);
 }
 
@@ -27,36 +151,25 @@ void HalfDuplexCommBuffer::send()
 {
     NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
     NF_DEBUG_ASSERT(isComplete(), "Communication buffer is already active.");
-    for (size_t rank = 0; rank < mpiEnviron_.sizeRank(); ++rank)
+    if (isStaged())
     {
-        if (rankOffset_[rank + 1] - rankOffset_[rank] == 0) continue;
-        isend<char>(
-            rankBuffer_.data() + rankOffset_[rank],
-            static_cast<mpi_label_t>(rankOffset_[rank + 1] - rankOffset_[rank]),
-            static_cast<mpi_label_t>(rank),
-            tag_,
-            mpiEnviron_.comm(),
-            &request_[rank]
+        std::visit(
+            detail::deepCopyVisitor(
+                static_cast<localIdx>(rankOffset_.back()), rankBuffer_.get(), stageBuffer_.get()
+            ),
+            exec_,
+            Executor(SerialExecutor {})
         );
     }
+    startRequests(true);
 }
 
 void HalfDuplexCommBuffer::receive()
 {
     NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
     NF_DEBUG_ASSERT(isComplete(), "Communication buffer is already active.");
-    for (size_t rank = 0; rank < mpiEnviron_.sizeRank(); ++rank)
-    {
-        if (rankOffset_[rank + 1] - rankOffset_[rank] == 0) continue;
-        irecv<char>(
-            rankBuffer_.data() + rankOffset_[rank],
-            static_cast<mpi_label_t>(rankOffset_[rank + 1] - rankOffset_[rank]),
-            static_cast<mpi_label_t>(rank),
-            tag_,
-            mpiEnviron_.comm(),
-            &request_[rank]
-        );
-    }
+    receiving_ = true;
+    startRequests(false);
 }
 
 void HalfDuplexCommBuffer::waitComplete()
@@ -67,18 +180,26 @@ void HalfDuplexCommBuffer::waitComplete()
         // todo deadlock prevention.
         // wait for the communication to finish.
     }
+    if (receiving_ && isStaged())
+    {
+        std::visit(
+            detail::deepCopyVisitor(
+                static_cast<localIdx>(rankOffset_.back()), stageBuffer_.get(), rankBuffer_.get()
+            ),
+            Executor(SerialExecutor {}),
+            exec_
+        );
+    }
+    receiving_ = false;
 }
 
 void HalfDuplexCommBuffer::finaliseComm()
 {
     NF_DEBUG_ASSERT(isCommInit(), "Communication buffer is not initialised.");
     NF_DEBUG_ASSERT(isComplete(), "Cannot finalise while buffer is active.");
-    for (auto& request : request_)
-        NF_DEBUG_ASSERT(
-            request == MPI_REQUEST_NULL, "MPI_Request not null, communication not complete."
-        );
     tag_ = -1;
     commName_ = "unassigned";
+    receiving_ = false;
 }
 
 }
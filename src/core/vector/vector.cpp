@@ -127,6 +127,14 @@ void Vector<ValueType>::operator=(const Vector<ValueType>& rhs)
     setContainer(*this, rhs.view());
 }
 
+template<typename ValueType>
+void Vector<ValueType>::swap(Vector<ValueType>& rhs)
+{
+    NF_ASSERT(exec_ == rhs.exec_, "Executors are not the same");
+    std::swap(size_, rhs.size_);
+    std::swap(data_, rhs.data_);
+}
+
 template<typename ValueType>
 Vector<ValueType>& Vector<ValueType>::operator+=(const Vector<ValueType>& rhs)
 {
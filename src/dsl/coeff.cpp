@@ -18,7 +18,7 @@ Coeff::Coeff(scalar coeff, const Vector<scalar>& field)
 
 Coeff::Coeff(const Vector<scalar>& field) : coeff_(1.0), view_(field.view()), hasView_(true) {}
 
-bool Coeff::hasView() { return hasView_; }
+bool Coeff::hasView() const { return hasView_; }
 
 View<const scalar> Coeff::view() { return view_; }
 
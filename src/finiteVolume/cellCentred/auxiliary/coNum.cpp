@@ -2,16 +2,11 @@
 //
 // SPDX-License-Identifier: MIT
 
-#include <limits>
-
-#include "NeoN/core/info.hpp"
 #include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/finiteVolume/cellCentred/auxiliary/coNum.hpp"
-#include "NeoN/finiteVolume/cellCentred/boundary.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/surfaceField.hpp"
-#include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
-#include "NeoN/finiteVolume/cellCentred/boundary/volumeBoundaryFactory.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/cellToFaceStencil.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -20,63 +15,19 @@ std::pair<scalar, scalar> computeCoNum(const SurfaceField<scalar>& faceFlux, con
 {
     const UnstructuredMesh& mesh = faceFlux.mesh();
     const auto exec = faceFlux.exec();
-    VolumeField<scalar> phi(exec, "phi", mesh, createCalculatedBCs<VolumeBoundary<scalar>>(mesh));
-    fill(phi.internalVector(), 0.0);
-
-    const auto [surfFaceCells, volPhi, surfOwner, surfNeighbour, surfFaceFlux, surfV] = views(
-        mesh.boundaryMesh().faceCells(),
-        phi.internalVector(),
-        mesh.faceOwner(),
-        mesh.faceNeighbour(),
-        faceFlux.internalVector(),
-        mesh.cellVolumes()
-    );
+    const auto [surfFaceFlux, surfV] = views(faceFlux.internalVector(), mesh.cellVolumes());
     auto nInternalFaces = mesh.nInternalFaces();
 
-    scalar maxCoNum = std::numeric_limits<scalar>::lowest();
-    scalar meanCoNum = 0.0;
-    parallelFor(
-        exec,
-        {0, nInternalFaces},
-        KOKKOS_LAMBDA(const localIdx i) {
-            scalar flux = Kokkos::sqrt(surfFaceFlux[i] * surfFaceFlux[i]);
-            Kokkos::atomic_add(&volPhi[surfOwner[i]], flux);
-            Kokkos::atomic_add(&volPhi[surfNeighbour[i]], flux);
-        },
-        "computeCoNum::fluxInternal"
-    );
-
-    parallelFor(
-        exec,
-        {nInternalFaces, faceFlux.size()},
-        KOKKOS_LAMBDA(const localIdx i) {
-            auto own = surfFaceCells[i - nInternalFaces];
-            scalar flux = Kokkos::sqrt(surfFaceFlux[i] * surfFaceFlux[i]);
-            Kokkos::atomic_add(&volPhi[own], flux);
-        },
-        "computeCoNum::fluxBoundary"
-    );
-
-    phi.correctBoundaryConditions();
-
-    scalar maxValue {0.0};
-    Kokkos::Max<NeoN::scalar> maxReducer(maxValue);
-    parallelReduce(
-        exec,
-        {0, mesh.nCells()},
-        KOKKOS_LAMBDA(const localIdx celli, NeoN::scalar& lmax) {
-            NeoN::scalar val = (volPhi[celli] / surfV[celli]);
-            if (val > lmax) lmax = val;
-        },
-        maxReducer
-    );
-
+    // every internal face contributes to its owner and neighbour cell
     scalar totalPhi = 0.0;
     Kokkos::Sum<NeoN::scalar> sumPhi(totalPhi);
     parallelReduce(
         exec,
-        {0, mesh.nCells()},
-        KOKKOS_LAMBDA(const localIdx celli, scalar& lsum) { lsum += volPhi[celli]; },
+        {0, faceFlux.size()},
+        KOKKOS_LAMBDA(const localIdx facei, scalar& lsum) {
+            scalar flux = Kokkos::abs(surfFaceFlux[facei]);
+            lsum += facei < nInternalFaces ? 2.0 * flux : flux;
+        },
         sumPhi
     );
 
@@ -89,10 +40,38 @@ std::pair<scalar, scalar> computeCoNum(const SurfaceField<scalar>& faceFlux, con
         sumVol
     );
 
-    maxCoNum = maxReducer.reference() * 0.5 * dt;
-    meanCoNum = 0.5 * (sumPhi.reference() / sumVol.reference()) * dt;
+    scalar maxCoNum = computeMaxCoNum(faceFlux, dt);
+    scalar meanCoNum = 0.5 * (sumPhi.reference() / sumVol.reference()) * dt;
 
     return {maxCoNum, meanCoNum};
 }
 
+scalar computeMaxCoNum(const SurfaceField<scalar>& faceFlux, const scalar dt)
+{
+    const UnstructuredMesh& mesh = faceFlux.mesh();
+    const auto& stencil = CellToFaceStencil::readOrCreate(mesh);
+    const auto [cellFaces, segments, surfFaceFlux, surfV] = views(
+        stencil.values(), stencil.segments(), faceFlux.internalVector(), mesh.cellVolumes()
+    );
+
+    scalar maxValue {0.0};
+    Kokkos::Max<NeoN::scalar> maxReducer(maxValue);
+    parallelReduce(
+        faceFlux.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli, NeoN::scalar& lmax) {
+            scalar volPhi = 0.0;
+            for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+            {
+                volPhi += Kokkos::abs(surfFaceFlux[cellFaces[i]]);
+            }
+            NeoN::scalar val = volPhi / surfV[celli];
+            if (val > lmax) lmax = val;
+        },
+        maxReducer
+    );
+
+    return maxReducer.reference() * 0.5 * dt;
+}
+
 };
@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <limits>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/auxiliary/localTimeStep.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/cellToFaceStencil.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/geometryScheme.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace detail
+{
+
+/* @brief Computes the reciprocal local time step sizes, the diffusion limit is only applied if
+ * the face diffusivity is given, ie. gamma is not empty.
+ */
+void computeRDeltaT(
+    const UnstructuredMesh& mesh,
+    const SurfaceField<scalar>& faceFlux,
+    View<const scalar> gamma,
+    scalar maxCo,
+    scalar maxDi,
+    scalar maxDeltaT,
+    Vector<scalar>& rDeltaT
+)
+{
+    const auto& stencil = CellToFaceStencil::readOrCreate(mesh);
+    const auto geometryScheme = GeometryScheme::readOrCreate(mesh);
+    const auto [cellFaces, segments, flux, magSf, deltaCoeffs, vol, rDeltaTView] = views(
+        stencil.values(),
+        stencil.segments(),
+        faceFlux.internalVector(),
+        mesh.magFaceAreas(),
+        geometryScheme->nonOrthDeltaCoeffs().internalVector(),
+        mesh.cellVolumes(),
+        rDeltaT
+    );
+    const bool diffusion = gamma.size() > 0;
+    const scalar rMaxDeltaT = 1.0 / maxDeltaT;
+
+    parallelFor(
+        rDeltaT.exec(),
+        rDeltaT.range(),
+        KOKKOS_LAMBDA(const localIdx celli) {
+            scalar sumFlux = 0.0;
+            scalar sumDiffusion = 0.0;
+            for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+            {
+                const auto facei = cellFaces[i];
+                sumFlux += Kokkos::abs(flux[facei]);
+                if (diffusion)
+                {
+                    sumDiffusion += gamma[facei] * magSf[facei] * deltaCoeffs[facei];
+                }
+            }
+            scalar value = Kokkos::max(rMaxDeltaT, sumFlux / (2.0 * maxCo * vol[celli]));
+            rDeltaTView[celli] = Kokkos::max(value, sumDiffusion / (maxDi * vol[celli]));
+        },
+        "computeRDeltaT"
+    );
+}
+
+}
+
+LocalTimeStep::LocalTimeStep(const UnstructuredMesh& mesh, const Dictionary& dict)
+    : mesh_(mesh), maxCo_(dict.get<scalar>("maxCo")), maxDi_(1.0),
+      maxDeltaT_(std::numeric_limits<scalar>::max()), smoothingCoeff_(0.2), nSmoothingSweeps_(2),
+      rDeltaT_(mesh.exec(), mesh.nCells(), 0.0)
+{
+    if (dict.contains("maxDi"))
+    {
+        maxDi_ = dict.get<scalar>("maxDi");
+    }
+    if (dict.contains("maxDeltaT"))
+    {
+        maxDeltaT_ = dict.get<scalar>("maxDeltaT");
+    }
+    if (dict.contains("smoothingCoeff"))
+    {
+        smoothingCoeff_ = dict.get<scalar>("smoothingCoeff");
+    }
+    if (dict.contains("nSmoothingSweeps"))
+    {
+        nSmoothingSweeps_ = dict.get<label>("nSmoothingSweeps");
+    }
+    NF_ASSERT(maxCo_ > 0.0 && maxDi_ > 0.0, "maxCo and maxDi have to be positive.");
+    NF_ASSERT(smoothingCoeff_ >= 0.0, "smoothingCoeff must not be negative.");
+}
+
+void LocalTimeStep::update(const SurfaceField<scalar>& faceFlux)
+{
+    detail::computeRDeltaT(mesh_, faceFlux, {}, maxCo_, maxDi_, maxDeltaT_, rDeltaT_);
+    smooth();
+}
+
+void LocalTimeStep::update(const SurfaceField<scalar>& faceFlux, const SurfaceField<scalar>& gamma)
+{
+    detail::computeRDeltaT(
+        mesh_, faceFlux, gamma.internalVector().view(), maxCo_, maxDi_, maxDeltaT_, rDeltaT_
+    );
+    smooth();
+}
+
+void LocalTimeStep::smooth()
+{
+    if (nSmoothingSweeps_ <= 0) return;
+
+    // Jacobi sweeps over the internal faces, rDeltaT of a cell is at least the value of its
+    // neighbours divided by 1 + smoothingCoeff
+    const auto& stencil = CellToFaceStencil::readOrCreate(mesh_);
+    const scalar rRatio = 1.0 / (1.0 + smoothingCoeff_);
+    const auto nInternalFaces = mesh_.nInternalFaces();
+    Vector<scalar> previous(rDeltaT_.exec(), rDeltaT_.size());
+    for (label sweep = 0; sweep < nSmoothingSweeps_; sweep++)
+    {
+        previous = rDeltaT_;
+        const auto [cellFaces, segments, owner, neighbour, rDeltaTOld, rDeltaT] = views(
+            stencil.values(),
+            stencil.segments(),
+            mesh_.faceOwner(),
+            mesh_.faceNeighbour(),
+            previous,
+            rDeltaT_
+        );
+        parallelFor(
+            rDeltaT_.exec(),
+            rDeltaT_.range(),
+            KOKKOS_LAMBDA(const localIdx celli) {
+                scalar value = rDeltaTOld[celli];
+                for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+                {
+                    const auto facei = cellFaces[i];
+                    if (facei >= nInternalFaces) continue;
+                    const auto other = owner[facei] == celli ? neighbour[facei] : owner[facei];
+                    value = Kokkos::max(value, rRatio * rDeltaTOld[other]);
+                }
+                rDeltaT[celli] = value;
+            },
+            "LocalTimeStep::smooth"
+        );
+    }
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
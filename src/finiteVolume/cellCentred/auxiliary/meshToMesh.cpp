@@ -0,0 +1,349 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/auxiliary/meshToMesh.hpp"
+#include "NeoN/finiteVolume/cellCentred/postProcessing/monitor.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/cellToFaceStencil.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/meshSearch.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace detail
+{
+
+/* @brief uniformly distributed points in the box of the face centres of every cell in the range */
+Vector<Vec3> samplePoints(
+    const UnstructuredMesh& mesh, std::pair<localIdx, localIdx> range, localIdx nSamples
+)
+{
+    const auto& stencil = CellToFaceStencil::readOrCreate(mesh);
+    const auto [start, end] = range;
+    const localIdx nCellSamples = nSamples * nSamples * nSamples;
+    Vector<Vec3> samples(mesh.exec(), (end - start) * nCellSamples);
+    auto [sampleView, cellFaces, segments, faceCentres] =
+        views(samples, stencil.values(), stencil.segments(), mesh.faceCentres());
+    parallelFor(
+        mesh.exec(),
+        {start, end},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            BoundingBox box;
+            for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+            {
+                box.add(faceCentres[cellFaces[i]]);
+            }
+            const Vec3 delta = box.max - box.min;
+            auto next = (celli - start) * nCellSamples;
+            for (localIdx k = 0; k < nSamples; k++)
+            {
+                for (localIdx j = 0; j < nSamples; j++)
+                {
+                    for (localIdx i = 0; i < nSamples; i++)
+                    {
+                        sampleView[next++] = box.min
+                                           + Vec3(
+                                                 (i + 0.5) / nSamples * delta[0],
+                                                 (j + 0.5) / nSamples * delta[1],
+                                                 (k + 0.5) / nSamples * delta[2]
+                                           );
+                    }
+                }
+            }
+        },
+        "sampleCells"
+    );
+    return samples;
+}
+
+/* @brief The number of samples per direction which resolves the smallest source cell in the
+ * largest target cell, i.e. the cube root of their volume ratio rounded up and at least two.
+ *
+ * For nested uniform meshes this is the refinement ratio per direction, for which every sample
+ * represents the same volume of a single source cell.
+ */
+localIdx derivedSamples(const UnstructuredMesh& source, const UnstructuredMesh& target)
+{
+    const auto [sourceVolumes, targetVolumes] = views(source.cellVolumes(), target.cellVolumes());
+    scalar minSource {0.0};
+    Kokkos::Min<scalar> minReducer(minSource);
+    parallelReduce(
+        source.exec(),
+        {0, source.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli, scalar& lmin) {
+            if (sourceVolumes[celli] < lmin) lmin = sourceVolumes[celli];
+        },
+        minReducer
+    );
+    scalar maxTarget {0.0};
+    Kokkos::Max<scalar> maxReducer(maxTarget);
+    parallelReduce(
+        target.exec(),
+        {0, target.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli, scalar& lmax) {
+            if (targetVolumes[celli] > lmax) lmax = targetVolumes[celli];
+        },
+        maxReducer
+    );
+    // the tolerance avoids an additional sample for round-off in the volumes of nested meshes
+    const scalar ratio = std::cbrt(maxReducer.reference() / minReducer.reference());
+    const auto nSamples = std::max(2.0, std::ceil(ratio * (1.0 - 1e-6)));
+    if (nSamples > maxDerivedSamples)
+    {
+        NF_THROW(
+            "The volume ratio of the target and source cells requires more than "
+            + std::to_string(maxDerivedSamples)
+            + " samples per direction, set nSamples to map between these meshes."
+        );
+    }
+    return static_cast<localIdx>(nSamples);
+}
+
+}
+
+MeshToMesh::MeshToMesh(
+    const UnstructuredMesh& source, const UnstructuredMesh& target, const Dictionary& dict
+)
+    : source_(source), target_(target),
+      method_(dict.contains("method") ? dict.get<std::string>("method") : "conservative"),
+      nOutside_(0), sources_(target.exec(), 0, 0), weights_(target.exec(), 0)
+{
+    if (source.exec() != target.exec())
+    {
+        NF_THROW("The source and target mesh are on different executors.");
+    }
+
+    const auto nearest = findNearestCells(source, target.cellCentres());
+    const auto containing = findContainingCells(source, target.cellCentres());
+    const auto containingView = containing.view();
+    parallelReduce(
+        target.exec(),
+        {0, target.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli, localIdx& count) {
+            if (containingView[celli] < 0) count++;
+        },
+        nOutside_
+    );
+
+    if (method_ == "nearest")
+    {
+        computeNearest(nearest);
+    }
+    else if (method_ == "conservative")
+    {
+        const localIdx nSamples = dict.contains("nSamples")
+                                    ? dict.get<label>("nSamples")
+                                    : detail::derivedSamples(source, target);
+        const localIdx batchSize =
+            dict.contains("batchSize")
+                ? dict.get<label>("batchSize")
+                : std::max(localIdx(1), (1 << 21) / std::max(nSamples * nSamples * nSamples, 1));
+        if (nSamples < 1 || batchSize < 1)
+        {
+            NF_THROW("The number of samples and the batch size have to be positive.");
+        }
+        if (std::int64_t(nSamples) * nSamples * nSamples * batchSize
+            > std::numeric_limits<localIdx>::max())
+        {
+            NF_THROW("The number of samples per batch exceeds the range of localIdx.");
+        }
+        computeConservative(nearest, nSamples, batchSize);
+    }
+    else
+    {
+        NF_THROW("Unknown mapping method " + method_ + ", use nearest or conservative.");
+    }
+}
+
+void MeshToMesh::computeNearest(const Vector<localIdx>& nearest)
+{
+    Vector<localIdx> segments(target_.exec(), target_.nCells() + 1);
+    parallelFor(segments, KOKKOS_LAMBDA(const localIdx i) { return i; });
+    sources_ = SegmentedVector<localIdx, localIdx>(nearest, segments);
+    weights_ = Vector<scalar>(target_.exec(), target_.nCells(), 1.0);
+}
+
+void MeshToMesh::computeConservative(
+    const Vector<localIdx>& nearest, localIdx nSamples, localIdx batchSize
+)
+{
+    const auto exec = target_.exec();
+    const localIdx nCellSamples = nSamples * nSamples * nSamples;
+    const auto nearestView = nearest.view();
+
+    // the sources and weights of every batch, which are concatenated at the end
+    std::vector<SegmentedVector<localIdx, localIdx>> batchSources;
+    std::vector<Vector<scalar>> batchWeights;
+    Vector<localIdx> nEntries(exec, target_.nCells(), 0);
+    auto nEntriesView = nEntries.view();
+
+    for (localIdx start = 0; start < target_.nCells(); start += batchSize)
+    {
+        const localIdx end = std::min(start + batchSize, target_.nCells());
+        const auto samples = detail::samplePoints(target_, {start, end}, nSamples);
+        const auto inTarget = findContainingCells(target_, samples);
+        auto inSource = findContainingCells(source_, samples);
+        auto [inTargetView, inSourceView] = views(inTarget, inSource);
+
+        // samples outside of their target cell are discarded, multiple samples in the same
+        // source cell form a single entry
+        Vector<localIdx> counts(exec, end - start);
+        auto countView = counts.view();
+        parallelFor(
+            exec,
+            {start, end},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                const auto first = (celli - start) * nCellSamples;
+                localIdx nValid = 0;
+                localIdx nDistinct = 0;
+                for (auto k = first; k < first + nCellSamples; k++)
+                {
+                    if (inTargetView[k] != celli) inSourceView[k] = -1;
+                    if (inSourceView[k] < 0) continue;
+                    nValid++;
+                    bool distinct = true;
+                    for (auto j = first; j < k && distinct; j++)
+                    {
+                        distinct = inSourceView[j] != inSourceView[k];
+                    }
+                    if (distinct) nDistinct++;
+                }
+                // cells without valid samples fall back to the nearest source cell
+                countView[celli - start] = nValid > 0 ? nDistinct : 1;
+                nEntriesView[celli] = countView[celli - start];
+            },
+            "countMappingSources"
+        );
+
+        SegmentedVector<localIdx, localIdx> entries(counts);
+        Vector<scalar> weights(exec, entries.size());
+        auto [entryView, segments] = entries.views();
+        auto weightView = weights.view();
+        parallelFor(
+            exec,
+            {start, end},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                const auto first = (celli - start) * nCellSamples;
+                const auto last = first + nCellSamples;
+                auto next = segments[celli - start];
+                localIdx nValid = 0;
+                for (auto k = first; k < last; k++)
+                {
+                    if (inSourceView[k] >= 0) nValid++;
+                }
+                if (nValid == 0)
+                {
+                    entryView[next] = nearestView[celli];
+                    weightView[next] = 1.0;
+                    return;
+                }
+                for (auto k = first; k < last; k++)
+                {
+                    const auto sourcei = inSourceView[k];
+                    if (sourcei < 0) continue;
+                    bool distinct = true;
+                    for (auto j = first; j < k && distinct; j++)
+                    {
+                        distinct = inSourceView[j] != sourcei;
+                    }
+                    if (!distinct) continue;
+                    localIdx nHits = 0;
+                    for (auto j = k; j < last; j++)
+                    {
+                        if (inSourceView[j] == sourcei) nHits++;
+                    }
+                    entryView[next] = sourcei;
+                    weightView[next] = scalar(nHits) / scalar(nValid);
+                    next++;
+                }
+            },
+            "collectMappingSources"
+        );
+        batchSources.push_back(std::move(entries));
+        batchWeights.push_back(std::move(weights));
+    }
+
+    sources_ = SegmentedVector<localIdx, localIdx>(nEntries);
+    weights_ = Vector<scalar>(exec, sources_.size());
+    auto sourceView = sources_.views().first;
+    auto weightView = weights_.view();
+    localIdx offset = 0;
+    for (size_t batchi = 0; batchi < batchSources.size(); batchi++)
+    {
+        const auto& entries = batchSources[batchi];
+        auto [entryView, batchWeightView] = views(entries.values(), batchWeights[batchi]);
+        parallelFor(
+            exec,
+            {0, entries.size()},
+            KOKKOS_LAMBDA(const localIdx i) {
+                sourceView[offset + i] = entryView[i];
+                weightView[offset + i] = batchWeightView[i];
+            },
+            "concatenateMappingSources"
+        );
+        offset += entries.size();
+    }
+}
+
+template<typename ValueType>
+MappingStatistics
+MeshToMesh::map(const VolumeField<ValueType>& source, VolumeField<ValueType>& target) const
+{
+    NF_ASSERT(&source.mesh() == &source_, "The source field is not defined on the source mesh.");
+    NF_ASSERT(&target.mesh() == &target_, "The target field is not defined on the target mesh.");
+
+    auto [targetValues, sourceValues, cells, segments, weights] = views(
+        target.internalVector(),
+        source.internalVector(),
+        sources_.values(),
+        sources_.segments(),
+        weights_
+    );
+    parallelFor(
+        target.exec(),
+        {0, target_.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            ValueType value {};
+            for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+            {
+                value += weights[i] * sourceValues[cells[i]];
+            }
+            targetValues[celli] = value;
+        },
+        "mapMeshToMesh"
+    );
+    target.correctBoundaryConditions();
+
+    const auto sourceStatistics = volumeStatistics(source);
+    const auto targetStatistics = volumeStatistics(target);
+    const scalar scale =
+        sourceStatistics.volume
+        * std::max(std::abs(sourceStatistics.min), std::abs(sourceStatistics.max));
+    const scalar difference = mag(targetStatistics.weightedSum - sourceStatistics.weightedSum);
+
+    MappingStatistics statistics;
+    statistics.nOutside = nOutside_;
+    statistics.integralError = scale > 0.0 ? difference / scale : difference;
+    statistics.boundednessError = std::max(
+        {0.0,
+         targetStatistics.max - sourceStatistics.max,
+         sourceStatistics.min - targetStatistics.min}
+    );
+    return statistics;
+}
+
+template MappingStatistics
+MeshToMesh::map<scalar>(const VolumeField<scalar>&, VolumeField<scalar>&) const;
+template MappingStatistics
+MeshToMesh::map<Vec3>(const VolumeField<Vec3>&, VolumeField<Vec3>&) const;
+
+} // namespace NeoN::finiteVolume::cellCentred
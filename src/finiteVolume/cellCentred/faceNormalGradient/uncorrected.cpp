@@ -5,6 +5,7 @@
 #include <memory>
 
 #include "NeoN/finiteVolume/cellCentred/faceNormalGradient/uncorrected.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -32,6 +33,14 @@ void computeFaceNormalGrad(
 
     auto nInternalFaces = mesh.nInternalFaces();
 
+    // interior first: the processor faces are computed once the neighbour values arrived
+    auto procInterface = ProcessorInterface::read(mesh);
+    if (procInterface)
+    {
+        procInterface->startExchange(volVector.internalVector(), "computeFaceNormalGrad");
+    }
+    const auto procFaceStart = nInternalFaces + nPhysicalBoundaryFaces(mesh);
+
     NeoN::parallelFor(
         exec,
         {0, nInternalFaces},
@@ -43,7 +52,7 @@ void computeFaceNormalGrad(
 
     NeoN::parallelFor(
         exec,
-        {nInternalFaces, phif.size()},
+        {nInternalFaces, procFaceStart},
         KOKKOS_LAMBDA(const localIdx facei) {
             auto faceBCI = facei - nInternalFaces;
             auto own = surfFaceCells[faceBCI];
@@ -52,6 +61,24 @@ void computeFaceNormalGrad(
         },
         "computeFaceNormalGradBoundary"
     );
+
+    if (procInterface)
+    {
+        const auto& nbrValues =
+            procInterface->finishExchange(volVector.internalVector(), "computeFaceNormalGrad");
+        auto nbrV = nbrValues.view();
+        NeoN::parallelFor(
+            exec,
+            {procFaceStart, phif.size()},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                auto faceBCI = facei - nInternalFaces;
+                auto own = surfFaceCells[faceBCI];
+
+                phif[facei] = nonOrthDeltaCoeffs[facei] * (nbrV[faceBCI] - phi[own]);
+            },
+            "computeFaceNormalGradProcessor"
+        );
+    }
 }
 
 #define NF_DECLARE_COMPUTE_IMP_FNG(TYPENAME)                                                       \
@@ -2,9 +2,12 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
+
 #include "NeoN/core/vector/vectorFreeFunctions.hpp"
 #include "NeoN/core/macros.hpp"
 #include "NeoN/finiteVolume/cellCentred/fields/volumeField.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -92,10 +95,43 @@ VolumeField<ValueType>& VolumeField<ValueType>::operator-=(const ValueType rhs)
 template<typename ValueType>
 void VolumeField<ValueType>::correctBoundaryConditions()
 {
+    // the processor patches are updated collectively while the other patches are corrected
+    auto procInterface = ProcessorInterface::read(this->mesh());
+    if (procInterface)
+    {
+        procInterface->startExchange(this->internalVector(), "correctBoundaryConditions");
+    }
+
+    // boundary conditions with fixed coefficients rewrite the same coefficients, thus the boundary
+    // version only changes if the boundary data was modified since the last correction. The
+    // processor values change with the cell values and are tracked by the version of the field.
+    const bool fixedCoefficients = this->boundaryVersion() == correctedBoundaryVersion_
+                                && std::all_of(
+                                       boundaryConditions_.begin(),
+                                       boundaryConditions_.end(),
+                                       [](const auto& boundaryCondition)
+                                       { return boundaryCondition.attributes().fixedCoefficients; }
+                                );
+    if (fixedCoefficients)
+    {
+        this->markInternalModified();
+    }
+    else
+    {
+        this->markModified();
+    }
     for (auto& boundaryCondition : boundaryConditions_)
     {
         boundaryCondition.correctBoundaryCondition(this->field_);
     }
+    correctedBoundaryVersion_ = this->boundaryVersion();
+
+    if (procInterface)
+    {
+        procInterface->finishExchange(
+            this->internalVector(), this->field_.boundaryData().value(), "correctBoundaryConditions"
+        );
+    }
 }
 
 #define NN_DECLARE_FIELD(TYPENAME) template class VolumeField<TYPENAME>
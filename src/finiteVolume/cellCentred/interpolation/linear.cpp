@@ -6,6 +6,7 @@
 
 #include "NeoN/finiteVolume/cellCentred/interpolation/linear.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -18,19 +19,29 @@ void computeLinearInterpolation(
 )
 {
     const auto exec = dst.exec();
+    const auto& mesh = dst.mesh();
     auto dstS = dst.internalVector().view();
+    auto nInternalFaces = mesh.nInternalFaces();
+
+    // interior first: the processor faces are computed once the neighbour values arrived
+    auto procInterface = ProcessorInterface::read(mesh);
+    if (procInterface)
+    {
+        procInterface->startExchange(src.internalVector(), "computeLinearInterpolation");
+    }
+    const auto procFaceStart = nInternalFaces + nPhysicalBoundaryFaces(mesh);
+
     const auto [srcS, weightS, ownerS, neighS, boundS] = views(
         src.internalVector(),
         weights.internalVector(),
-        dst.mesh().faceOwner(),
-        dst.mesh().faceNeighbour(),
+        mesh.faceOwner(),
+        mesh.faceNeighbour(),
         src.boundaryData().value()
     );
-    auto nInternalFaces = dst.mesh().nInternalFaces();
 
     NeoN::parallelFor(
         exec,
-        {0, dstS.size()},
+        {0, procFaceStart},
         KOKKOS_LAMBDA(const localIdx facei) {
             if (facei < nInternalFaces)
             {
@@ -45,6 +56,23 @@ void computeLinearInterpolation(
         },
         "computeLinearInterpolation"
     );
+
+    if (procInterface)
+    {
+        const auto& nbrValues =
+            procInterface->finishExchange(src.internalVector(), "computeLinearInterpolation");
+        const auto [nbrS, faceCells] = views(nbrValues, mesh.boundaryMesh().faceCells());
+        NeoN::parallelFor(
+            exec,
+            {procFaceStart, dstS.size()},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                auto bcfacei = facei - nInternalFaces;
+                dstS[facei] = weightS[facei] * srcS[faceCells[bcfacei]]
+                            + (1 - weightS[facei]) * nbrS[bcfacei];
+            },
+            "computeLinearInterpolationProcessor"
+        );
+    }
 }
 
 #define NF_DECLARE_COMPUTE_IMP_LIN_INT(TYPENAME)                                                   \
@@ -6,6 +6,7 @@
 
 #include "NeoN/finiteVolume/cellCentred/interpolation/upwind.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -19,20 +20,30 @@ void computeUpwindInterpolation(
 )
 {
     const auto exec = dst.exec();
+    const auto& mesh = dst.mesh();
     auto dstS = dst.internalVector().view();
+    auto nInternalFaces = mesh.nInternalFaces();
+
+    // interior first: the processor faces are computed once the neighbour values arrived
+    auto procInterface = ProcessorInterface::read(mesh);
+    if (procInterface)
+    {
+        procInterface->startExchange(src.internalVector(), "computeUpwindInterpolation");
+    }
+    const auto procFaceStart = nInternalFaces + nPhysicalBoundaryFaces(mesh);
+
     const auto [srcS, weightS, ownerS, neighS, boundS, fluxS] = views(
         src.internalVector(),
         weights.internalVector(),
-        dst.mesh().faceOwner(),
-        dst.mesh().faceNeighbour(),
+        mesh.faceOwner(),
+        mesh.faceNeighbour(),
         src.boundaryData().value(),
         flux.internalVector()
     );
-    auto nInternalFaces = dst.mesh().nInternalFaces();
 
     parallelFor(
         exec,
-        {0, dstS.size()},
+        {0, procFaceStart},
         KOKKOS_LAMBDA(const localIdx facei) {
             if (facei < nInternalFaces)
             {
@@ -54,6 +65,22 @@ void computeUpwindInterpolation(
         },
         "computeUpwindInterpolation"
     );
+
+    if (procInterface)
+    {
+        const auto& nbrValues =
+            procInterface->finishExchange(src.internalVector(), "computeUpwindInterpolation");
+        const auto [nbrS, faceCells] = views(nbrValues, mesh.boundaryMesh().faceCells());
+        parallelFor(
+            exec,
+            {procFaceStart, dstS.size()},
+            KOKKOS_LAMBDA(const localIdx facei) {
+                auto bcfacei = facei - nInternalFaces;
+                dstS[facei] = fluxS[facei] >= 0 ? srcS[faceCells[bcfacei]] : nbrS[bcfacei];
+            },
+            "computeUpwindInterpolationProcessor"
+        );
+    }
 }
 
 
@@ -73,6 +100,7 @@ void computeUpwindInterpolationWeights(
         flux.internalVector()
     );
     auto nInternalFaces = src.mesh().nInternalFaces();
+    const auto procFaceStart = nInternalFaces + nPhysicalBoundaryFaces(src.mesh());
 
     parallelFor(
         exec,
@@ -84,9 +112,11 @@ void computeUpwindInterpolationWeights(
             }
             else
             {
+                // processor faces are upwinded like internal faces
                 auto bcfacei = facei - nInternalFaces;
-                weightB[bcfacei] = 1.0;
-                weightS[facei] = 1.0;
+                scalar weight = (facei < procFaceStart || fluxS[facei] >= 0) ? 1.0 : 0.0;
+                weightB[bcfacei] = weight;
+                weightS[facei] = weight;
             }
         },
         "computeUpwindInterpolation"
@@ -10,6 +10,56 @@
 namespace NeoN::finiteVolume::cellCentred
 {
 
+namespace detail
+{
+
+template<typename ValueType, typename RDeltaTType>
+void computeDdtExp(
+    const Executor& exec,
+    View<ValueType> source,
+    View<const ValueType> field,
+    View<const ValueType> oldVector,
+    View<const scalar> vol,
+    const RDeltaTType dtInver
+)
+{
+    parallelFor(
+        exec,
+        {0, source.size()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            source[celli] += dtInver[celli] * (field[celli] - oldVector[celli]) * vol[celli];
+        },
+        "ddtOpertator::explicitOperation"
+    );
+}
+
+template<typename ValueType, typename CoeffType, typename RDeltaTType>
+void computeDdtImp(
+    la::LinearSystemView<ValueType, localIdx> ls,
+    const Executor& exec,
+    View<const uint8_t> diagOffs,
+    View<const ValueType> oldVector,
+    View<const scalar> vol,
+    const CoeffType operatorScaling,
+    const RDeltaTType dtInver
+)
+{
+    auto [matrix, rhs] = ls;
+    parallelFor(
+        exec,
+        {0, oldVector.size()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            const auto idx = matrix.rowOffs[celli] + diagOffs[celli];
+            const auto commonCoef = operatorScaling[celli] * vol[celli] * dtInver[celli];
+            matrix.values[idx] += commonCoef * one<ValueType>();
+            rhs[celli] += commonCoef * oldVector[celli];
+        },
+        "ddtOpertator::implicitOperation"
+    );
+}
+
+}
+
 template<typename ValueType>
 DdtOperator<ValueType>::~DdtOperator()
 {}
@@ -17,23 +67,32 @@ DdtOperator<ValueType>::~DdtOperator()
 template<typename ValueType>
 DdtOperator<ValueType>::DdtOperator(dsl::Operator::Type termType, VolumeField<ValueType>& field)
     : dsl::OperatorMixin<VolumeField<ValueType>>(field.exec(), dsl::Coeff(1.0), field, termType),
-      sparsityPattern_(la::SparsityPattern::readOrCreate(field.mesh())) {};
+      sparsityPattern_(la::SparsityPattern::readOrCreate(field.mesh())), localTimeStep_(false),
+      rDeltaT_() {};
+
+template<typename ValueType>
+DdtOperator<ValueType>::DdtOperator(
+    dsl::Operator::Type termType, VolumeField<ValueType>& field, const Vector<scalar>& rDeltaT
+)
+    : dsl::OperatorMixin<VolumeField<ValueType>>(field.exec(), dsl::Coeff(1.0), field, termType),
+      sparsityPattern_(la::SparsityPattern::readOrCreate(field.mesh())), localTimeStep_(true),
+      rDeltaT_(rDeltaT)
+{
+    NF_ASSERT_EQUAL(rDeltaT.size(), field.internalVector().size());
+    NF_ASSERT(rDeltaT.exec() == field.exec(), "Executors are not the same.");
+};
 
 template<typename ValueType>
 void DdtOperator<ValueType>::explicitOperation(Vector<ValueType>& source, scalar, scalar dt) const
 {
-    const scalar dtInver = 1.0 / dt;
+    const auto dtInver = rDeltaT(dt);
     const auto vol = this->getVector().mesh().cellVolumes().view();
     auto [sourceView, field, oldVector] =
         views(source, this->field_.internalVector(), oldTime(this->field_).internalVector());
 
-    parallelFor(
-        source.exec(),
-        source.range(),
-        KOKKOS_LAMBDA(const localIdx celli) {
-            sourceView[celli] += dtInver * (field[celli] - oldVector[celli]) * vol[celli];
-        },
-        "ddtOpertator::explicitOperation"
+    dtInver.visit(
+        [&](const auto rDeltaT)
+        { detail::computeDdtExp(source.exec(), sourceView, field, oldVector, vol, rDeltaT); }
     );
 }
 
@@ -42,26 +101,40 @@ void DdtOperator<ValueType>::implicitOperation(
     la::LinearSystem<ValueType, localIdx>& ls, scalar, scalar dt
 ) const
 {
-    const scalar dtInver = 1.0 / dt;
+    const auto dtInver = rDeltaT(dt);
     const auto vol = this->getVector().mesh().cellVolumes().view();
     const auto operatorScaling = this->getCoefficient();
     const auto [diagOffs, oldVector] =
         views(getSparsityPattern().diagOffset(), oldTime(this->field_).internalVector());
-    auto [matrix, rhs] = ls.view();
+    auto lsView = ls.view();
 
-    parallelFor(
-        ls.exec(),
-        {0, oldVector.size()},
-        KOKKOS_LAMBDA(const localIdx celli) {
-            const auto idx = matrix.rowOffs[celli] + diagOffs[celli];
-            const auto commonCoef = operatorScaling[celli] * vol[celli] * dtInver;
-            matrix.values[idx] += commonCoef * one<ValueType>();
-            rhs[celli] += commonCoef * oldVector[celli];
-        },
-        "ddtOpertator::implicitOperation"
+    // the coefficients are dispatched onto their compile time variants, e.g. a uniform rDeltaT
+    operatorScaling.visit(
+        [&](const auto coeff)
+        {
+            dtInver.visit(
+                [&](const auto rDeltaT)
+                {
+                    detail::computeDdtImp(
+                        lsView, ls.exec(), diagOffs, oldVector, vol, coeff, rDeltaT
+                    );
+                }
+            );
+        }
     );
 }
 
+template<typename ValueType>
+std::optional<dsl::DependencySignature>
+DdtOperator<ValueType>::dependencySignature(scalar, scalar dt) const
+{
+    dsl::DependencySignature signature;
+    if (localTimeStep_ || !signature.add(this->getCoefficient())) return std::nullopt;
+    const auto& oldField = oldTime(this->field_);
+    signature.add(dt).add(&oldField, oldField.version());
+    return signature;
+}
+
 // instantiate the template class
 template class DdtOperator<scalar>;
 template class DdtOperator<Vec3>;
@@ -0,0 +1,324 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/operators/fusedAssembly.hpp"
+#include "NeoN/linearAlgebra/sparsityPattern.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace detail
+{
+
+/* @brief The views of a GaussGreenTerm accessed by the fused kernels, CoeffType is either
+ * dsl::Coeff or one of its compile time variants.
+ */
+template<typename CoeffType>
+struct GaussGreenTermView
+{
+    bool isDiv;
+
+    CoeffType operatorScaling;
+
+    View<const scalar> faceCoeffs;
+
+    /* interpolation weights of a divergence, delta coefficients of a laplacian */
+    View<const scalar> weights;
+
+    /* boundary interpolation weights of a divergence */
+    View<const scalar> boundaryWeights;
+};
+
+/* @brief A fixed size set of terms, which can be captured by the kernels. */
+template<typename CoeffType>
+struct GaussGreenTermViews
+{
+    GaussGreenTermView<CoeffType> terms[maxFusedGaussGreenTerms];
+
+    int nTerms;
+};
+
+/* @brief the value of a coefficient without a view, i.e. a UnitCoeff or UniformCoeff */
+std::optional<scalar> uniformValue(const dsl::Coeff& coeff)
+{
+    std::optional<scalar> result;
+    coeff.visit(
+        [&](const auto variant)
+        {
+            using Variant = std::decay_t<decltype(variant)>;
+            if constexpr (std::is_same_v<Variant, dsl::detail::UnitCoeff>)
+            {
+                result = 1.0;
+            }
+            else if constexpr (std::is_same_v<Variant, dsl::detail::UniformCoeff>)
+            {
+                result = variant.value;
+            }
+        }
+    );
+    return result;
+}
+
+/* @brief the views of the terms, toCoeff converts the operator scaling to CoeffType */
+template<typename CoeffType, typename ValueType, typename ToCoeff>
+GaussGreenTermViews<CoeffType>
+termViews(std::span<const GaussGreenTerm<ValueType>* const> terms, ToCoeff toCoeff)
+{
+    using Kind = typename GaussGreenTerm<ValueType>::Kind;
+    GaussGreenTermViews<CoeffType> result {};
+    result.nTerms = static_cast<int>(terms.size());
+    for (std::size_t i = 0; i < terms.size(); i++)
+    {
+        const auto& term = *terms[i];
+        auto& termView = result.terms[i];
+        termView.isDiv = term.kind == Kind::Div;
+        termView.operatorScaling = toCoeff(term.operatorScaling);
+        termView.faceCoeffs = term.faceCoeffs.internalVector().view();
+        if (termView.isDiv)
+        {
+            termView.weights = term.weights->internalVector().view();
+            termView.boundaryWeights = term.weights->boundaryData().value().view();
+        }
+        else
+        {
+            termView.weights = term.deltaCoeffs->internalVector().view();
+        }
+    }
+    return result;
+}
+
+template<typename ValueType, typename CoeffType>
+void assembleFused(
+    la::LinearSystem<ValueType, localIdx>& ls,
+    const VolumeField<ValueType>& phi,
+    const GaussGreenTermViews<CoeffType> fused
+)
+{
+    const UnstructuredMesh& mesh = phi.mesh();
+    const auto& sparsityPattern = la::SparsityPattern::readOrCreate(mesh);
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto nFaces = nInternalFaces + mesh.nBoundaryFaces();
+    const auto procFaceStart = nInternalFaces + nPhysicalBoundaryFaces(mesh);
+    const auto exec = phi.exec();
+
+    const auto [owner, neighbour, surfFaceCells, diagOffs, ownOffs, neiOffs, magFaceArea] = views(
+        mesh.faceOwner(),
+        mesh.faceNeighbour(),
+        mesh.boundaryMesh().faceCells(),
+        sparsityPattern.diagOffset(),
+        sparsityPattern.ownerOffset(),
+        sparsityPattern.neighbourOffset(),
+        mesh.magFaceAreas()
+    );
+    auto [matrix, rhs] = ls.view();
+
+    parallelFor(
+        exec,
+        {0, nInternalFaces},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            auto own = owner[facei];
+            auto nei = neighbour[facei];
+
+            auto valueOwn = zero<ValueType>();
+            auto valueNei = zero<ValueType>();
+            auto diagOwn = zero<ValueType>();
+            auto diagNei = zero<ValueType>();
+            for (int termi = 0; termi < fused.nTerms; termi++)
+            {
+                const auto& term = fused.terms[termi];
+                const auto operatorScalingOwn = term.operatorScaling[own];
+                const auto operatorScalingNei = term.operatorScaling[nei];
+                scalar coeffOwn;
+                scalar coeffNei;
+                if (term.isDiv)
+                {
+                    auto flux = term.faceCoeffs[facei];
+                    auto weight = term.weights[facei];
+                    coeffOwn = flux * (1 - weight);
+                    coeffNei = -weight * flux;
+                }
+                else
+                {
+                    coeffOwn = term.weights[facei] * term.faceCoeffs[facei] * magFaceArea[facei];
+                    coeffNei = coeffOwn;
+                }
+                valueOwn += coeffOwn * one<ValueType>() * operatorScalingOwn;
+                valueNei += coeffNei * one<ValueType>() * operatorScalingNei;
+                diagOwn -= coeffNei * one<ValueType>() * operatorScalingOwn;
+                diagNei -= coeffOwn * one<ValueType>() * operatorScalingNei;
+            }
+
+            auto rowOwnStart = matrix.rowOffs[own];
+            auto rowNeiStart = matrix.rowOffs[nei];
+            matrix.values[rowOwnStart + ownOffs[facei]] += valueOwn;
+            matrix.values[rowNeiStart + neiOffs[facei]] += valueNei;
+            Kokkos::atomic_add(&matrix.values[rowOwnStart + diagOffs[own]], diagOwn);
+            Kokkos::atomic_add(&matrix.values[rowNeiStart + diagOffs[nei]], diagNei);
+        },
+        "fusedGaussGreenInternalCoefficients"
+    );
+
+    auto [refGradient, value, valueFraction, refValue, boundaryDeltaCoeffs] = views(
+        phi.boundaryData().refGrad(),
+        phi.boundaryData().value(),
+        phi.boundaryData().valueFraction(),
+        phi.boundaryData().refValue(),
+        mesh.boundaryMesh().deltaCoeffs()
+    );
+
+    auto& bcCoeffs =
+        ls.auxiliaryCoefficients().template get<la::BoundaryCoefficients<ValueType, localIdx>>(
+            "boundaryCoefficients"
+        );
+    auto [boundValues, rhsBoundValues] = views(bcCoeffs.matrixValues, bcCoeffs.rhsValues);
+
+    // physical boundary faces and processor faces, whose neighbour cell is lagged, the
+    // coefficients of every term are the same as the ones of computeDivImp and
+    // computeLaplacianImpl
+    parallelFor(
+        exec,
+        {nInternalFaces, nFaces},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            auto bcfacei = facei - nInternalFaces;
+            auto own = surfFaceCells[bcfacei];
+            const bool procFace = facei >= procFaceStart;
+
+            auto diag = zero<ValueType>();
+            auto stored = zero<ValueType>();
+            auto valueRhs = zero<ValueType>();
+            for (int termi = 0; termi < fused.nTerms; termi++)
+            {
+                const auto& term = fused.terms[termi];
+                const auto operatorScalingOwn = term.operatorScaling[own];
+                const auto faceCoeff = term.faceCoeffs[facei];
+                if (term.isDiv && procFace)
+                {
+                    auto flux = faceCoeff * operatorScalingOwn;
+                    auto weight = term.boundaryWeights[bcfacei];
+                    diag += weight * flux * one<ValueType>();
+                    stored += (1 - weight) * flux * one<ValueType>();
+                    valueRhs += (1 - weight) * flux * value[bcfacei];
+                }
+                else if (term.isDiv)
+                {
+                    auto flux = term.boundaryWeights[bcfacei] * faceCoeff;
+                    auto valFrac1 = valueFraction[bcfacei];
+                    auto valFrac2 = 1.0 - valFrac1;
+                    auto valueMat = flux * operatorScalingOwn * valFrac2 * one<ValueType>();
+                    diag += valueMat;
+                    stored += valueMat;
+                    valueRhs +=
+                        (flux * operatorScalingOwn * (valFrac1 * refValue[bcfacei]))
+                        + valFrac2 * refGradient[bcfacei] * (1 / boundaryDeltaCoeffs[bcfacei]);
+                }
+                else if (procFace)
+                {
+                    auto flux = term.weights[facei] * faceCoeff * magFaceArea[facei]
+                              * operatorScalingOwn;
+                    diag -= flux * one<ValueType>();
+                    stored += flux * one<ValueType>();
+                    valueRhs += flux * value[bcfacei];
+                }
+                else
+                {
+                    auto flux = faceCoeff * magFaceArea[facei];
+                    auto deltaCoeff = term.weights[facei];
+                    auto valueMat = flux * operatorScalingOwn * valueFraction[bcfacei] * deltaCoeff
+                             * one<ValueType>();
+                    diag -= valueMat;
+                    stored += valueMat;
+                    valueRhs += flux * operatorScalingOwn
+                              * (valueFraction[bcfacei] * deltaCoeff * refValue[bcfacei]
+                                 + (1.0 - valueFraction[bcfacei]) * refGradient[bcfacei]);
+                }
+            }
+
+            Kokkos::atomic_add(&matrix.values[matrix.rowOffs[own] + diagOffs[own]], diag);
+            Kokkos::atomic_sub(&rhs[own], valueRhs);
+            boundValues[bcfacei] += stored;
+            rhsBoundValues[bcfacei] += valueRhs;
+        },
+        "fusedGaussGreenBoundaryCoefficients"
+    );
+}
+
+/* @brief Assembles the terms with a uniform scaling, the common case, with the compile time
+ * variant UniformCoeff, which avoids the branch of dsl::Coeff::operator[] per term and face.
+ */
+template<typename ValueType>
+void assembleFused(
+    la::LinearSystem<ValueType, localIdx>& ls,
+    std::span<const GaussGreenTerm<ValueType>* const> terms
+)
+{
+    const auto& phi = terms.front()->phi;
+    const bool uniform = std::all_of(
+        terms.begin(),
+        terms.end(),
+        [](const auto* term) { return uniformValue(term->operatorScaling).has_value(); }
+    );
+    if (uniform)
+    {
+        auto toCoeff = [](const dsl::Coeff& coeff)
+        { return dsl::detail::UniformCoeff {*uniformValue(coeff)}; };
+        assembleFused(ls, phi, termViews<dsl::detail::UniformCoeff>(terms, toCoeff));
+    }
+    else
+    {
+        auto toCoeff = [](const dsl::Coeff& coeff) { return coeff; };
+        assembleFused(ls, phi, termViews<dsl::Coeff>(terms, toCoeff));
+    }
+}
+
+}
+
+template<typename ValueType>
+void assembleGaussGreenTerms(
+    la::LinearSystem<ValueType, localIdx>& ls, std::span<const GaussGreenTerm<ValueType>> terms
+)
+{
+    // group the terms by field, keeping the order of the terms of each field
+    std::vector<std::vector<const GaussGreenTerm<ValueType>*>> groups;
+    for (const auto& term : terms)
+    {
+        auto group = std::find_if(
+            groups.begin(),
+            groups.end(),
+            [&](const auto& candidate) { return &candidate.front()->phi == &term.phi; }
+        );
+        if (group == groups.end())
+        {
+            groups.emplace_back(1, &term);
+            continue;
+        }
+        group->push_back(&term);
+    }
+
+    for (const auto& group : groups)
+    {
+        const std::span<const GaussGreenTerm<ValueType>* const> groupTerms(group);
+        for (std::size_t start = 0; start < groupTerms.size(); start += maxFusedGaussGreenTerms)
+        {
+            const auto count = std::min(maxFusedGaussGreenTerms, groupTerms.size() - start);
+            detail::assembleFused(ls, groupTerms.subspan(start, count));
+        }
+    }
+}
+
+#define NN_DECLARE_ASSEMBLE_GAUSS_GREEN_TERMS(TYPENAME)                                            \
+    template void assembleGaussGreenTerms<TYPENAME>(                                               \
+        la::LinearSystem<TYPENAME, localIdx>&, std::span<const GaussGreenTerm<TYPENAME>>           \
+    )
+
+NN_DECLARE_ASSEMBLE_GAUSS_GREEN_TERMS(scalar);
+NN_DECLARE_ASSEMBLE_GAUSS_GREEN_TERMS(Vec3);
+
+};
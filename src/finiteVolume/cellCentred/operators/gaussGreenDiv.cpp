@@ -5,6 +5,7 @@
 #include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/finiteVolume/cellCentred/operators/gaussGreenDiv.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -25,9 +26,9 @@ namespace NeoN::finiteVolume::cellCentred
 ** @param phiF - flux on cell faces
 ** @param v - cell volumes
 ** @param res - view holding the result
-** @param operatorScaling - any additional coefficients
+** @param operatorScaling - any additional coefficients, a compile time variant of dsl::Coeff
 */
-template<typename ValueType>
+template<typename ValueType, typename CoeffType>
 void computeDiv(
     const Executor& exec,
     localIdx nInternalFaces,
@@ -39,7 +40,7 @@ void computeDiv(
     View<const ValueType> phiF,
     View<const scalar> v,
     View<ValueType> res,
-    const dsl::Coeff operatorScaling
+    const CoeffType operatorScaling
 )
 {
     auto nCells = v.size();
@@ -124,19 +125,24 @@ void computeDivExp(
 
     auto nInternalFaces = mesh.nInternalFaces();
     auto nBoundaryFaces = mesh.nBoundaryFaces();
-    computeDiv<ValueType>(
-        exec,
-        nInternalFaces,
-        nBoundaryFaces,
-        mesh.faceNeighbour().view(),
-        mesh.faceOwner().view(),
-        mesh.boundaryMesh().faceCells().view(),
-        faceFlux.internalVector().view(),
-        phif.internalVector().view(),
-        mesh.cellVolumes().view(),
-        divPhi.view(),
-        operatorScaling
-
+    auto divPhiView = divPhi.view();
+    operatorScaling.visit(
+        [&](const auto coeff)
+        {
+            computeDiv<ValueType>(
+                exec,
+                nInternalFaces,
+                nBoundaryFaces,
+                mesh.faceNeighbour().view(),
+                mesh.faceOwner().view(),
+                mesh.boundaryMesh().faceCells().view(),
+                faceFlux.internalVector().view(),
+                phif.internalVector().view(),
+                mesh.cellVolumes().view(),
+                divPhiView,
+                coeff
+            );
+        }
     );
 }
 
@@ -153,20 +159,22 @@ NF_DECLARE_COMPUTE_EXP_DIV(scalar);
 NF_DECLARE_COMPUTE_EXP_DIV(Vec3);
 
 
-template<typename ValueType>
+namespace detail
+{
+
+template<typename ValueType, typename CoeffType>
 void computeDivImp(
     la::LinearSystem<ValueType, localIdx>& ls,
     const SurfaceField<scalar>& faceFlux,
     const VolumeField<ValueType>& phi,
-    const SurfaceInterpolation<ValueType>& surfInterp,
-    const dsl::Coeff operatorScaling,
+    const SurfaceField<scalar>& weights,
+    const CoeffType operatorScaling,
     const la::SparsityPattern& sparsityPattern
 )
 {
     const UnstructuredMesh& mesh = phi.mesh();
     const auto nInternalFaces = mesh.nInternalFaces();
     const auto exec = phi.exec();
-    const auto weights = surfInterp.weight(faceFlux, phi);
 
     const auto [faceFluxV, weightsV, owner, neighbour, surfFaceCells, diagOffs, ownOffs, neiOffs] =
         views(
@@ -231,10 +239,11 @@ void computeDivImp(
         );
 
     auto [boundValues, rhsBoundValues] = views(bcCoeffs.matrixValues, bcCoeffs.rhsValues);
+    const auto procFaceStart = nInternalFaces + nPhysicalBoundaryFaces(mesh);
 
     parallelFor(
         exec,
-        {nInternalFaces, faceFluxV.size()},
+        {nInternalFaces, procFaceStart},
         KOKKOS_LAMBDA(const localIdx facei) {
             auto bcfacei = facei - nInternalFaces;
             auto flux = bweights[bcfacei] * faceFluxV[facei];
@@ -249,17 +258,60 @@ void computeDivImp(
             auto valueMat = flux * operatorScalingOwn * valFrac2 * one<ValueType>();
 
             Kokkos::atomic_add(&matrix.values[rowOwnStart + diagOffs[own]], valueMat);
-            boundValues[bcfacei] = valueMat;
+            boundValues[bcfacei] += valueMat;
 
             auto valueRhs = (flux * operatorScalingOwn * (valFrac1 * refValue[bcfacei]))
                           + valFrac2 * refGradient[bcfacei] * (1 / deltaCoeffs[bcfacei]);
 
             Kokkos::atomic_sub(&rhs[own], valueRhs);
 
-            rhsBoundValues[bcfacei] = valueRhs;
+            rhsBoundValues[bcfacei] += valueRhs;
         },
         "computeInterfaceGaussGreenDivCoefficients"
     );
+
+    // processor faces couple to the neighbour cell, which is lagged with the last exchanged value,
+    // the coupling coefficient of all operators is accumulated for distributed systems
+    parallelFor(
+        exec,
+        {procFaceStart, faceFluxV.size()},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            auto bcfacei = facei - nInternalFaces;
+            auto own = surfFaceCells[bcfacei];
+            auto flux = faceFluxV[facei] * operatorScaling[own];
+            auto weight = bweights[bcfacei];
+
+            auto valueMat = weight * flux * one<ValueType>();
+            Kokkos::atomic_add(&matrix.values[matrix.rowOffs[own] + diagOffs[own]], valueMat);
+
+            auto coupling = (1 - weight) * flux * one<ValueType>();
+            boundValues[bcfacei] += coupling;
+
+            auto valueRhs = (1 - weight) * flux * value[bcfacei];
+            Kokkos::atomic_sub(&rhs[own], valueRhs);
+            rhsBoundValues[bcfacei] += valueRhs;
+        },
+        "computeProcessorGaussGreenDivCoefficients"
+    );
+}
+
+}
+
+template<typename ValueType>
+void computeDivImp(
+    la::LinearSystem<ValueType, localIdx>& ls,
+    const SurfaceField<scalar>& faceFlux,
+    const VolumeField<ValueType>& phi,
+    const SurfaceInterpolation<ValueType>& surfInterp,
+    const dsl::Coeff operatorScaling,
+    const la::SparsityPattern& sparsityPattern
+)
+{
+    const auto weights = surfInterp.weight(faceFlux, phi);
+    operatorScaling.visit(
+        [&](const auto coeff)
+        { detail::computeDivImp(ls, faceFlux, phi, weights, coeff, sparsityPattern); }
+    );
 };
 
 #define NN_DECLARE_COMPUTE_IMP_DIV(TYPENAME)                                                       \
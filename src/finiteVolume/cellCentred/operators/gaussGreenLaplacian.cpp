@@ -4,10 +4,34 @@
 
 #include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/finiteVolume/cellCentred/operators/gaussGreenLaplacian.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
 
+namespace detail
+{
+
+template<typename ValueType, typename CoeffType>
+void scaleByVolume(
+    const Executor& exec,
+    View<ValueType> result,
+    View<const scalar> vol,
+    const CoeffType operatorScaling
+)
+{
+    parallelFor(
+        exec,
+        {0, result.size()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            result[celli] *= operatorScaling[celli] / vol[celli];
+        },
+        "computeLaplacianExplicitCells"
+    );
+}
+
+}
+
 template<typename ValueType>
 void computeLaplacianExp(
     const FaceNormalGradient<ValueType>& faceNormalGradient,
@@ -53,13 +77,8 @@ void computeLaplacianExp(
         "computeLaplacianExplicitBoundary"
     );
 
-    parallelFor(
-        exec,
-        {0, mesh.nCells()},
-        KOKKOS_LAMBDA(const localIdx celli) {
-            result[celli] *= operatorScaling[celli] / vol[celli];
-        },
-        "computeLaplacianExplicitCells"
+    operatorScaling.visit(
+        [&](const auto coeff) { detail::scaleByVolume(exec, result, vol, coeff); }
     );
 }
 
@@ -76,12 +95,15 @@ NF_DECLARE_COMPUTE_EXP_LAP(scalar);
 NF_DECLARE_COMPUTE_EXP_LAP(Vec3);
 
 
-template<typename ValueType>
+namespace detail
+{
+
+template<typename ValueType, typename CoeffType>
 void computeLaplacianImpl(
     la::LinearSystem<ValueType, localIdx>& ls,
     const SurfaceField<scalar>& gamma,
     const VolumeField<ValueType>& phi,
-    const dsl::Coeff operatorScaling,
+    const CoeffType operatorScaling,
     const la::SparsityPattern& sparsityPattern,
     const FaceNormalGradient<ValueType>& faceNormalGradient
 )
@@ -152,10 +174,11 @@ void computeLaplacianImpl(
         );
 
     auto [boundValues, rhsBoundValues] = views(bcCoeffs.matrixValues, bcCoeffs.rhsValues);
+    const auto procFaceStart = nInternalFaces + nPhysicalBoundaryFaces(mesh);
 
     parallelFor(
         exec,
-        {nInternalFaces, sGamma.size()},
+        {nInternalFaces, procFaceStart},
         KOKKOS_LAMBDA(const localIdx facei) {
             auto bcfacei = facei - nInternalFaces;
             auto flux = sGamma[facei] * magFaceArea[facei];
@@ -167,16 +190,60 @@ void computeLaplacianImpl(
             ValueType valueMat = flux * operatorScalingOwn * valueFraction[bcfacei]
                                * deltaCoeffs[facei] * one<ValueType>();
             Kokkos::atomic_sub(&values[rowOwnStart + diagOffs[own]], valueMat);
-            boundValues[bcfacei] = valueMat;
+            boundValues[bcfacei] += valueMat;
 
             ValueType valueRhs = flux * operatorScalingOwn
                                * (valueFraction[bcfacei] * deltaCoeffs[facei] * refValue[bcfacei]
                                   + (1.0 - valueFraction[bcfacei]) * refGradient[bcfacei]);
             Kokkos::atomic_sub(&rhs[own], valueRhs);
-            rhsBoundValues[bcfacei] = valueRhs;
+            rhsBoundValues[bcfacei] += valueRhs;
         },
         "computeInterfaceLaplacianCoefficients"
     );
+
+    // processor faces couple to the neighbour cell, which is lagged with the last exchanged value,
+    // the coupling coefficient of all operators is accumulated for distributed systems
+    parallelFor(
+        exec,
+        {procFaceStart, sGamma.size()},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            auto bcfacei = facei - nInternalFaces;
+            auto own = surfFaceCells[bcfacei];
+            auto flux =
+                deltaCoeffs[facei] * sGamma[facei] * magFaceArea[facei] * operatorScaling[own];
+
+            ValueType coupling = flux * one<ValueType>();
+            Kokkos::atomic_sub(&values[rowOffs[own] + diagOffs[own]], coupling);
+            boundValues[bcfacei] += coupling;
+
+            ValueType valueRhs = flux * value[bcfacei];
+            Kokkos::atomic_sub(&rhs[own], valueRhs);
+            rhsBoundValues[bcfacei] += valueRhs;
+        },
+        "computeProcessorLaplacianCoefficients"
+    );
+}
+
+}
+
+template<typename ValueType>
+void computeLaplacianImpl(
+    la::LinearSystem<ValueType, localIdx>& ls,
+    const SurfaceField<scalar>& gamma,
+    const VolumeField<ValueType>& phi,
+    const dsl::Coeff operatorScaling,
+    const la::SparsityPattern& sparsityPattern,
+    const FaceNormalGradient<ValueType>& faceNormalGradient
+)
+{
+    operatorScaling.visit(
+        [&](const auto coeff)
+        {
+            detail::computeLaplacianImpl(
+                ls, gamma, phi, coeff, sparsityPattern, faceNormalGradient
+            );
+        }
+    );
 }
 
 #define NN_DECLARE_COMPUTE_IMP_LAP(TYPENAME)                                                       \
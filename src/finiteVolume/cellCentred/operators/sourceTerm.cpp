@@ -20,15 +20,21 @@ SourceTerm<ValueType>::SourceTerm(
       coefficients_(coefficients),
       sparsityPattern_(la::SparsityPattern::readOrCreate(field.mesh())) {};
 
-template<typename ValueType>
-void SourceTerm<ValueType>::explicitOperation(Vector<ValueType>& source) const
+namespace detail
+{
+
+template<typename ValueType, typename CoeffType>
+void computeSourceExp(
+    const Executor& exec,
+    View<ValueType> sourceView,
+    View<const ValueType> fieldView,
+    View<const scalar> coeff,
+    const CoeffType operatorScaling
+)
 {
-    auto operatorScaling = this->getCoefficient();
-    auto [sourceView, fieldView, coeff] =
-        views(source, this->field_.internalVector(), coefficients_.internalVector());
     NeoN::parallelFor(
-        source.exec(),
-        source.range(),
+        exec,
+        {0, sourceView.size()},
         KOKKOS_LAMBDA(const localIdx celli) {
             sourceView[celli] += operatorScaling[celli] * coeff[celli] * fieldView[celli];
         },
@@ -36,17 +42,19 @@ void SourceTerm<ValueType>::explicitOperation(Vector<ValueType>& source) const
     );
 }
 
-template<typename ValueType>
-void SourceTerm<ValueType>::implicitOperation(la::LinearSystem<ValueType, localIdx>& ls) const
+template<typename ValueType, typename CoeffType>
+void computeSourceImp(
+    la::LinearSystemView<ValueType, localIdx> ls,
+    const Executor& exec,
+    View<const uint8_t> diagOffs,
+    View<const scalar> coeff,
+    View<const scalar> vol,
+    const CoeffType operatorScaling
+)
 {
-    const auto operatorScaling = this->getCoefficient();
-    const auto vol = coefficients_.mesh().cellVolumes().view();
-    const auto [diagOffs, coeff] =
-        views(getSparsityPattern().diagOffset(), coefficients_.internalVector());
-    auto [matrix, rhs] = ls.view();
-
+    auto matrix = ls.matrix;
     NeoN::parallelFor(
-        ls.exec(),
+        exec,
         {0, coeff.size()},
         KOKKOS_LAMBDA(const localIdx celli) {
             localIdx idx = matrix.rowOffs[celli] + diagOffs[celli];
@@ -57,6 +65,34 @@ void SourceTerm<ValueType>::implicitOperation(la::LinearSystem<ValueType, localI
     );
 }
 
+}
+
+template<typename ValueType>
+void SourceTerm<ValueType>::explicitOperation(Vector<ValueType>& source) const
+{
+    auto operatorScaling = this->getCoefficient();
+    auto [sourceView, fieldView, coeff] =
+        views(source, this->field_.internalVector(), coefficients_.internalVector());
+    operatorScaling.visit(
+        [&](const auto scaling)
+        { detail::computeSourceExp(source.exec(), sourceView, fieldView, coeff, scaling); }
+    );
+}
+
+template<typename ValueType>
+void SourceTerm<ValueType>::implicitOperation(la::LinearSystem<ValueType, localIdx>& ls) const
+{
+    const auto operatorScaling = this->getCoefficient();
+    const auto vol = coefficients_.mesh().cellVolumes().view();
+    const auto [diagOffs, coeff] =
+        views(getSparsityPattern().diagOffset(), coefficients_.internalVector());
+    auto lsView = ls.view();
+    operatorScaling.visit(
+        [&](const auto scaling)
+        { detail::computeSourceImp(lsView, ls.exec(), diagOffs, coeff, vol, scaling); }
+    );
+}
+
 
 // instantiate the template class
 template class SourceTerm<scalar>;
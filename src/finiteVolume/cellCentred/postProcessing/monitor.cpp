@@ -0,0 +1,351 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <iomanip>
+#include <sstream>
+#include <type_traits>
+
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/postProcessing/monitor.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/meshSearch.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace detail
+{
+
+/* @brief the value whose extrema are reported, i.e. the magnitude of vectors */
+KOKKOS_INLINE_FUNCTION
+scalar extremaValue(const scalar value) { return value; }
+
+KOKKOS_INLINE_FUNCTION
+scalar extremaValue(const Vec3& value) { return mag(value); }
+
+/* @brief nPoints points distributed uniformly between start and end */
+void addLine(std::vector<Vec3>& points, const Vec3& start, const Vec3& end, label nPoints)
+{
+    for (label i = 0; i < nPoints; i++)
+    {
+        const scalar a = nPoints > 1 ? scalar(i) / scalar(nPoints - 1) : 0.0;
+        points.push_back(start + a * (end - start));
+    }
+}
+
+std::vector<Vec3> linePoints(const Dictionary& dict)
+{
+    std::vector<Vec3> points;
+    addLine(points, dict.get<Vec3>("start"), dict.get<Vec3>("end"), dict.get<label>("nPoints"));
+    return points;
+}
+
+std::vector<Vec3> planePoints(const Dictionary& dict)
+{
+    const auto origin = dict.get<Vec3>("origin");
+    const auto e1 = dict.get<Vec3>("e1");
+    const auto e2 = dict.get<Vec3>("e2");
+    const auto nPoints2 = dict.get<label>("nPoints2");
+    std::vector<Vec3> points;
+    for (label j = 0; j < nPoints2; j++)
+    {
+        const scalar b = nPoints2 > 1 ? scalar(j) / scalar(nPoints2 - 1) : 0.0;
+        const Vec3 start = origin + b * e2;
+        addLine(points, start, start + e1, dict.get<label>("nPoints1"));
+    }
+    return points;
+}
+
+std::string format(scalar value)
+{
+    std::ostringstream out;
+    out << std::setprecision(std::numeric_limits<scalar>::max_digits10) << value;
+    return out.str();
+}
+
+void append(std::string& row, scalar value) { row += " " + format(value); }
+
+void append(std::string& row, const Vec3& value)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        append(row, value[i]);
+    }
+}
+
+/* @brief appends the column names of a field to the header */
+void appendColumns(std::string& header, const std::string& name, bool isVector)
+{
+    if (isVector)
+    {
+        header += " " + name + "_x " + name + "_y " + name + "_z";
+    }
+    else
+    {
+        header += " " + name;
+    }
+}
+
+}
+
+Vector<localIdx> findCells(const UnstructuredMesh& mesh, const std::vector<Vec3>& points)
+{
+    return findNearestCells(mesh, Vector<Vec3>(mesh.exec(), points));
+}
+
+template<typename ValueType>
+VolumeStatistics<ValueType> volumeStatistics(const VolumeField<ValueType>& field)
+{
+    const auto [values, volumes] = views(field.internalVector(), field.mesh().cellVolumes());
+    VolumeStatistics<ValueType> statistics;
+    parallelReduce(
+        field.exec(),
+        {0, field.mesh().nCells()},
+        KOKKOS_LAMBDA(const localIdx celli, VolumeStatistics<ValueType>& local) {
+            const scalar value = detail::extremaValue(values[celli]);
+            local.min = value < local.min ? value : local.min;
+            local.max = value > local.max ? value : local.max;
+            local.weightedSum += volumes[celli] * values[celli];
+            local.volume += volumes[celli];
+        },
+        statistics
+    );
+    return statistics;
+}
+
+template VolumeStatistics<scalar> volumeStatistics<scalar>(const VolumeField<scalar>&);
+template VolumeStatistics<Vec3> volumeStatistics<Vec3>(const VolumeField<Vec3>&);
+
+Monitor::Monitor(
+    const UnstructuredMesh& mesh,
+    const std::filesystem::path& directory,
+    const std::string& name,
+    const Dictionary& dict
+)
+    : mesh_(mesh), directory_(directory), name_(name), cells_(mesh.exec(), 0),
+      patchFaces_(mesh.exec(), 0),
+      statistics_(dict.contains("statistics") ? dict.get<bool>("statistics") : true),
+      writeInterval_(
+          dict.contains("writeInterval") ? static_cast<size_t>(dict.get<label>("writeInterval"))
+                                         : 1
+      )
+{
+    if (writeInterval_ == 0) NF_THROW("The writeInterval of monitor " + name + " is zero.");
+
+    std::vector<Vec3> points;
+    auto addSampler = [&](const std::string& samplerName, const std::vector<Vec3>& samples)
+    {
+        if (samplerName == "patches" || samplerName == "statistics")
+        {
+            NF_THROW("The sampler name " + samplerName + " is reserved.");
+        }
+        samplers_.push_back(
+            {samplerName,
+             static_cast<localIdx>(points.size()),
+             static_cast<localIdx>(samples.size())}
+        );
+        points.insert(points.end(), samples.begin(), samples.end());
+    };
+
+    if (dict.contains("probes"))
+    {
+        addSampler("probes", dict.get<std::vector<Vec3>>("probes"));
+    }
+    if (dict.contains("lines"))
+    {
+        const auto& lines = dict.subDict("lines");
+        for (const auto& line : lines.keys())
+        {
+            addSampler(line, detail::linePoints(lines.subDict(line)));
+        }
+    }
+    if (dict.contains("planes"))
+    {
+        const auto& planes = dict.subDict("planes");
+        for (const auto& plane : planes.keys())
+        {
+            addSampler(plane, detail::planePoints(planes.subDict(plane)));
+        }
+    }
+    cells_ = findCells(mesh, points);
+
+    if (dict.contains("patches"))
+    {
+        const auto& offset = mesh.boundaryMesh().offset();
+        const auto nPatches = static_cast<localIdx>(offset.size()) - 1;
+        std::vector<localIdx> patchFaces;
+        for (auto patchi : dict.get<std::vector<localIdx>>("patches"))
+        {
+            if (patchi < 0 || patchi >= nPatches)
+            {
+                NF_THROW(
+                    "Patch " + std::to_string(patchi) + " of monitor " + name
+                    + " does not exist, the mesh has " + std::to_string(nPatches) + " patches."
+                );
+            }
+            patchFaces.push_back(offset[static_cast<size_t>(patchi)]);
+            patchFaces.push_back(offset[static_cast<size_t>(patchi) + 1]);
+        }
+        patchFaces_ = Vector<localIdx>(mesh.exec(), patchFaces);
+    }
+}
+
+void Monitor::add(const VolumeField<scalar>& field) { fields_.push_back(&field); }
+
+void Monitor::add(const VolumeField<Vec3>& field) { fields_.push_back(&field); }
+
+std::vector<std::string> Monitor::samplers() const
+{
+    std::vector<std::string> names;
+    for (const auto& sampler : samplers_)
+    {
+        names.push_back(sampler.name);
+    }
+    if (patchFaces_.size() > 0) names.push_back("patches");
+    if (statistics_) names.push_back("statistics");
+    return names;
+}
+
+std::filesystem::path Monitor::file(const std::string& sampler) const
+{
+    return directory_ / (name_ + "_" + sampler + ".dat");
+}
+
+void Monitor::openFiles()
+{
+    std::filesystem::create_directories(directory_);
+    const auto names = samplers();
+    for (size_t filei = 0; filei < names.size(); filei++)
+    {
+        auto& out = *files_.emplace_back(
+            std::make_unique<std::ofstream>(file(names[filei]), std::ios::trunc)
+        );
+        if (!out) NF_THROW("Could not open " + file(names[filei]).string());
+
+        // the columns of a field are repeated for every sample of the file
+        localIdx nSamples = 1;
+        if (filei < samplers_.size())
+        {
+            nSamples = samplers_[filei].size;
+        }
+        else if (names[filei] == "patches")
+        {
+            nSamples = patchFaces_.size() / 2;
+        }
+
+        std::string header = "# time";
+        for (const auto& field : fields_)
+        {
+            std::visit(
+                [&](const auto* f)
+                {
+                    using FieldType = std::decay_t<decltype(*f)>;
+                    const bool isVector = std::is_same_v<FieldType, VolumeField<Vec3>>;
+                    if (names[filei] == "statistics")
+                    {
+                        header += " " + f->name + "_min " + f->name + "_max";
+                        detail::appendColumns(header, f->name + "_mean", isVector);
+                        return;
+                    }
+                    for (localIdx samplei = 0; samplei < nSamples; samplei++)
+                    {
+                        detail::appendColumns(
+                            header, f->name + "(" + std::to_string(samplei) + ")", isVector
+                        );
+                    }
+                },
+                field
+            );
+        }
+        out << header << "\n";
+    }
+}
+
+template<typename ValueType>
+void Monitor::sample(const VolumeField<ValueType>& field, std::vector<std::string>& rows)
+{
+    const auto nSamples = cells_.size();
+    const auto nPatches = patchFaces_.size() / 2;
+    Vector<ValueType> values(field.exec(), nSamples + nPatches);
+    if (values.size() > 0)
+    {
+        auto [result, internal, boundary, cells, patchFaces, magSf] = views(
+            values,
+            field.internalVector(),
+            field.boundaryData().value(),
+            cells_,
+            patchFaces_,
+            mesh_.boundaryMesh().magSf()
+        );
+        // the probes, lines, planes and patch means are evaluated in a single kernel
+        parallelFor(
+            field.exec(),
+            {0, values.size()},
+            KOKKOS_LAMBDA(const localIdx i) {
+                if (i < nSamples)
+                {
+                    result[i] = internal[cells[i]];
+                    return;
+                }
+                const auto patchi = i - nSamples;
+                ValueType sum {};
+                scalar area = 0.0;
+                for (auto facei = patchFaces[2 * patchi]; facei < patchFaces[2 * patchi + 1];
+                     facei++)
+                {
+                    sum += magSf[facei] * boundary[facei];
+                    area += magSf[facei];
+                }
+                result[i] = area > 0.0 ? (1.0 / area) * sum : sum;
+            },
+            "monitorSample"
+        );
+    }
+
+    const auto hostValues = values.copyToHost();
+    const auto hostView = hostValues.view();
+    for (size_t sampleri = 0; sampleri < samplers_.size(); sampleri++)
+    {
+        const auto& sampler = samplers_[sampleri];
+        for (localIdx i = sampler.start; i < sampler.start + sampler.size; i++)
+        {
+            detail::append(rows[sampleri], hostView[i]);
+        }
+    }
+    size_t rowi = samplers_.size();
+    if (nPatches > 0)
+    {
+        for (localIdx i = nSamples; i < nSamples + nPatches; i++)
+        {
+            detail::append(rows[rowi], hostView[i]);
+        }
+        rowi++;
+    }
+    if (statistics_)
+    {
+        const auto statistics = volumeStatistics(field);
+        detail::append(rows[rowi], statistics.min);
+        detail::append(rows[rowi], statistics.max);
+        detail::append(rows[rowi], statistics.mean());
+    }
+}
+
+bool Monitor::execute(scalar time)
+{
+    if (nCalls_++ % writeInterval_ != 0) return false;
+    if (files_.empty()) openFiles();
+
+    std::vector<std::string> rows(files_.size(), detail::format(time));
+    for (const auto& field : fields_)
+    {
+        std::visit([&](const auto* f) { sample(*f, rows); }, field);
+    }
+    for (size_t filei = 0; filei < files_.size(); filei++)
+    {
+        *files_[filei] << rows[filei] << std::endl;
+    }
+    return true;
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -5,6 +5,7 @@
 #include "NeoN/core/containerFreeFunctions.hpp"
 #include "NeoN/core/parallelAlgorithms.hpp"
 #include "NeoN/finiteVolume/cellCentred/stencil/basicGeometryScheme.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
 
 namespace NeoN::finiteVolume::cellCentred
 {
@@ -44,13 +45,18 @@ void BasicGeometryScheme::updateWeights(const Executor& exec, SurfaceField<scala
         "basicGeometricScheme::updateWeightsInternal"
     );
 
+    // processor faces use the weights of the undecomposed internal face
+    const auto procFaceStart = nInternalFaces + nPhysicalBoundaryFaces(mesh_);
+    const auto procWeights = mesh_.boundaryMesh().weights().view();
+
     parallelFor(
         exec,
         {nInternalFaces, weightS.size()},
         KOKKOS_LAMBDA(const localIdx facei) {
             const auto bcfacei = facei - nInternalFaces;
-            weightS[facei] = 1.0;
-            weightB[bcfacei] = 1.0;
+            const scalar weight = facei < procFaceStart ? 1.0 : procWeights[bcfacei];
+            weightS[facei] = weight;
+            weightB[bcfacei] = weight;
         },
         "basicGeometricScheme::updateWeightsBoundary"
     );
@@ -79,13 +85,17 @@ void BasicGeometryScheme::updateDeltaCoeffs(
     );
 
     const auto nInternalFaces = mesh_.nInternalFaces();
+    // the delta of processor faces is the distance to the cell on the other side
+    const auto procFaceStart = nInternalFaces + nPhysicalBoundaryFaces(mesh_);
+    const auto procDelta = mesh_.boundaryMesh().delta().view();
 
     parallelFor(
         exec,
         {nInternalFaces, deltaCoeff.size()},
         KOKKOS_LAMBDA(const localIdx facei) {
             auto own = surfFaceCells[facei - nInternalFaces];
-            Vec3 cellToCellDist = cf[facei] - cellCentre[own];
+            Vec3 cellToCellDist = facei < procFaceStart ? cf[facei] - cellCentre[own]
+                                                        : procDelta[facei - nInternalFaces];
 
             deltaCoeff[facei] = 1.0 / mag(cellToCellDist);
         },
@@ -125,12 +135,16 @@ void BasicGeometryScheme::updateNonOrthDeltaCoeffs(
         "basicGeometricScheme::updateNonOrthDeltaCoeffsInternal"
     );
 
+    const auto procFaceStart = nInternalFaces + nPhysicalBoundaryFaces(mesh_);
+    const auto procDelta = mesh_.boundaryMesh().delta().view();
+
     parallelFor(
         exec,
         {nInternalFaces, nonOrthDeltaCoeff.size()},
         KOKKOS_LAMBDA(const localIdx facei) {
             auto own = surfFaceCells[facei - nInternalFaces];
-            Vec3 cellToCellDist = cf[facei] - cellCentre[own];
+            Vec3 cellToCellDist = facei < procFaceStart ? cf[facei] - cellCentre[own]
+                                                        : procDelta[facei - nInternalFaces];
             Vec3 faceNormal = 1 / faceArea[facei] * faceAreaVec3[facei];
 
             scalar orthoDist = faceNormal & cellToCellDist;
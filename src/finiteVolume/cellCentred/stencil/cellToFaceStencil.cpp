@@ -10,6 +10,17 @@ namespace NeoN::finiteVolume::cellCentred
 
 CellToFaceStencil::CellToFaceStencil(const UnstructuredMesh& mesh) : mesh_(mesh) {}
 
+const SegmentedVector<localIdx, localIdx>&
+CellToFaceStencil::readOrCreate(const UnstructuredMesh& mesh)
+{
+    auto& db = mesh.stencilDB();
+    if (!db.contains("CellToFaceStencil"))
+    {
+        db.insert(std::string("CellToFaceStencil"), CellToFaceStencil(mesh).computeStencil());
+    }
+    return db.get<SegmentedVector<localIdx, localIdx>>("CellToFaceStencil");
+}
+
 SegmentedVector<localIdx, localIdx> CellToFaceStencil::computeStencil() const
 {
     const auto exec = mesh_.exec();
@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/cellToFaceStencil.hpp"
+#include "NeoN/finiteVolume/cellCentred/stencil/meshSearch.hpp"
+
+namespace NeoN::finiteVolume::cellCentred
+{
+
+namespace detail
+{
+
+Array<BoundingBox> faceBoxes(const UnstructuredMesh& mesh)
+{
+    Array<BoundingBox> boxes(mesh.exec(), mesh.nFaces());
+    auto [boxView, faceCentres, faceAreas, magFaceAreas] =
+        views(boxes, mesh.faceCentres(), mesh.faceAreas(), mesh.magFaceAreas());
+    parallelFor(
+        mesh.exec(),
+        {0, mesh.nFaces()},
+        KOKKOS_LAMBDA(const localIdx facei) {
+            // the extent of a disk with the area of the face in the plane of the face
+            const scalar magSf = magFaceAreas[facei];
+            const scalar radius = Kokkos::sqrt(magSf);
+            Vec3 extent;
+            for (int i = 0; i < 3; i++)
+            {
+                const scalar normal = magSf > 0.0 ? faceAreas[facei][i] / magSf : 0.0;
+                const scalar inPlane = 1.0 - normal * normal;
+                extent[i] = radius * Kokkos::sqrt(inPlane > 0.0 ? inPlane : 0.0);
+            }
+            BoundingBox box;
+            box.add(faceCentres[facei], extent);
+            boxView[facei] = box;
+        },
+        "computeFaceBoxes"
+    );
+    return boxes;
+}
+
+Array<BoundingBox> cellBoxes(const UnstructuredMesh& mesh, const Array<BoundingBox>& faceBoxes)
+{
+    const auto& stencil = CellToFaceStencil::readOrCreate(mesh);
+    Array<BoundingBox> boxes(mesh.exec(), mesh.nCells());
+    auto [boxView, faceBoxView, cellFaces, segments] =
+        views(boxes, faceBoxes, stencil.values(), stencil.segments());
+    parallelFor(
+        mesh.exec(),
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const localIdx celli) {
+            BoundingBox box;
+            for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+            {
+                box += faceBoxView[cellFaces[i]];
+            }
+            boxView[celli] = box;
+        },
+        "computeCellBoxes"
+    );
+    return boxes;
+}
+
+/* @brief finds the primitive with the closest centre for every point */
+Vector<localIdx> findNearest(
+    const BoundingVolumeHierarchy& tree, const Vector<Vec3>& centres, const Vector<Vec3>& points
+)
+{
+    NF_ASSERT(points.exec() == tree.exec(), "The points are not on the executor of the mesh.");
+    Vector<localIdx> nearest(points.exec(), points.size());
+    auto [nearestView, pointView, centreView] = views(nearest, points, centres);
+    const auto treeView = tree.view();
+    parallelFor(
+        points.exec(),
+        {0, points.size()},
+        KOKKOS_LAMBDA(const localIdx pointi) {
+            const Vec3 point = pointView[pointi];
+            localIdx best = -1;
+            scalar bestDistance = 0.0;
+            treeView.traverse(
+                point,
+                [&](const BoundingBox& box)
+                { return best < 0 || box.distanceSquared(point) <= bestDistance; },
+                [&](const localIdx primitive)
+                {
+                    const Vec3 delta = centreView[primitive] - point;
+                    const scalar distance = delta & delta;
+                    // ties are resolved by the index for reproducible results
+                    if (best < 0 || distance < bestDistance
+                        || (distance == bestDistance && primitive < best))
+                    {
+                        best = primitive;
+                        bestDistance = distance;
+                    }
+                    return true;
+                }
+            );
+            nearestView[pointi] = best;
+        },
+        "findNearest"
+    );
+    return nearest;
+}
+
+/* @brief calls the function for all cells whose centres are within the radius around the point */
+template<typename Function>
+KOKKOS_INLINE_FUNCTION void forEachCellInRadius(
+    const BoundingVolumeHierarchyView& tree,
+    const View<const Vec3>& centres,
+    const Vec3& point,
+    const scalar radiusSquared,
+    Function function
+)
+{
+    tree.traverse(
+        point,
+        [&](const BoundingBox& box) { return box.distanceSquared(point) <= radiusSquared; },
+        [&](const localIdx celli)
+        {
+            const Vec3 delta = centres[celli] - point;
+            if ((delta & delta) <= radiusSquared) function(celli);
+            return true;
+        }
+    );
+}
+
+}
+
+MeshSearch::MeshSearch(const UnstructuredMesh& mesh) : MeshSearch(mesh, detail::faceBoxes(mesh)) {}
+
+MeshSearch::MeshSearch(const UnstructuredMesh& mesh, const Array<BoundingBox>& faceBoxes)
+    : cells_(detail::cellBoxes(mesh, faceBoxes)), faces_(faceBoxes)
+{}
+
+const MeshSearch& MeshSearch::readOrCreate(const UnstructuredMesh& mesh)
+{
+    auto& db = mesh.stencilDB();
+    if (!db.contains("MeshSearch"))
+    {
+        db.insert(std::string("MeshSearch"), MeshSearch(mesh));
+    }
+    return db.get<MeshSearch>("MeshSearch");
+}
+
+Vector<localIdx> findNearestCells(const UnstructuredMesh& mesh, const Vector<Vec3>& points)
+{
+    return detail::findNearest(MeshSearch::readOrCreate(mesh).cells(), mesh.cellCentres(), points);
+}
+
+Vector<localIdx> findNearestFaces(const UnstructuredMesh& mesh, const Vector<Vec3>& points)
+{
+    return detail::findNearest(MeshSearch::readOrCreate(mesh).faces(), mesh.faceCentres(), points);
+}
+
+Vector<localIdx> findContainingCells(const UnstructuredMesh& mesh, const Vector<Vec3>& points)
+{
+    const auto& search = MeshSearch::readOrCreate(mesh);
+    const auto& stencil = CellToFaceStencil::readOrCreate(mesh);
+    NF_ASSERT(points.exec() == mesh.exec(), "The points are not on the executor of the mesh.");
+
+    Vector<localIdx> cells(points.exec(), points.size());
+    auto [cellView, pointView, cellFaces, segments, faceOwner, faceCentres, faceAreas] = views(
+        cells,
+        points,
+        stencil.values(),
+        stencil.segments(),
+        mesh.faceOwner(),
+        mesh.faceCentres(),
+        mesh.faceAreas()
+    );
+    const auto treeView = search.cells().view();
+    parallelFor(
+        points.exec(),
+        {0, points.size()},
+        KOKKOS_LAMBDA(const localIdx pointi) {
+            const Vec3 point = pointView[pointi];
+            localIdx found = -1;
+            treeView.traverse(
+                point,
+                [&](const BoundingBox& box) { return box.contains(point); },
+                [&](const localIdx celli)
+                {
+                    for (auto i = segments[celli]; i < segments[celli + 1]; i++)
+                    {
+                        const auto facei = cellFaces[i];
+                        // the face area vectors point out of the owner cell
+                        const scalar side = (point - faceCentres[facei]) & faceAreas[facei];
+                        if (faceOwner[facei] == celli ? side > 0.0 : side < 0.0) return true;
+                    }
+                    found = celli;
+                    return false;
+                }
+            );
+            cellView[pointi] = found;
+        },
+        "findContainingCells"
+    );
+    return cells;
+}
+
+SegmentedVector<localIdx, localIdx>
+findCellsInRadius(const UnstructuredMesh& mesh, const Vector<Vec3>& points, scalar radius)
+{
+    const auto& search = MeshSearch::readOrCreate(mesh);
+    NF_ASSERT(points.exec() == mesh.exec(), "The points are not on the executor of the mesh.");
+
+    const auto treeView = search.cells().view();
+    const scalar radiusSquared = radius * radius;
+    auto [pointView, centreView] = views(points, mesh.cellCentres());
+
+    Vector<localIdx> nCells(points.exec(), points.size(), 0);
+    auto nCellsView = nCells.view();
+    parallelFor(
+        points.exec(),
+        {0, points.size()},
+        KOKKOS_LAMBDA(const localIdx pointi) {
+            localIdx count = 0;
+            detail::forEachCellInRadius(
+                treeView,
+                centreView,
+                pointView[pointi],
+                radiusSquared,
+                [&](const localIdx) { count++; }
+            );
+            nCellsView[pointi] = count;
+        },
+        "countCellsInRadius"
+    );
+
+    SegmentedVector<localIdx, localIdx> cells(nCells);
+    auto [cellView, segments] = cells.views();
+    parallelFor(
+        points.exec(),
+        {0, points.size()},
+        KOKKOS_LAMBDA(const localIdx pointi) {
+            auto next = segments[pointi];
+            detail::forEachCellInRadius(
+                treeView,
+                centreView,
+                pointView[pointi],
+                radiusSquared,
+                [&](const localIdx celli) { cellView[next++] = celli; }
+            );
+        },
+        "collectCellsInRadius"
+    );
+    return cells;
+}
+
+} // namespace NeoN::finiteVolume::cellCentred
@@ -0,0 +1,285 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <type_traits>
+
+#include "NeoN/io/adios2.hpp"
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/error.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
+
+namespace NeoN::io
+{
+
+namespace detail
+{
+
+#if defined(NF_WITH_MPI_SUPPORT) && ADIOS2_USE_MPI
+adios2::ADIOS createAdios(MPI_Comm comm)
+{
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    if (initialized) return adios2::ADIOS(comm);
+    return adios2::ADIOS();
+}
+
+size_t rank(MPI_Comm comm)
+{
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    if (!initialized) return 0;
+    int rank = 0;
+    MPI_Comm_rank(comm, &rank);
+    return static_cast<size_t>(rank);
+}
+
+MPI_Comm communicator(const UnstructuredMesh& mesh)
+{
+    auto procInterface = ProcessorInterface::read(mesh);
+    return procInterface ? procInterface->mpiEnvironment().comm() : MPI_COMM_WORLD;
+}
+#endif
+
+adios2::IO
+declareIO(adios2::ADIOS& adios, const std::string& name, const Dictionary& dict, bool write)
+{
+    adios2::IO io = adios.DeclareIO(name);
+    std::string engine = dict.contains("engine") ? dict.get<std::string>("engine") : "BP5";
+    io.SetEngine(engine);
+    if (write && (engine == "BP5" || engine == "bp5"))
+    {
+        // overlap writing the file with the next time steps
+        io.SetParameter("AsyncWrite", "Guided");
+    }
+    if (dict.contains("parameters"))
+    {
+        const auto& parameters = dict.subDict("parameters");
+        for (const auto& key : parameters.keys())
+        {
+            io.SetParameter(key, parameters.get<std::string>(key));
+        }
+    }
+    return io;
+}
+
+/* @brief the component type of the value type, i.e. scalar for Vec3 */
+template<typename ValueType>
+using ElementType = std::conditional_t<std::is_same_v<ValueType, Vec3>, scalar, ValueType>;
+
+template<typename ValueType>
+adios2::Dims count(size_t size)
+{
+    if constexpr (std::is_same_v<ValueType, Vec3>)
+    {
+        return {size, 3};
+    }
+    else
+    {
+        return {size};
+    }
+}
+
+}
+
+Adios2Writer::Adios2Writer(
+    const UnstructuredMesh& mesh, const std::string& fileName, const Dictionary& dict
+)
+    : mesh_(mesh),
+#if defined(NF_WITH_MPI_SUPPORT) && ADIOS2_USE_MPI
+      adios_(detail::createAdios(detail::communicator(mesh))),
+#else
+      adios_(),
+#endif
+      io_(detail::declareIO(adios_, "NeoNWriter_" + fileName, dict, true)),
+      engine_(io_.Open(fileName, adios2::Mode::Write))
+{}
+
+Adios2Writer::~Adios2Writer() { close(); }
+
+void Adios2Writer::beginStep(scalar time)
+{
+    NF_ASSERT(engine_, "The ADIOS2 engine has already been closed.");
+    NF_ASSERT(!inStep_, "endStep has to be called before the next step is started.");
+    engine_.BeginStep();
+    inStep_ = true;
+
+    auto timeVar = io_.InquireVariable<scalar>("time");
+    if (!timeVar) timeVar = io_.DefineVariable<scalar>("time");
+    engine_.Put(timeVar, time);
+
+    if (steps_ == 0) putMesh();
+}
+
+void Adios2Writer::putMesh()
+{
+    putVector("mesh/points", mesh_.points());
+    putVector("mesh/cellCentres", mesh_.cellCentres());
+    putVector("mesh/cellVolumes", mesh_.cellVolumes());
+    putVector("mesh/faceCentres", mesh_.faceCentres());
+    putVector("mesh/faceAreas", mesh_.faceAreas());
+    putVector("mesh/faceOwner", mesh_.faceOwner());
+    putVector("mesh/faceNeighbour", mesh_.faceNeighbour());
+    putVector("mesh/boundaryFaceCells", mesh_.boundaryMesh().faceCells());
+
+    const auto& offset = mesh_.boundaryMesh().offset();
+    auto& offsetVector = std::get<Vector<label>>(
+        staged_.emplace_back(Vector<label>(SerialExecutor {}, static_cast<localIdx>(offset.size())))
+    );
+    auto offsetView = offsetVector.view();
+    for (size_t i = 0; i < offset.size(); i++)
+    {
+        offsetView[i] = static_cast<label>(offset[i]);
+    }
+    putVector("mesh/boundaryOffset", offsetVector);
+}
+
+template<typename ValueType>
+void Adios2Writer::putVector(const std::string& name, const Vector<ValueType>& vec)
+{
+    NF_ASSERT(inStep_, "beginStep has to be called before fields are put.");
+    using ElementType = detail::ElementType<ValueType>;
+    const auto count = detail::count<ValueType>(static_cast<size_t>(vec.size()));
+
+    auto var = io_.InquireVariable<ElementType>(name);
+    if (!var)
+    {
+        // local arrays, i.e. every rank writes an independent block
+        var = io_.DefineVariable<ElementType>(name, {}, {}, count);
+    }
+    else
+    {
+        var.SetSelection({{}, count});
+    }
+
+    const ValueType* data = vec.data();
+    if (std::holds_alternative<GPUExecutor>(vec.exec()))
+    {
+        staged_.emplace_back(vec.copyToHost());
+        data = std::get<Vector<ValueType>>(staged_.back()).data();
+    }
+    engine_.Put(var, reinterpret_cast<const ElementType*>(data), adios2::Mode::Deferred);
+}
+
+void Adios2Writer::endStep()
+{
+    NF_ASSERT(inStep_, "beginStep has to be called before endStep.");
+    // the deferred puts are performed here, afterwards the engine owns copies of the data
+    engine_.EndStep();
+    staged_.clear();
+    inStep_ = false;
+    steps_++;
+}
+
+void Adios2Writer::close()
+{
+    if (!engine_) return;
+    if (inStep_) endStep();
+    engine_.Close();
+}
+
+template void Adios2Writer::putVector<scalar>(const std::string&, const Vector<scalar>&);
+template void Adios2Writer::putVector<Vec3>(const std::string&, const Vector<Vec3>&);
+template void Adios2Writer::putVector<label>(const std::string&, const Vector<label>&);
+
+Adios2Reader::Adios2Reader(
+    const UnstructuredMesh& mesh, const std::string& fileName, const Dictionary& dict
+)
+    : exec_(mesh.exec()),
+#if defined(NF_WITH_MPI_SUPPORT) && ADIOS2_USE_MPI
+      adios_(detail::createAdios(detail::communicator(mesh))),
+#else
+      adios_(),
+#endif
+      io_(detail::declareIO(adios_, "NeoNReader_" + fileName, dict, false)),
+      engine_(io_.Open(fileName, adios2::Mode::Read))
+{
+#if defined(NF_WITH_MPI_SUPPORT) && ADIOS2_USE_MPI
+    block_ = detail::rank(detail::communicator(mesh));
+#endif
+}
+
+Adios2Reader::~Adios2Reader() { close(); }
+
+bool Adios2Reader::beginStep()
+{
+    NF_ASSERT(engine_, "The ADIOS2 engine has already been closed.");
+    NF_ASSERT(!inStep_, "endStep has to be called before the next step is started.");
+    inStep_ = engine_.BeginStep() == adios2::StepStatus::OK;
+    return inStep_;
+}
+
+scalar Adios2Reader::time()
+{
+    NF_ASSERT(inStep_, "beginStep has to be called before variables are read.");
+    auto timeVar = io_.InquireVariable<scalar>("time");
+    if (!timeVar) NF_THROW("The current step has no time.");
+    scalar time = 0;
+    engine_.Get(timeVar, time, adios2::Mode::Sync);
+    return time;
+}
+
+template<typename ValueType>
+Vector<ValueType> Adios2Reader::getHost(const std::string& name)
+{
+    NF_ASSERT(inStep_, "beginStep has to be called before variables are read.");
+    using ElementType = detail::ElementType<ValueType>;
+    auto var = io_.InquireVariable<ElementType>(name);
+    if (!var) NF_THROW("Variable " + name + " is not part of the current step.");
+
+    auto blocks = engine_.BlocksInfo(var, engine_.CurrentStep());
+    if (block_ >= blocks.size()) NF_THROW("Variable " + name + " has no block of this rank.");
+    var.SetBlockSelection(block_);
+
+    Vector<ValueType> hostVector(SerialExecutor {}, static_cast<localIdx>(blocks[block_].Count[0]));
+    engine_.Get(var, reinterpret_cast<ElementType*>(hostVector.data()), adios2::Mode::Sync);
+    return hostVector;
+}
+
+template<typename ValueType>
+Vector<ValueType> Adios2Reader::get(const std::string& name)
+{
+    return Vector<ValueType>(exec_, getHost<ValueType>(name));
+}
+
+template<typename ValueType>
+void Adios2Reader::get(const std::string& name, Vector<ValueType>& vec)
+{
+    auto hostVector = getHost<ValueType>(name);
+    if (hostVector.size() != vec.size())
+    {
+        NF_THROW(
+            "Variable " + name + " has " + std::to_string(hostVector.size())
+            + " values, expected " + std::to_string(vec.size())
+        );
+    }
+    // copy into the existing allocation, thus views of the vector stay valid
+    std::visit(
+        NeoN::detail::deepCopyVisitor(vec.size(), hostVector.data(), vec.data()),
+        hostVector.exec(),
+        vec.exec()
+    );
+}
+
+void Adios2Reader::endStep()
+{
+    NF_ASSERT(inStep_, "beginStep has to be called before endStep.");
+    engine_.EndStep();
+    inStep_ = false;
+}
+
+void Adios2Reader::close()
+{
+    if (!engine_) return;
+    if (inStep_) endStep();
+    engine_.Close();
+}
+
+template Vector<scalar> Adios2Reader::get<scalar>(const std::string&);
+template Vector<Vec3> Adios2Reader::get<Vec3>(const std::string&);
+template Vector<label> Adios2Reader::get<label>(const std::string&);
+template void Adios2Reader::get<scalar>(const std::string&, Vector<scalar>&);
+template void Adios2Reader::get<Vec3>(const std::string&, Vector<Vec3>&);
+template void Adios2Reader::get<label>(const std::string&, Vector<label>&);
+
+} // namespace NeoN::io
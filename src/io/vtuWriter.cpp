@@ -0,0 +1,356 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#if NF_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+#include "NeoN/io/vtuWriter.hpp"
+#include "NeoN/core/error.hpp"
+
+namespace NeoN::io
+{
+
+namespace detail
+{
+
+// uncompressed size of the compressed blocks, identical to the default of VTK
+constexpr size_t vtkBlockSize = 32768;
+
+// cell type of a single point
+constexpr std::uint8_t vtkVertex = 1;
+
+constexpr const char* byteOrder =
+    std::endian::native == std::endian::little ? "LittleEndian" : "BigEndian";
+
+constexpr const char* scalarType = sizeof(scalar) == 8 ? "Float64" : "Float32";
+
+void appendHeader(std::vector<char>& out, std::uint64_t value)
+{
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(value));
+}
+
+template<typename ValueType>
+std::pair<const char*, size_t> bytes(const Vector<ValueType>& vec)
+{
+    const auto nBytes = static_cast<size_t>(vec.size()) * sizeof(ValueType);
+    return {reinterpret_cast<const char*>(vec.data()), nBytes};
+}
+
+std::string timeString(scalar time)
+{
+    std::ostringstream out;
+    out << std::setprecision(std::numeric_limits<scalar>::max_digits10) << time;
+    return out.str();
+}
+
+}
+
+VtuWriter::VtuWriter(
+    const UnstructuredMesh& mesh,
+    const std::filesystem::path& directory,
+    const std::string& name,
+    const Dictionary& dict
+)
+    : directory_(directory), name_(name),
+#if NF_WITH_ZLIB
+      compression_("zlib"),
+#else
+      compression_("none"),
+#endif
+      compressionLevel_(1), queueSize_(2), cellCentres_(mesh.cellCentres().copyToHost())
+{
+    if (dict.contains("compression"))
+    {
+        compression_ = dict.get<std::string>("compression");
+    }
+    if (dict.contains("compressionLevel"))
+    {
+        compressionLevel_ = static_cast<int>(dict.get<label>("compressionLevel"));
+    }
+    if (dict.contains("queueSize"))
+    {
+        queueSize_ = static_cast<size_t>(dict.get<label>("queueSize"));
+    }
+#if NF_WITH_ZLIB
+    if (compression_ != "none" && compression_ != "zlib")
+#else
+    if (compression_ != "none")
+#endif
+    {
+        NF_THROW("Compression " + compression_ + " is not available for the VTU output.");
+    }
+    NF_ASSERT(queueSize_ > 0, "The queue size of the VTU output has to be positive.");
+
+    std::filesystem::create_directories(directory_);
+    worker_ = std::thread(&VtuWriter::run, this);
+}
+
+VtuWriter::~VtuWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    queueChanged_.notify_all();
+    worker_.join();
+}
+
+void VtuWriter::add(const finiteVolume::cellCentred::VolumeField<scalar>& field)
+{
+    fields_.push_back(&field);
+}
+
+void VtuWriter::add(const finiteVolume::cellCentred::VolumeField<Vec3>& field)
+{
+    fields_.push_back(&field);
+}
+
+std::filesystem::path VtuWriter::file(size_t index) const
+{
+    return directory_ / (name_ + "_" + std::to_string(index) + ".vtu");
+}
+
+void VtuWriter::write(scalar time)
+{
+    // the snapshot is taken on the calling thread, thus the fields can be modified afterwards
+    Snapshot snapshot {time, nWrites_++, {}};
+    for (const auto& field : fields_)
+    {
+        std::visit(
+            [&](const auto* f)
+            { snapshot.fields.emplace_back(f->name, f->internalVector().copyToHost()); },
+            field
+        );
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+    queueChanged_.wait(lock, [&] { return queue_.size() < queueSize_; });
+    queue_.push_back(std::move(snapshot));
+    lock.unlock();
+    queueChanged_.notify_all();
+}
+
+void VtuWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    queueChanged_.wait(lock, [&] { return queue_.empty() && !busy_; });
+    if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+}
+
+void VtuWriter::run()
+{
+    while (true)
+    {
+        Snapshot snapshot;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            queueChanged_.wait(lock, [&] { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) return;
+            snapshot = std::move(queue_.front());
+            queue_.pop_front();
+            busy_ = true;
+        }
+        queueChanged_.notify_all();
+
+        try
+        {
+            writeSnapshot(snapshot);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error_ = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            busy_ = false;
+        }
+        queueChanged_.notify_all();
+    }
+}
+
+void VtuWriter::appendBlock(std::vector<char>& out, const char* data, size_t nBytes) const
+{
+    if (compression_ == "none")
+    {
+        detail::appendHeader(out, nBytes);
+        out.insert(out.end(), data, data + nBytes);
+        return;
+    }
+#if NF_WITH_ZLIB
+    // header of compressed data: number of blocks, block size, size of the last partial block
+    // and the compressed size of each block
+    const size_t nBlocks = (nBytes + detail::vtkBlockSize - 1) / detail::vtkBlockSize;
+    detail::appendHeader(out, nBlocks);
+    detail::appendHeader(out, detail::vtkBlockSize);
+    detail::appendHeader(out, nBytes % detail::vtkBlockSize);
+    const size_t sizesStart = out.size();
+    out.resize(sizesStart + nBlocks * sizeof(std::uint64_t));
+
+    for (size_t block = 0; block < nBlocks; block++)
+    {
+        const size_t begin = block * detail::vtkBlockSize;
+        const size_t size = std::min(detail::vtkBlockSize, nBytes - begin);
+        const size_t start = out.size();
+        uLongf compressedSize = compressBound(static_cast<uLong>(size));
+        out.resize(start + compressedSize);
+        int status = compress2(
+            reinterpret_cast<Bytef*>(out.data() + start),
+            &compressedSize,
+            reinterpret_cast<const Bytef*>(data + begin),
+            static_cast<uLong>(size),
+            compressionLevel_
+        );
+        if (status != Z_OK) NF_THROW("zlib compression of the VTU output failed.");
+        out.resize(start + compressedSize);
+
+        const std::uint64_t blockSize = compressedSize;
+        std::memcpy(
+            out.data() + sizesStart + block * sizeof(std::uint64_t), &blockSize, sizeof(blockSize)
+        );
+    }
+#endif
+}
+
+void VtuWriter::encodeMesh()
+{
+    const auto nCells = static_cast<size_t>(cellCentres_.size());
+    std::vector<std::int64_t> connectivity(nCells);
+    std::vector<std::int64_t> offsets(nCells);
+    std::vector<std::uint8_t> types(nCells, detail::vtkVertex);
+    for (size_t i = 0; i < nCells; i++)
+    {
+        connectivity[i] = static_cast<std::int64_t>(i);
+        offsets[i] = static_cast<std::int64_t>(i + 1);
+    }
+
+    auto [points, nPointBytes] = detail::bytes(cellCentres_);
+    meshOffsets_.push_back(encodedMesh_.size());
+    appendBlock(encodedMesh_, points, nPointBytes);
+    meshOffsets_.push_back(encodedMesh_.size());
+    appendBlock(
+        encodedMesh_,
+        reinterpret_cast<const char*>(connectivity.data()),
+        nCells * sizeof(std::int64_t)
+    );
+    meshOffsets_.push_back(encodedMesh_.size());
+    appendBlock(
+        encodedMesh_, reinterpret_cast<const char*>(offsets.data()), nCells * sizeof(std::int64_t)
+    );
+    meshOffsets_.push_back(encodedMesh_.size());
+    appendBlock(encodedMesh_, reinterpret_cast<const char*>(types.data()), nCells);
+}
+
+void VtuWriter::writeSnapshot(const Snapshot& snapshot)
+{
+    if (meshOffsets_.empty()) encodeMesh();
+
+    const auto nCells = cellCentres_.size();
+    std::ostringstream header;
+    header << "<?xml version=\"1.0\"?>\n"
+           << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+           << detail::byteOrder << "\" header_type=\"UInt64\"";
+    if (compression_ == "zlib") header << " compressor=\"vtkZLibDataCompressor\"";
+    header << ">\n"
+           << "  <UnstructuredGrid>\n"
+           << "    <FieldData>\n"
+           << "      <DataArray type=\"" << detail::scalarType
+           << "\" Name=\"TimeValue\" NumberOfTuples=\"1\" format=\"ascii\">"
+           << detail::timeString(snapshot.time) << "</DataArray>\n"
+           << "    </FieldData>\n"
+           << "    <Piece NumberOfPoints=\"" << nCells << "\" NumberOfCells=\"" << nCells << "\">\n"
+           << "      <Points>\n"
+           << "        <DataArray type=\"" << detail::scalarType
+           << "\" NumberOfComponents=\"3\" format=\"appended\" offset=\"" << meshOffsets_[0]
+           << "\"/>\n"
+           << "      </Points>\n"
+           << "      <Cells>\n"
+           << "        <DataArray type=\"Int64\" Name=\"connectivity\" format=\"appended\" "
+           << "offset=\"" << meshOffsets_[1] << "\"/>\n"
+           << "        <DataArray type=\"Int64\" Name=\"offsets\" format=\"appended\" offset=\""
+           << meshOffsets_[2] << "\"/>\n"
+           << "        <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\""
+           << meshOffsets_[3] << "\"/>\n"
+           << "      </Cells>\n"
+           << "      <CellData>\n";
+
+    // only the field data is encoded for every output, it is appended after the mesh
+    std::vector<char> encodedFields;
+    for (const auto& [name, values] : snapshot.fields)
+    {
+        const size_t offset = encodedMesh_.size() + encodedFields.size();
+        std::visit(
+            [&]<typename ValueType>(const Vector<ValueType>& vec)
+            {
+                const int nComponents = std::is_same_v<ValueType, Vec3> ? 3 : 1;
+                header << "        <DataArray type=\"" << detail::scalarType << "\" Name=\"" << name
+                       << "\" NumberOfComponents=\"" << nComponents
+                       << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+                auto [data, nBytes] = detail::bytes(vec);
+                appendBlock(encodedFields, data, nBytes);
+            },
+            values
+        );
+    }
+    header << "      </CellData>\n"
+           << "    </Piece>\n"
+           << "  </UnstructuredGrid>\n"
+           << "  <AppendedData encoding=\"raw\">\n"
+           << "   _";
+
+    const auto path = file(snapshot.index);
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) NF_THROW("Could not open " + path.string() + " for writing.");
+        const auto headerString = header.str();
+        out.write(headerString.data(), static_cast<std::streamsize>(headerString.size()));
+        out.write(encodedMesh_.data(), static_cast<std::streamsize>(encodedMesh_.size()));
+        out.write(encodedFields.data(), static_cast<std::streamsize>(encodedFields.size()));
+        out << "\n  </AppendedData>\n</VTKFile>\n";
+        out.close();
+        if (!out) NF_THROW("Writing " + path.string() + " failed.");
+    }
+
+    writtenFiles_.emplace_back(snapshot.time, path.filename());
+    writeCollection();
+}
+
+void VtuWriter::writeCollection()
+{
+    // the collection is replaced at once, thus viewers never read a partially written file
+    const auto path = directory_ / (name_ + ".pvd");
+    auto tmpPath = path;
+    tmpPath += ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::trunc);
+        if (!out) NF_THROW("Could not open " + tmpPath.string() + " for writing.");
+        out << "<?xml version=\"1.0\"?>\n"
+            << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"" << detail::byteOrder
+            << "\">\n"
+            << "  <Collection>\n";
+        for (const auto& [time, file] : writtenFiles_)
+        {
+            out << "    <DataSet timestep=\"" << detail::timeString(time)
+                << "\" group=\"\" part=\"0\" file=\"" << file.string() << "\"/>\n";
+        }
+        out << "  </Collection>\n"
+            << "</VTKFile>\n";
+    }
+    std::filesystem::rename(tmpPath, path);
+}
+
+} // namespace NeoN::io
@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/segmentedVector.hpp"
+#include "NeoN/linearAlgebra/distributedLinearSystem.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include "NeoN/core/mpi/operators.hpp"
+#endif
+
+namespace NeoN::la
+{
+
+namespace detail
+{
+
+std::vector<globalIdx> computeRankOffsets(const UnstructuredMesh& mesh)
+{
+    auto nCells = static_cast<globalIdx>(mesh.nCells());
+    std::vector<globalIdx> rankOffsets {0, nCells};
+#ifdef NF_WITH_MPI_SUPPORT
+    auto procInterface = ProcessorInterface::read(mesh);
+    if (procInterface)
+    {
+        auto nRankCells = mpi::allGather(nCells, procInterface->mpiEnvironment().comm());
+        rankOffsets.resize(nRankCells.size() + 1);
+        rankOffsets[0] = 0;
+        for (size_t rank = 0; rank < nRankCells.size(); ++rank)
+        {
+            rankOffsets[rank + 1] = rankOffsets[rank] + nRankCells[rank];
+        }
+    }
+#endif
+    return rankOffsets;
+}
+
+globalIdx computeRowStart(const UnstructuredMesh& mesh, const std::vector<globalIdx>& rankOffsets)
+{
+#ifdef NF_WITH_MPI_SUPPORT
+    auto procInterface = ProcessorInterface::read(mesh);
+    if (procInterface)
+    {
+        return rankOffsets[procInterface->mpiEnvironment().rank()];
+    }
+#else
+    (void)mesh;
+#endif
+    return rankOffsets[0];
+}
+
+} // namespace detail
+
+DistributedSparsityPattern::DistributedSparsityPattern(const UnstructuredMesh& mesh)
+    : nLocalRows_(mesh.nCells()), rowStart_(0),
+      nPhysicalBoundaryFaces_(NeoN::nPhysicalBoundaryFaces(mesh)),
+      rankOffsets_(detail::computeRankOffsets(mesh)), rowOffs_(mesh.exec(), mesh.nCells() + 1, 0),
+      colIdxs_(mesh.exec(), mesh.nBoundaryFaces() - nPhysicalBoundaryFaces_, 0),
+      faceOffset_(mesh.exec(), mesh.nBoundaryFaces() - nPhysicalBoundaryFaces_, 0),
+      globalColIdxs_(mesh.exec(), mesh.nBoundaryFaces(), static_cast<globalIdx>(-1))
+{
+    rowStart_ = detail::computeRowStart(mesh, rankOffsets_);
+
+    // every processor face adds one non-local entry to the row of its cell
+    const auto nPhysical = nPhysicalBoundaryFaces_;
+    const auto exec = mesh.exec();
+    auto nFacesPerCell = Vector<localIdx>(exec, nLocalRows_, 0);
+    auto [nFacesPerCellV, rowOffs, colIdxs, faceOffset, faceCells] = views(
+        nFacesPerCell, rowOffs_, colIdxs_, faceOffset_, mesh.boundaryMesh().faceCells()
+    );
+
+    parallelFor(
+        exec,
+        {0, colIdxs_.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            Kokkos::atomic_inc(&nFacesPerCellV[faceCells[nPhysical + i]]);
+        },
+        "DistributedSparsityPattern::countNonLocal"
+    );
+    segmentsFromIntervals(nFacesPerCell, rowOffs_);
+    fill(nFacesPerCell, 0);
+    parallelFor(
+        exec,
+        {0, colIdxs_.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            auto bfacei = nPhysical + i;
+            auto celli = faceCells[bfacei];
+            auto offset = rowOffs[celli] + Kokkos::atomic_fetch_add(&nFacesPerCellV[celli], 1);
+            colIdxs[offset] = bfacei;
+            faceOffset[i] = offset;
+        },
+        "DistributedSparsityPattern::fillNonLocal"
+    );
+
+    // the neighbour cells send their global rows into the processor faces
+    auto procInterface = ProcessorInterface::read(mesh);
+    if (procInterface)
+    {
+        Vector<globalIdx> globalRows(exec, nLocalRows_);
+        auto globalRowsV = globalRows.view();
+        auto rowStart = rowStart_;
+        parallelFor(
+            exec,
+            {0, nLocalRows_},
+            KOKKOS_LAMBDA(const localIdx celli) {
+                globalRowsV[celli] = rowStart + static_cast<globalIdx>(celli);
+            },
+            "DistributedSparsityPattern::globalRows"
+        );
+        procInterface->startExchange(globalRows, "DistributedSparsityPattern");
+        procInterface->finishExchange(globalRows, globalColIdxs_, "DistributedSparsityPattern");
+    }
+}
+
+const DistributedSparsityPattern&
+DistributedSparsityPattern::readOrCreate(const UnstructuredMesh& mesh)
+{
+    auto& db = mesh.stencilDB();
+    if (!db.contains("DistributedSparsityPattern"))
+    {
+        db.insert(std::string("DistributedSparsityPattern"), DistributedSparsityPattern(mesh));
+    }
+    return db.get<DistributedSparsityPattern>("DistributedSparsityPattern");
+}
+
+void spmv(
+    const DistributedLinearSystem<scalar, localIdx>& ls,
+    const Vector<scalar>& xV,
+    Vector<scalar>& yV
+)
+{
+    const auto& mesh = ls.mesh();
+    auto procInterface = ProcessorInterface::read(mesh);
+    if (procInterface)
+    {
+        procInterface->startExchange(xV, "la::spmv");
+    }
+
+    auto [y, x] = views(yV, xV);
+    const auto [coeffs, colIdxs, rowOffs] = ls.localSystem().matrix().view();
+    parallelFor(
+        yV.exec(),
+        {0, yV.size()},
+        KOKKOS_LAMBDA(const localIdx rowi) {
+            scalar sum = 0.0;
+            for (localIdx coli = rowOffs[rowi]; coli < rowOffs[rowi + 1]; coli++)
+            {
+                sum += coeffs[coli] * x[colIdxs[coli]];
+            }
+            y[rowi] = sum;
+        },
+        "spmv::local"
+    );
+
+    if (!procInterface)
+    {
+        return;
+    }
+
+    const auto& haloV = procInterface->finishExchange(xV, "la::spmv");
+
+    auto halo = haloV.view();
+    const auto [nonLocalCoeffs, nonLocalColIdxs, nonLocalRowOffs] = ls.nonLocalMatrix().view();
+    parallelFor(
+        yV.exec(),
+        {0, yV.size()},
+        KOKKOS_LAMBDA(const localIdx rowi) {
+            scalar sum = 0.0;
+            for (localIdx coli = nonLocalRowOffs[rowi]; coli < nonLocalRowOffs[rowi + 1]; coli++)
+            {
+                sum += nonLocalCoeffs[coli] * halo[nonLocalColIdxs[coli]];
+            }
+            y[rowi] += sum;
+        },
+        "spmv::nonLocal"
+    );
+}
+
+void computeResidual(
+    const DistributedLinearSystem<scalar, localIdx>& ls,
+    const Vector<scalar>& x,
+    Vector<scalar>& res
+)
+{
+    spmv(ls, x, res);
+    res -= ls.localSystem().rhs();
+}
+
+} // namespace NeoN::la
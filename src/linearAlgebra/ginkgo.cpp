@@ -4,9 +4,13 @@
 
 #if NF_WITH_GINKGO
 
+#include <algorithm>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #include "NeoN/linearAlgebra/ginkgo.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
 
 gko::config::pnode NeoN::la::ginkgo::parse(const Dictionary& dictIn)
 {
@@ -273,6 +277,38 @@ SolverStats solve_impl(
 }
 
 
+void GinkgoSolver::setAbsoluteTolerance(scalar tolerance)
+{
+    if (tolerance == absoluteTolerance_) return;
+    absoluteTolerance_ = tolerance;
+    auto config = config_.get_map();
+    const auto& criteria = config_.get("criteria");
+    if (criteria.get_tag() == gko::config::pnode::tag_t::array)
+    {
+        auto criteriaArray = criteria.get_array();
+        criteriaArray.emplace_back(gko::config::pnode::map_type {
+            {"type", gko::config::pnode("stop::ResidualNorm")},
+            {"baseline", gko::config::pnode("absolute")},
+            {"reduction_factor", gko::config::pnode(tolerance)}
+        });
+        config["criteria"] = gko::config::pnode(criteriaArray);
+    }
+    else
+    {
+        auto criteriaMap = criteria.get_tag() == gko::config::pnode::tag_t::map
+                             ? criteria.get_map()
+                             : gko::config::pnode::map_type {};
+        criteriaMap["absolute_residual_norm"] = gko::config::pnode(tolerance);
+        config["criteria"] = gko::config::pnode(criteriaMap);
+    }
+    factory_ = gko::config::parse(
+                   gko::config::pnode(config),
+                   gko::config::registry(),
+                   gko::config::make_type_descriptor<scalar>()
+    )
+                   .on(gkoExec_);
+}
+
 SolverStats GinkgoSolver::solve(const LinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const
 {
     auto gkoMtx = createGkoMtx(gkoExec_, sys);
@@ -280,6 +316,261 @@ SolverStats GinkgoSolver::solve(const LinearSystem<scalar, localIdx>& sys, Vecto
     return solve_impl(gkoExec_, sys.rhs(), x, gkoMtx, std::move(solver));
 }
 
+namespace detail
+{
+
+#if NF_WITH_MPI_SUPPORT && GINKGO_BUILD_MPI
+using Partition = gko::experimental::distributed::Partition<localIdx, globalIdx>;
+#endif
+
+/* @brief The rows of the calling rank in global numbering and row-major order.
+ *
+ * The local block is shifted by the first global row, the non-local block is mapped from boundary
+ * faces to the global row of the neighbour cell. Entry i sums the sources
+ * [segments[i], segments[i + 1]), where sources beyond the local block refer to the non-local
+ * block. The structure is built once per sparsity pattern, thus a solve only gathers the values
+ * on the device.
+ */
+template<typename IndexType>
+struct GlobalMatrixStructure
+{
+    localIdx nLocalEntries;
+
+    localIdx nNonLocalEntries;
+
+    Vector<IndexType> rows;
+
+    Vector<IndexType> cols;
+
+    Vector<localIdx> segments;
+
+    Vector<localIdx> sources;
+
+    Vector<scalar> values;
+
+#if NF_WITH_MPI_SUPPORT && GINKGO_BUILD_MPI
+    std::shared_ptr<const Partition> partition {};
+#endif
+};
+
+template<typename IndexType>
+GlobalMatrixStructure<IndexType>
+createGlobalMatrixStructure(const DistributedLinearSystem<scalar, localIdx>& sys)
+{
+    const auto& pattern = sys.sparsityPattern();
+    const auto& localMtx = sys.localSystem().matrix();
+    const auto& nonLocalMtx = sys.nonLocalMatrix();
+    auto [colIdxs, rowOffs, nonLocalColIdxs, nonLocalRowOffs, globalColIdxs] = copyToHosts(
+        localMtx.colIdxs(),
+        localMtx.rowOffs(),
+        nonLocalMtx.colIdxs(),
+        nonLocalMtx.rowOffs(),
+        pattern.globalColIdxs()
+    );
+    const auto nLocalEntries = localMtx.colIdxs().size();
+    const auto rowStart = static_cast<IndexType>(pattern.rowStart());
+
+    std::vector<IndexType> rows;
+    std::vector<IndexType> cols;
+    std::vector<localIdx> segments {0};
+    std::vector<localIdx> sources;
+    std::vector<std::pair<IndexType, localIdx>> rowEntries;
+    for (localIdx rowi = 0; rowi < pattern.nLocalRows(); rowi++)
+    {
+        rowEntries.clear();
+        for (localIdx j = rowOffs.view()[rowi]; j < rowOffs.view()[rowi + 1]; j++)
+        {
+            rowEntries.emplace_back(rowStart + static_cast<IndexType>(colIdxs.view()[j]), j);
+        }
+        for (localIdx j = nonLocalRowOffs.view()[rowi]; j < nonLocalRowOffs.view()[rowi + 1]; j++)
+        {
+            rowEntries.emplace_back(
+                static_cast<IndexType>(globalColIdxs.view()[nonLocalColIdxs.view()[j]]),
+                nLocalEntries + j
+            );
+        }
+        std::sort(rowEntries.begin(), rowEntries.end());
+        for (std::size_t k = 0; k < rowEntries.size(); k++)
+        {
+            if (k == 0 || rowEntries[k].first != rowEntries[k - 1].first)
+            {
+                if (k > 0) segments.push_back(static_cast<localIdx>(sources.size()));
+                rows.push_back(rowStart + static_cast<IndexType>(rowi));
+                cols.push_back(rowEntries[k].first);
+            }
+            sources.push_back(rowEntries[k].second);
+        }
+        if (!rowEntries.empty()) segments.push_back(static_cast<localIdx>(sources.size()));
+    }
+
+    const auto exec = sys.exec();
+    const auto nEntries = static_cast<localIdx>(rows.size());
+    return {
+        .nLocalEntries = nLocalEntries,
+        .nNonLocalEntries = nonLocalMtx.colIdxs().size(),
+        .rows = Vector<IndexType>(exec, rows),
+        .cols = Vector<IndexType>(exec, cols),
+        .segments = Vector<localIdx>(exec, segments),
+        .sources = Vector<localIdx>(exec, sources),
+        .values = Vector<scalar>(exec, nEntries, 0.0)
+    };
+}
+
+/* @brief the global matrix structure cached with the sparsity pattern of the mesh */
+template<typename IndexType>
+GlobalMatrixStructure<IndexType>&
+globalMatrixStructure(const DistributedLinearSystem<scalar, localIdx>& sys)
+{
+    using Structure = GlobalMatrixStructure<IndexType>;
+    auto& db = sys.mesh().stencilDB();
+    const std::string key = "GinkgoGlobalMatrixStructure";
+    if (!db.contains(key)
+        || db.get<Structure>(key).nLocalEntries != sys.localSystem().matrix().colIdxs().size()
+        || db.get<Structure>(key).nNonLocalEntries != sys.nonLocalMatrix().colIdxs().size())
+    {
+        db.insert(key, createGlobalMatrixStructure<IndexType>(sys));
+    }
+    return db.get<Structure>(key);
+}
+
+/* @brief gathers the values of the local and non-local block into the global entries */
+template<typename IndexType>
+gko::device_matrix_data<scalar, IndexType> globalMatrixData(
+    std::shared_ptr<const gko::Executor> gkoExec,
+    const DistributedLinearSystem<scalar, localIdx>& sys,
+    GlobalMatrixStructure<IndexType>& structure
+)
+{
+    const auto nLocalEntries = structure.nLocalEntries;
+    auto [values, segments, sources, localValues, nonLocalValues] = views(
+        structure.values,
+        structure.segments,
+        structure.sources,
+        sys.localSystem().matrix().values(),
+        sys.nonLocalMatrix().values()
+    );
+    parallelFor(
+        sys.exec(),
+        {0, values.size()},
+        KOKKOS_LAMBDA(const localIdx i) {
+            scalar value = 0.0;
+            for (auto j = segments[i]; j < segments[i + 1]; j++)
+            {
+                const auto sourcei = sources[j];
+                value += sourcei < nLocalEntries ? localValues[sourcei]
+                                                 : nonLocalValues[sourcei - nLocalEntries];
+            }
+            values[i] = value;
+        },
+        "ginkgo::globalMatrixData"
+    );
+    const auto nGlobalRows = static_cast<gko::size_type>(sys.sparsityPattern().nGlobalRows());
+    const auto nEntries = static_cast<gko::size_type>(structure.values.size());
+    return gko::device_matrix_data<scalar, IndexType>(
+        gkoExec,
+        gko::dim<2> {nGlobalRows, nGlobalRows},
+        gko::array<IndexType>::view(gkoExec, nEntries, structure.rows.data()),
+        gko::array<IndexType>::view(gkoExec, nEntries, structure.cols.data()),
+        gko::array<scalar>::view(gkoExec, nEntries, structure.values.data())
+    );
+}
+
+}
+
+SolverStats
+GinkgoSolver::solve(const DistributedLinearSystem<scalar, localIdx>& sys, Vector<scalar>& x) const
+{
+#if NF_WITH_MPI_SUPPORT && GINKGO_BUILD_MPI
+    namespace dist = gko::experimental::distributed;
+    auto startEval = std::chrono::steady_clock::now();
+
+    using vec = gko::matrix::Dense<scalar>;
+    using dist_vec = dist::Vector<scalar>;
+    using dist_mtx = dist::Matrix<scalar, localIdx, globalIdx>;
+
+    const auto& pattern = sys.sparsityPattern();
+    auto procInterface = ProcessorInterface::read(sys.mesh());
+    NF_ASSERT(procInterface, "The mesh of the distributed system is not decomposed.");
+    gko::experimental::mpi::communicator comm(procInterface->mpiEnvironment().comm());
+
+    auto& structure = detail::globalMatrixStructure<globalIdx>(sys);
+    if (!structure.partition || structure.partition->get_executor() != gkoExec_)
+    {
+        const auto& offsets = pattern.rankOffsets();
+        // the partition is built on the executor, thus the ranges are copied from the host
+        auto ranges = gko::array<globalIdx>(
+            gkoExec_,
+            gko::array<globalIdx>(gkoExec_->get_master(), offsets.begin(), offsets.end())
+        );
+        structure.partition =
+            gko::share(detail::Partition::build_from_contiguous(gkoExec_, ranges));
+    }
+    auto gkoMtx = gko::share(dist_mtx::create(gkoExec_, comm));
+    gkoMtx->read_distributed(
+        detail::globalMatrixData(gkoExec_, sys, structure), structure.partition
+    );
+
+    auto nLocalRows = sys.localSystem().rhs().size();
+    auto nGlobalRows = static_cast<gko::size_type>(pattern.nGlobalRows());
+    auto rhsCopy = Vector<scalar>(sys.localSystem().rhs());
+    auto toDistVec = [&](scalar* ptr)
+    {
+        auto localSize = static_cast<gko::size_type>(nLocalRows);
+        return dist_vec::create(
+            gkoExec_,
+            comm,
+            gko::dim<2> {nGlobalRows, 1},
+            vec::create(
+                gkoExec_,
+                gko::dim<2> {localSize, 1},
+                gkoArrayView(gkoExec_, std::span {ptr, localSize}),
+                1
+            )
+        );
+    };
+    // the local vectors are views, thus the solution is written to x directly
+    auto b = toDistVec(rhsCopy.data());
+    auto gkoX = toDistVec(x.data());
+    auto rhsRes = Vector<scalar>(sys.localSystem().rhs());
+    auto res = toDistVec(rhsRes.data());
+
+    auto one = gko::initialize<vec>({1.0}, gkoExec_);
+    auto neg_one = gko::initialize<vec>({-1.0}, gkoExec_);
+    gkoMtx->apply(one, gkoX, neg_one, res);
+    auto init = gko::initialize<vec>({0.0}, gkoExec_);
+    res->compute_norm2(init);
+    scalar initResNorm = retrieve(init);
+
+    auto solver = factory_->generate(gkoMtx);
+    std::shared_ptr<const gko::log::Convergence<scalar>> logger =
+        gko::log::Convergence<scalar>::create();
+    solver->add_logger(logger);
+    solver->apply(b, gkoX);
+
+    scalar finalResNorm = retrieve(gko::as<vec>(logger->get_residual_norm()));
+    auto numIter = label(logger->get_num_iterations());
+    auto endEval = std::chrono::steady_clock::now();
+    auto duration =
+        static_cast<scalar>(
+            std::chrono::duration_cast<std::chrono::microseconds>(endEval - startEval).count()
+        )
+        / 1000.0;
+
+    return {numIter, initResNorm, finalResNorm, duration};
+#else
+    NF_ASSERT(
+        sys.sparsityPattern().rankOffsets().size() == 2,
+        "Ginkgo is built without MPI support, distributed systems are limited to a single part."
+    );
+    // a single part numbers its rows locally, the non-local block couples periodic faces
+    auto& structure = detail::globalMatrixStructure<localIdx>(sys);
+    auto gkoMtx = gko::share(gko::matrix::Csr<scalar, localIdx>::create(gkoExec_));
+    gkoMtx->read(detail::globalMatrixData(gkoExec_, sys, structure));
+    auto solver = factory_->generate(gkoMtx);
+    return solve_impl(gkoExec_, sys.localSystem().rhs(), x, gkoMtx, std::move(solver));
+#endif
+}
+
 /* @brief create a ginkgo csr matrix by unpacking and copying the Csr<Vec3> input */
 template<typename IndexType>
 std::shared_ptr<const gko::matrix::Csr<scalar, IndexType>>
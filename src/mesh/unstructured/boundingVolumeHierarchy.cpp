@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <Kokkos_Sort.hpp>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/mesh/unstructured/boundingVolumeHierarchy.hpp"
+
+namespace NeoN
+{
+
+namespace detail
+{
+
+// the number of bits of the Morton code per direction
+constexpr int mortonBits = 21;
+
+localIdx nLeaves(localIdx nPrimitives)
+{
+    const localIdx nBuckets =
+        (nPrimitives + BoundingVolumeHierarchy::leafSize - 1) / BoundingVolumeHierarchy::leafSize;
+    localIdx leaves = 1;
+    while (leaves < nBuckets)
+    {
+        leaves *= 2;
+    }
+    return nPrimitives > 0 ? leaves : 0;
+}
+
+/* @brief inserts two zero bits between the lower 21 bits of the value */
+KOKKOS_INLINE_FUNCTION
+std::uint64_t expandBits(std::uint64_t value)
+{
+    value &= 0x1fffff;
+    value = (value | value << 32) & 0x1f00000000ffff;
+    value = (value | value << 16) & 0x1f0000ff0000ff;
+    value = (value | value << 8) & 0x100f00f00f00f00f;
+    value = (value | value << 4) & 0x10c30c30c30c30c3;
+    value = (value | value << 2) & 0x1249249249249249;
+    return value;
+}
+
+KOKKOS_INLINE_FUNCTION
+std::uint64_t mortonCode(const BoundingBox& bounds, const Vec3& point)
+{
+    constexpr scalar maxCoordinate = scalar((1 << mortonBits) - 1);
+    std::uint64_t code = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        const scalar extent = bounds.max[i] - bounds.min[i];
+        const scalar coordinate = extent > 0.0 ? (point[i] - bounds.min[i]) / extent : 0.0;
+        code |= expandBits(static_cast<std::uint64_t>(coordinate * maxCoordinate)) << i;
+    }
+    return code;
+}
+
+void sortByKey(const Executor& exec, Vector<std::uint64_t>& keys, Vector<localIdx>& values)
+{
+    std::visit(
+        [&](const auto& concreteExec)
+        {
+            auto keyView = concreteExec.createKokkosView(keys.data(), keys.size());
+            auto valueView = concreteExec.createKokkosView(values.data(), values.size());
+            Kokkos::Experimental::sort_by_key(concreteExec.underlyingExec(), keyView, valueView);
+        },
+        exec
+    );
+}
+
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(const Array<BoundingBox>& boxes)
+    : nPrimitives_(boxes.size()), nLeaves_(detail::nLeaves(boxes.size())),
+      nodes_(boxes.exec(), nLeaves_ > 0 ? 2 * nLeaves_ - 1 : 0),
+      primitives_(boxes.exec(), boxes.size())
+{
+    if (nPrimitives_ == 0) return;
+    const auto exec = boxes.exec();
+    const auto boxView = boxes.view();
+
+    BoundingBox bounds;
+    parallelReduce(
+        exec,
+        {0, nPrimitives_},
+        KOKKOS_LAMBDA(const localIdx i, BoundingBox& local) { local.add(boxView[i].centre()); },
+        bounds
+    );
+
+    // sort the primitives along the Morton curve
+    Vector<std::uint64_t> codes(exec, nPrimitives_);
+    auto [codeView, primitiveView] = views(codes, primitives_);
+    parallelFor(
+        exec,
+        {0, nPrimitives_},
+        KOKKOS_LAMBDA(const localIdx i) {
+            codeView[i] = detail::mortonCode(bounds, boxView[i].centre());
+            primitiveView[i] = i;
+        },
+        "computeMortonCodes"
+    );
+    detail::sortByKey(exec, codes, primitives_);
+
+    const auto tree = view();
+    auto nodeView = nodes_.view();
+    const auto firstLeaf = nLeaves_ - 1;
+    parallelFor(
+        exec,
+        {0, nLeaves_},
+        KOKKOS_LAMBDA(const localIdx leaf) {
+            BoundingBox box;
+            for (localIdx i = tree.leafBegin(leaf); i < tree.leafBegin(leaf + 1); i++)
+            {
+                box += boxView[primitiveView[i]];
+            }
+            nodeView[firstLeaf + leaf] = box;
+        },
+        "computeLeafBoxes"
+    );
+
+    // every level of the tree depends on the level below
+    for (localIdx nLevelNodes = nLeaves_ / 2; nLevelNodes > 0; nLevelNodes /= 2)
+    {
+        parallelFor(
+            exec,
+            {nLevelNodes - 1, 2 * nLevelNodes - 1},
+            KOKKOS_LAMBDA(const localIdx node) {
+                BoundingBox box = nodeView[2 * node + 1];
+                box += nodeView[2 * node + 2];
+                nodeView[node] = box;
+            },
+            "computeNodeBoxes"
+        );
+    }
+}
+
+} // namespace NeoN
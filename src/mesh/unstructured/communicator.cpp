@@ -7,6 +7,51 @@
 namespace NeoN
 {
 
+namespace detail
+{
+
+std::vector<localIdx> flattenCommMap(const CommMap& commMap)
+{
+    std::vector<localIdx> indices;
+    for (const auto& rankMap : commMap)
+    {
+        for (const auto& node : rankMap)
+        {
+            indices.push_back(node.local_idx);
+        }
+    }
+    return indices;
+}
+
+}
+
+Communicator::Communicator(
+    mpi::MPIEnvironment mpiEnviron,
+    const Executor& exec,
+    const CommMap& rankSendMap,
+    const CommMap& rankReceiveMap,
+    mpi::BufferSpace space
+)
+    : mpiEnviron_(mpiEnviron), exec_(exec), space_(space),
+      rankSendSize_(rankSendMap.size()), rankReceiveSize_(rankReceiveMap.size()),
+      sendIdx_(exec, detail::flattenCommMap(rankSendMap)),
+      receiveIdx_(exec, detail::flattenCommMap(rankReceiveMap))
+{
+    NF_DEBUG_ASSERT(
+        mpiEnviron_.sizeRank() == rankSendMap.size(),
+        "Size of rankSendSize does not match MPI size."
+    );
+    NF_DEBUG_ASSERT(
+        mpiEnviron_.sizeRank() == rankReceiveMap.size(),
+        "Size of rankReceiveSize does not match MPI size."
+    );
+    for (size_t rank = 0; rank < rankSendMap.size(); ++rank)
+    {
+        rankSendSize_[rank] = rankSendMap[rank].size();
+        rankReceiveSize_[rank] = rankReceiveMap[rank].size();
+    }
+}
+
 bool Communicator::isComplete(std::string commName)
 {
     NF_DEBUG_ASSERT(
@@ -16,8 +61,10 @@ bool Communicator::isComplete(std::string commName)
     return CommBuffer_[commName]->isComplete();
 }
 
-Communicator::bufferType* Communicator::findDuplexBuffer()
+Communicator::bufferType* Communicator::findDuplexBuffer(const std::string& commName)
 {
+    auto last = lastBuffer_.find(commName);
+    if (last != lastBuffer_.end() && !last->second->isCommInit()) return last->second;
     for (auto it = buffers.begin(); it != buffers.end(); ++it)
         if (!it->isCommInit()) return &(*it);
     return nullptr;
@@ -25,15 +72,7 @@ Communicator::bufferType* Communicator::findDuplexBuffer()
 
 Communicator::bufferType* Communicator::createNewDuplexBuffer()
 {
-    // determine buffer size.
-    std::vector<std::size_t> rankSendSize(mpiEnviron_.sizeRank());
-    std::vector<std::size_t> rankReceiveSize(mpiEnviron_.sizeRank());
-    for (size_t rank = 0; rank < mpiEnviron_.sizeRank(); ++rank)
-    {
-        rankSendSize[rank] = sendMap_[rank].size();
-        rankReceiveSize[rank] = receiveMap_[rank].size();
-    }
-    buffers.emplace_back(mpi::FullDuplexCommBuffer(mpiEnviron_, rankSendSize, rankReceiveSize));
+    buffers.emplace_back(mpiEnviron_, rankSendSize_, rankReceiveSize_, exec_, space_);
     return &buffers.back();
 }
 };
@@ -0,0 +1,909 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+
+#include "NeoN/core/containerFreeFunctions.hpp"
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/primitives/vec3.hpp"
+#include "NeoN/mesh/unstructured/decomposition.hpp"
+
+namespace NeoN
+{
+
+namespace detail
+{
+
+/* @brief weighted undirected graph in CSR format, vertices are cells or aggregates of cells */
+struct CellGraph
+{
+    std::vector<localIdx> offsets;
+
+    std::vector<localIdx> adjacency;
+
+    std::vector<localIdx> edgeWeights;
+
+    std::vector<localIdx> vertexWeights;
+
+    localIdx nVertices() const { return static_cast<localIdx>(vertexWeights.size()); }
+};
+
+CellGraph createCellGraph(const UnstructuredMesh& mesh)
+{
+    const auto nCells = mesh.nCells();
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto [ownerH, neighbourH] = copyToHosts(mesh.faceOwner(), mesh.faceNeighbour());
+    const auto [owner, neighbour] = views(ownerH, neighbourH);
+
+    CellGraph graph;
+    graph.offsets.assign(static_cast<size_t>(nCells + 1), 0);
+    graph.vertexWeights.assign(static_cast<size_t>(nCells), 1);
+    for (localIdx facei = 0; facei < nInternalFaces; facei++)
+    {
+        graph.offsets[static_cast<size_t>(owner[facei] + 1)]++;
+        graph.offsets[static_cast<size_t>(neighbour[facei] + 1)]++;
+    }
+    std::partial_sum(graph.offsets.begin(), graph.offsets.end(), graph.offsets.begin());
+    graph.adjacency.resize(static_cast<size_t>(graph.offsets.back()));
+    graph.edgeWeights.assign(graph.adjacency.size(), 1);
+
+    std::vector<localIdx> pos(graph.offsets.begin(), graph.offsets.end() - 1);
+    for (localIdx facei = 0; facei < nInternalFaces; facei++)
+    {
+        graph.adjacency[static_cast<size_t>(pos[static_cast<size_t>(owner[facei])]++)] =
+            neighbour[facei];
+        graph.adjacency[static_cast<size_t>(pos[static_cast<size_t>(neighbour[facei])]++)] =
+            owner[facei];
+    }
+    return graph;
+}
+
+std::vector<Vec3> hostCellCentres(const UnstructuredMesh& mesh)
+{
+    auto centresH = mesh.cellCentres().copyToHost();
+    auto centres = centresH.view();
+    return std::vector<Vec3>(centres.begin(), centres.end());
+}
+
+/* @brief recursive bisection of the cells by a splitting direction returned by axisFunc
+ *
+ * The cells are sorted along the projection onto the splitting direction and split such that
+ * the number of cells of both halves is proportional to the number of parts assigned to them.
+ */
+template<typename AxisFunc>
+void recursiveBisection(
+    const std::vector<Vec3>& centres,
+    std::vector<localIdx>::iterator begin,
+    std::vector<localIdx>::iterator end,
+    label firstPart,
+    label nParts,
+    std::vector<label>& cellToPart,
+    AxisFunc axisFunc
+)
+{
+    if (nParts == 1 || begin == end)
+    {
+        for (auto it = begin; it != end; ++it)
+        {
+            cellToPart[static_cast<size_t>(*it)] = firstPart;
+        }
+        return;
+    }
+    const Vec3 axis = axisFunc(centres, begin, end);
+    const label nPartsLeft = nParts / 2;
+    const auto nCells = static_cast<std::size_t>(std::distance(begin, end));
+    const auto nCellsLeft = static_cast<std::ptrdiff_t>(
+        (nCells * static_cast<std::size_t>(nPartsLeft)) / static_cast<std::size_t>(nParts)
+    );
+    auto mid = begin + nCellsLeft;
+    std::nth_element(
+        begin,
+        mid,
+        end,
+        [&](const localIdx a, const localIdx b)
+        {
+            const scalar pa = centres[static_cast<size_t>(a)] & axis;
+            const scalar pb = centres[static_cast<size_t>(b)] & axis;
+            // tie break on the index to obtain a deterministic split
+            return (pa < pb) || (pa == pb && a < b);
+        }
+    );
+    recursiveBisection(centres, begin, mid, firstPart, nPartsLeft, cellToPart, axisFunc);
+    recursiveBisection(
+        centres, mid, end, firstPart + nPartsLeft, nParts - nPartsLeft, cellToPart, axisFunc
+    );
+}
+
+Vec3 longestBoundingBoxAxis(
+    const std::vector<Vec3>& centres,
+    std::vector<localIdx>::iterator begin,
+    std::vector<localIdx>::iterator end
+)
+{
+    Vec3 minC = centres[static_cast<size_t>(*begin)];
+    Vec3 maxC = minC;
+    for (auto it = begin; it != end; ++it)
+    {
+        const auto& c = centres[static_cast<size_t>(*it)];
+        for (size_t d = 0; d < 3; d++)
+        {
+            minC[d] = std::min(minC[d], c[d]);
+            maxC[d] = std::max(maxC[d], c[d]);
+        }
+    }
+    const Vec3 extent = maxC - minC;
+    size_t dir = 0;
+    for (size_t d = 1; d < 3; d++)
+    {
+        if (extent[d] > extent[dir]) dir = d;
+    }
+    Vec3 axis(0.0, 0.0, 0.0);
+    axis[dir] = 1.0;
+    return axis;
+}
+
+Vec3 principalInertiaAxis(
+    const std::vector<Vec3>& centres,
+    std::vector<localIdx>::iterator begin,
+    std::vector<localIdx>::iterator end
+)
+{
+    const auto n = static_cast<scalar>(std::distance(begin, end));
+    Vec3 mean(0.0, 0.0, 0.0);
+    for (auto it = begin; it != end; ++it)
+    {
+        mean += centres[static_cast<size_t>(*it)];
+    }
+    mean = (1.0 / n) * mean;
+
+    // covariance matrix of the centres
+    std::array<std::array<scalar, 3>, 3> cov {};
+    for (auto it = begin; it != end; ++it)
+    {
+        const Vec3 d = centres[static_cast<size_t>(*it)] - mean;
+        for (size_t i = 0; i < 3; i++)
+        {
+            for (size_t j = 0; j < 3; j++)
+            {
+                cov[i][j] += d[i] * d[j];
+            }
+        }
+    }
+
+    // the power iteration converges to the eigenvector of the largest eigenvalue, starting
+    // from the longest bounding box axis avoids a start vector orthogonal to it
+    Vec3 axis = longestBoundingBoxAxis(centres, begin, end);
+    for (int iter = 0; iter < 50; iter++)
+    {
+        Vec3 next(0.0, 0.0, 0.0);
+        for (size_t i = 0; i < 3; i++)
+        {
+            next[i] = cov[i][0] * axis[0] + cov[i][1] * axis[1] + cov[i][2] * axis[2];
+        }
+        const scalar norm = mag(next);
+        if (norm <= ROOTVSMALL) break;
+        next = (1.0 / norm) * next;
+        const scalar change = mag(next - axis);
+        axis = next;
+        if (change < 1e-10) break;
+    }
+    return axis;
+}
+
+/* @brief contracts the graph by heavy-edge matching
+ * @param coarseMap on return, maps every vertex of the fine graph to its coarse vertex
+ */
+CellGraph coarsen(const CellGraph& fine, std::vector<localIdx>& coarseMap)
+{
+    const auto n = fine.nVertices();
+    coarseMap.assign(static_cast<size_t>(n), -1);
+
+    // visit vertices with few neighbours first, since they have the fewest matching candidates
+    std::vector<localIdx> order(static_cast<size_t>(n));
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(
+        order.begin(),
+        order.end(),
+        [&](const localIdx a, const localIdx b)
+        {
+            const auto sa = static_cast<size_t>(a);
+            const auto sb = static_cast<size_t>(b);
+            return fine.offsets[sa + 1] - fine.offsets[sa]
+                 < fine.offsets[sb + 1] - fine.offsets[sb];
+        }
+    );
+
+    localIdx nCoarse = 0;
+    for (const auto v : order)
+    {
+        const auto sv = static_cast<size_t>(v);
+        if (coarseMap[sv] != -1) continue;
+        localIdx match = -1;
+        localIdx maxWeight = 0;
+        for (auto k = fine.offsets[sv]; k < fine.offsets[sv + 1]; k++)
+        {
+            const auto u = fine.adjacency[static_cast<size_t>(k)];
+            const auto w = fine.edgeWeights[static_cast<size_t>(k)];
+            if (coarseMap[static_cast<size_t>(u)] == -1 && u != v && w > maxWeight)
+            {
+                match = u;
+                maxWeight = w;
+            }
+        }
+        coarseMap[sv] = nCoarse;
+        if (match != -1) coarseMap[static_cast<size_t>(match)] = nCoarse;
+        nCoarse++;
+    }
+
+    // collect the members of every coarse vertex to merge their adjacency lists
+    std::vector<localIdx> memberOffsets(static_cast<size_t>(nCoarse + 1), 0);
+    for (localIdx v = 0; v < n; v++)
+    {
+        memberOffsets[static_cast<size_t>(coarseMap[static_cast<size_t>(v)] + 1)]++;
+    }
+    std::partial_sum(memberOffsets.begin(), memberOffsets.end(), memberOffsets.begin());
+    std::vector<localIdx> members(static_cast<size_t>(n));
+    std::vector<localIdx> pos(memberOffsets.begin(), memberOffsets.end() - 1);
+    for (localIdx v = 0; v < n; v++)
+    {
+        members[static_cast<size_t>(pos[static_cast<size_t>(coarseMap[static_cast<size_t>(v)])]++
+        )] = v;
+    }
+
+    CellGraph coarse;
+    coarse.offsets.reserve(static_cast<size_t>(nCoarse + 1));
+    coarse.offsets.push_back(0);
+    coarse.vertexWeights.assign(static_cast<size_t>(nCoarse), 0);
+    // marker[c] holds the position of the edge to c in the adjacency of the current vertex
+    std::vector<localIdx> marker(static_cast<size_t>(nCoarse), -1);
+    for (localIdx c = 0; c < nCoarse; c++)
+    {
+        const auto rowStart = static_cast<localIdx>(coarse.adjacency.size());
+        for (auto m = memberOffsets[static_cast<size_t>(c)];
+             m < memberOffsets[static_cast<size_t>(c + 1)];
+             m++)
+        {
+            const auto v = static_cast<size_t>(members[static_cast<size_t>(m)]);
+            coarse.vertexWeights[static_cast<size_t>(c)] += fine.vertexWeights[v];
+            for (auto k = fine.offsets[v]; k < fine.offsets[v + 1]; k++)
+            {
+                const auto cu =
+                    coarseMap[static_cast<size_t>(fine.adjacency[static_cast<size_t>(k)])];
+                if (cu == c) continue; // collapsed edge
+                auto& mark = marker[static_cast<size_t>(cu)];
+                if (mark < rowStart)
+                {
+                    mark = static_cast<localIdx>(coarse.adjacency.size());
+                    coarse.adjacency.push_back(cu);
+                    coarse.edgeWeights.push_back(0);
+                }
+                coarse.edgeWeights[static_cast<size_t>(mark)] +=
+                    fine.edgeWeights[static_cast<size_t>(k)];
+            }
+        }
+        coarse.offsets.push_back(static_cast<localIdx>(coarse.adjacency.size()));
+    }
+    return coarse;
+}
+
+/* @brief recursive bisection of the graph by breadth first graph growing
+ *
+ * Starting from a pseudo peripheral vertex, vertices are added in breadth first order until the
+ * weight of the grown region matches the share of the left parts.
+ */
+void graphGrowingBisection(
+    const CellGraph& graph,
+    std::vector<localIdx> vertices,
+    label firstPart,
+    label nParts,
+    std::vector<label>& part,
+    std::vector<label>& inSubset
+)
+{
+    if (nParts == 1 || vertices.empty())
+    {
+        for (const auto v : vertices)
+        {
+            part[static_cast<size_t>(v)] = firstPart;
+        }
+        return;
+    }
+
+    // mark the current subset, inSubset is shared between all levels of the recursion
+    const label subsetId = firstPart;
+    localIdx totalWeight = 0;
+    for (const auto v : vertices)
+    {
+        inSubset[static_cast<size_t>(v)] = subsetId;
+        totalWeight += graph.vertexWeights[static_cast<size_t>(v)];
+    }
+    const label nPartsLeft = nParts / 2;
+    const auto targetWeight = static_cast<localIdx>(
+        (static_cast<int64_t>(totalWeight) * nPartsLeft) / static_cast<int64_t>(nParts)
+    );
+
+    std::vector<char> visited(graph.vertexWeights.size(), 0);
+    auto bfs = [&](localIdx start, auto&& visit)
+    {
+        std::queue<localIdx> queue;
+        queue.push(start);
+        visited[static_cast<size_t>(start)] = 1;
+        while (!queue.empty())
+        {
+            const auto v = queue.front();
+            queue.pop();
+            if (!visit(v)) return;
+            const auto sv = static_cast<size_t>(v);
+            for (auto k = graph.offsets[sv]; k < graph.offsets[sv + 1]; k++)
+            {
+                const auto u = static_cast<size_t>(graph.adjacency[static_cast<size_t>(k)]);
+                if (!visited[u] && inSubset[u] == subsetId)
+                {
+                    visited[u] = 1;
+                    queue.push(static_cast<localIdx>(u));
+                }
+            }
+        }
+    };
+
+    // the last vertex reached by a breadth first search is a pseudo peripheral vertex
+    localIdx start = vertices.front();
+    bfs(
+        start,
+        [&](localIdx v)
+        {
+            start = v;
+            return true;
+        }
+    );
+    for (const auto v : vertices)
+    {
+        visited[static_cast<size_t>(v)] = 0;
+    }
+
+    std::vector<localIdx> left;
+    localIdx leftWeight = 0;
+    auto grow = [&](localIdx v)
+    {
+        if (leftWeight >= targetWeight) return false;
+        left.push_back(v);
+        leftWeight += graph.vertexWeights[static_cast<size_t>(v)];
+        return true;
+    };
+    bfs(start, grow);
+    // continue on further connected components if the first one was too small
+    for (const auto v : vertices)
+    {
+        if (leftWeight >= targetWeight) break;
+        if (!visited[static_cast<size_t>(v)]) bfs(v, grow);
+    }
+
+    // unmark the subset before recursing, since the children reuse the marker
+    std::vector<localIdx> right;
+    right.reserve(vertices.size() - left.size());
+    for (const auto v : left)
+    {
+        inSubset[static_cast<size_t>(v)] = -1;
+    }
+    for (const auto v : vertices)
+    {
+        if (inSubset[static_cast<size_t>(v)] == subsetId)
+        {
+            right.push_back(v);
+            inSubset[static_cast<size_t>(v)] = -1;
+        }
+    }
+    vertices.clear();
+    vertices.shrink_to_fit();
+
+    graphGrowingBisection(graph, std::move(left), firstPart, nPartsLeft, part, inSubset);
+    graphGrowingBisection(
+        graph, std::move(right), firstPart + nPartsLeft, nParts - nPartsLeft, part, inSubset
+    );
+}
+
+/* @brief greedy k-way boundary refinement
+ *
+ * Moves vertices to the neighbouring part with the largest reduction of the edge cut, as long as
+ * the load constraint is satisfied. Vertices of overloaded parts are moved even if the cut grows.
+ */
+void refine(
+    const CellGraph& graph,
+    label nParts,
+    localIdx maxLoad,
+    label nSweeps,
+    std::vector<label>& part
+)
+{
+    const auto n = graph.nVertices();
+    std::vector<localIdx> load(static_cast<size_t>(nParts), 0);
+    for (localIdx v = 0; v < n; v++)
+    {
+        load[static_cast<size_t>(part[static_cast<size_t>(v)])] +=
+            graph.vertexWeights[static_cast<size_t>(v)];
+    }
+
+    // connectivity of the current vertex to the parts, reset after every vertex
+    std::vector<localIdx> conn(static_cast<size_t>(nParts), 0);
+    std::vector<label> touched;
+    for (label sweep = 0; sweep < nSweeps; sweep++)
+    {
+        localIdx nMoves = 0;
+        for (localIdx v = 0; v < n; v++)
+        {
+            const auto sv = static_cast<size_t>(v);
+            const auto own = part[sv];
+            const auto w = graph.vertexWeights[sv];
+            bool isBoundary = false;
+            for (auto k = graph.offsets[sv]; k < graph.offsets[sv + 1]; k++)
+            {
+                const auto p = part[static_cast<size_t>(graph.adjacency[static_cast<size_t>(k)])];
+                if (conn[static_cast<size_t>(p)] == 0) touched.push_back(p);
+                conn[static_cast<size_t>(p)] += graph.edgeWeights[static_cast<size_t>(k)];
+                isBoundary = isBoundary || (p != own);
+            }
+
+            const bool overloaded = load[static_cast<size_t>(own)] > maxLoad;
+            if (isBoundary && load[static_cast<size_t>(own)] > w)
+            {
+                label best = own;
+                localIdx bestGain = overloaded ? std::numeric_limits<localIdx>::lowest() : 0;
+                for (const auto p : touched)
+                {
+                    if (p == own || load[static_cast<size_t>(p)] + w > maxLoad) continue;
+                    const auto gain = conn[static_cast<size_t>(p)] - conn[static_cast<size_t>(own)];
+                    const bool balances = load[static_cast<size_t>(p)] + w
+                                        < load[static_cast<size_t>(own)];
+                    if (gain > bestGain || (gain == bestGain && best != own && balances))
+                    {
+                        best = p;
+                        bestGain = gain;
+                    }
+                    else if (gain == 0 && best == own && balances && !overloaded)
+                    {
+                        // zero gain moves are only accepted if they improve the balance
+                        best = p;
+                    }
+                }
+                if (best != own)
+                {
+                    load[static_cast<size_t>(own)] -= w;
+                    load[static_cast<size_t>(best)] += w;
+                    part[sv] = best;
+                    nMoves++;
+                }
+            }
+
+            for (const auto p : touched)
+            {
+                conn[static_cast<size_t>(p)] = 0;
+            }
+            touched.clear();
+        }
+        if (nMoves == 0) break;
+    }
+}
+
+} // namespace detail
+
+
+PartitionStats computePartitionStats(
+    const UnstructuredMesh& mesh, const std::vector<label>& cellToPart, label nParts
+)
+{
+    NF_ASSERT_EQUAL(static_cast<localIdx>(cellToPart.size()), mesh.nCells());
+    const auto [ownerH, neighbourH] = copyToHosts(mesh.faceOwner(), mesh.faceNeighbour());
+    const auto [owner, neighbour] = views(ownerH, neighbourH);
+
+    PartitionStats stats {
+        nParts,
+        std::vector<localIdx>(static_cast<size_t>(nParts), 0),
+        std::vector<localIdx>(static_cast<size_t>(nParts), 0),
+        0,
+        1.0,
+        1.0
+    };
+    for (const auto p : cellToPart)
+    {
+        NF_ASSERT(p >= 0 && p < nParts, "Part " << p << " out of range [0, " << nParts << ")");
+        stats.loads[static_cast<size_t>(p)]++;
+    }
+    for (localIdx facei = 0; facei < mesh.nInternalFaces(); facei++)
+    {
+        const auto pOwn = cellToPart[static_cast<size_t>(owner[facei])];
+        const auto pNei = cellToPart[static_cast<size_t>(neighbour[facei])];
+        if (pOwn != pNei)
+        {
+            stats.edgeCut++;
+            stats.cuts[static_cast<size_t>(pOwn)]++;
+            stats.cuts[static_cast<size_t>(pNei)]++;
+        }
+    }
+
+    auto maxOverMean = [nParts](const std::vector<localIdx>& values)
+    {
+        const auto sum = std::accumulate(values.begin(), values.end(), int64_t {0});
+        if (sum == 0) return scalar {1.0};
+        const auto maxValue = *std::max_element(values.begin(), values.end());
+        return static_cast<scalar>(maxValue) * static_cast<scalar>(nParts)
+             / static_cast<scalar>(sum);
+    };
+    stats.loadImbalance = maxOverMean(stats.loads);
+    stats.edgeCutImbalance = maxOverMean(stats.cuts);
+    return stats;
+}
+
+std::vector<label> RCBPartitioner::partition(const UnstructuredMesh& mesh, label nParts) const
+{
+    NF_ASSERT(nParts > 0, "Number of parts must be positive");
+    const auto centres = detail::hostCellCentres(mesh);
+    std::vector<label> cellToPart(centres.size(), 0);
+    std::vector<localIdx> cells(centres.size());
+    std::iota(cells.begin(), cells.end(), 0);
+    detail::recursiveBisection(
+        centres, cells.begin(), cells.end(), 0, nParts, cellToPart, detail::longestBoundingBoxAxis
+    );
+    return cellToPart;
+}
+
+std::vector<label> InertialPartitioner::partition(const UnstructuredMesh& mesh, label nParts) const
+{
+    NF_ASSERT(nParts > 0, "Number of parts must be positive");
+    const auto centres = detail::hostCellCentres(mesh);
+    std::vector<label> cellToPart(centres.size(), 0);
+    std::vector<localIdx> cells(centres.size());
+    std::iota(cells.begin(), cells.end(), 0);
+    detail::recursiveBisection(
+        centres, cells.begin(), cells.end(), 0, nParts, cellToPart, detail::principalInertiaAxis
+    );
+    return cellToPart;
+}
+
+MultilevelPartitioner::MultilevelPartitioner(const Dictionary& dict)
+    : Base(dict), imbalanceTolerance_(0.03), nRefinementSweeps_(4)
+{
+    if (dict.contains("imbalanceTolerance"))
+    {
+        imbalanceTolerance_ = dict.get<scalar>("imbalanceTolerance");
+    }
+    if (dict.contains("nRefinementSweeps"))
+    {
+        nRefinementSweeps_ = dict.get<label>("nRefinementSweeps");
+    }
+}
+
+std::vector<label> MultilevelPartitioner::partition(const UnstructuredMesh& mesh, label nParts)
+    const
+{
+    NF_ASSERT(nParts > 0, "Number of parts must be positive");
+    if (nParts == 1) return std::vector<label>(static_cast<size_t>(mesh.nCells()), 0);
+
+    // coarsening phase, stop if the graph is small enough or the matching stalls
+    const localIdx coarsestSize = std::max(localIdx {20} * nParts, localIdx {100});
+    std::vector<detail::CellGraph> graphs;
+    std::vector<std::vector<localIdx>> coarseMaps;
+    graphs.push_back(detail::createCellGraph(mesh));
+    while (graphs.back().nVertices() > coarsestSize)
+    {
+        std::vector<localIdx> coarseMap;
+        auto coarse = detail::coarsen(graphs.back(), coarseMap);
+        if (10 * coarse.nVertices() > 9 * graphs.back().nVertices()) break;
+        graphs.push_back(std::move(coarse));
+        coarseMaps.push_back(std::move(coarseMap));
+    }
+
+    const auto totalWeight = static_cast<int64_t>(mesh.nCells());
+    const auto maxLoad = static_cast<localIdx>(std::ceil(
+        (1.0 + imbalanceTolerance_) * static_cast<scalar>(totalWeight) / static_cast<scalar>(nParts)
+    ));
+
+    // initial partitioning of the coarsest graph
+    const auto& coarsest = graphs.back();
+    std::vector<label> part(static_cast<size_t>(coarsest.nVertices()), 0);
+    std::vector<label> inSubset(part.size(), -1);
+    std::vector<localIdx> vertices(part.size());
+    std::iota(vertices.begin(), vertices.end(), 0);
+    detail::graphGrowingBisection(coarsest, std::move(vertices), 0, nParts, part, inSubset);
+    detail::refine(coarsest, nParts, maxLoad, nRefinementSweeps_, part);
+
+    // uncoarsening phase
+    for (auto level = static_cast<std::ptrdiff_t>(coarseMaps.size()) - 1; level >= 0; level--)
+    {
+        const auto& coarseMap = coarseMaps[static_cast<size_t>(level)];
+        std::vector<label> finePart(coarseMap.size());
+        for (size_t v = 0; v < coarseMap.size(); v++)
+        {
+            finePart[v] = part[static_cast<size_t>(coarseMap[v])];
+        }
+        part = std::move(finePart);
+        detail::refine(
+            graphs[static_cast<size_t>(level)], nParts, maxLoad, nRefinementSweeps_, part
+        );
+    }
+    return part;
+}
+
+
+std::vector<PartMesh> decomposeMesh(
+    const UnstructuredMesh& mesh,
+    const std::vector<label>& cellToPart,
+    label nParts,
+    const Executor& exec
+)
+{
+    NF_ASSERT_EQUAL(static_cast<localIdx>(cellToPart.size()), mesh.nCells());
+    const auto nCells = mesh.nCells();
+    const auto nInternalFaces = mesh.nInternalFaces();
+    const auto& bMesh = mesh.boundaryMesh();
+    const auto& patchOffsets = bMesh.offset();
+    const auto nPatches = static_cast<localIdx>(patchOffsets.size()) - 1;
+
+    const auto [ownerH, neighbourH, cellCentresH, faceCentresH, faceAreasH, magFaceAreasH] =
+        copyToHosts(
+            mesh.faceOwner(),
+            mesh.faceNeighbour(),
+            mesh.cellCentres(),
+            mesh.faceCentres(),
+            mesh.faceAreas(),
+            mesh.magFaceAreas()
+        );
+    const auto [owner, neighbour, cellCentres, faceCentres, faceAreas, magFaceAreas] =
+        views(ownerH, neighbourH, cellCentresH, faceCentresH, faceAreasH, magFaceAreasH);
+    const auto cellVolumesH = mesh.cellVolumes().copyToHost();
+    const auto cellVolumes = cellVolumesH.view();
+    const auto [bFaceCellsH, bCfH, bCnH, bSfH, bMagSfH, bNfH, bDeltaH, bWeightsH, bDeltaCoeffsH] =
+        copyToHosts(
+            bMesh.faceCells(),
+            bMesh.cf(),
+            bMesh.cn(),
+            bMesh.sf(),
+            bMesh.magSf(),
+            bMesh.nf(),
+            bMesh.delta(),
+            bMesh.weights(),
+            bMesh.deltaCoeffs()
+        );
+    const auto [bFaceCells, bCf, bCn, bSf, bMagSf, bNf, bDelta, bWeights, bDeltaCoeffs] =
+        views(bFaceCellsH, bCfH, bCnH, bSfH, bMagSfH, bNfH, bDeltaH, bWeightsH, bDeltaCoeffsH);
+
+    // cells of every part keep their relative order, hence a single numbering suffices
+    std::vector<localIdx> localCell(static_cast<size_t>(nCells));
+    std::vector<std::vector<localIdx>> cellMaps(static_cast<size_t>(nParts));
+    for (localIdx celli = 0; celli < nCells; celli++)
+    {
+        const auto p = cellToPart[static_cast<size_t>(celli)];
+        NF_ASSERT(p >= 0 && p < nParts, "Part " << p << " out of range [0, " << nParts << ")");
+        auto& cellMap = cellMaps[static_cast<size_t>(p)];
+        localCell[static_cast<size_t>(celli)] = static_cast<localIdx>(cellMap.size());
+        cellMap.push_back(celli);
+    }
+
+    // sort internal faces into per part internal faces and processor faces
+    std::vector<std::vector<localIdx>> internalFaces(static_cast<size_t>(nParts));
+    // processor faces per part as (neighbour part, face) pairs
+    std::vector<std::vector<std::pair<label, localIdx>>> procFaces(static_cast<size_t>(nParts));
+    for (localIdx facei = 0; facei < nInternalFaces; facei++)
+    {
+        const auto pOwn = cellToPart[static_cast<size_t>(owner[facei])];
+        const auto pNei = cellToPart[static_cast<size_t>(neighbour[facei])];
+        if (pOwn == pNei)
+        {
+            internalFaces[static_cast<size_t>(pOwn)].push_back(facei);
+        }
+        else
+        {
+            procFaces[static_cast<size_t>(pOwn)].emplace_back(pNei, facei);
+            procFaces[static_cast<size_t>(pNei)].emplace_back(pOwn, facei);
+        }
+    }
+
+    std::vector<PartMesh> parts;
+    parts.reserve(static_cast<size_t>(nParts));
+    const auto hostExec = SerialExecutor {};
+    for (label p = 0; p < nParts; p++)
+    {
+        const auto& cellMap = cellMaps[static_cast<size_t>(p)];
+        const auto& internal = internalFaces[static_cast<size_t>(p)];
+        auto& proc = procFaces[static_cast<size_t>(p)];
+        // group by neighbour part, the faces of a group are ordered by their global index
+        std::sort(proc.begin(), proc.end());
+
+        std::vector<localIdx> physicalFaces; // boundary face indices of the undecomposed mesh
+        std::vector<localIdx> offsets {0};
+        for (localIdx patchi = 0; patchi < nPatches; patchi++)
+        {
+            for (auto bfacei = patchOffsets[static_cast<size_t>(patchi)];
+                 bfacei < patchOffsets[static_cast<size_t>(patchi + 1)];
+                 bfacei++)
+            {
+                if (cellToPart[static_cast<size_t>(bFaceCells[bfacei])] == p)
+                {
+                    physicalFaces.push_back(bfacei);
+                }
+            }
+            offsets.push_back(static_cast<localIdx>(physicalFaces.size()));
+        }
+        // one processor patch per neighbour part
+        std::vector<label> neighbourParts;
+        const auto nPhysical = offsets.back();
+        for (size_t i = 0; i < proc.size(); i++)
+        {
+            if (i == 0 || proc[i].first != proc[i - 1].first)
+            {
+                neighbourParts.push_back(proc[i].first);
+            }
+            if (i + 1 == proc.size() || proc[i].first != proc[i + 1].first)
+            {
+                offsets.push_back(nPhysical + static_cast<localIdx>(i + 1));
+            }
+        }
+
+        const auto nLocalCells = static_cast<localIdx>(cellMap.size());
+        const auto nLocalInternal = static_cast<localIdx>(internal.size());
+        const auto nLocalPhysical = static_cast<localIdx>(physicalFaces.size());
+        const auto nLocalBoundary = nLocalPhysical + static_cast<localIdx>(proc.size());
+        const auto nLocalFaces = nLocalInternal + nLocalBoundary;
+
+        scalarVector lCellVolumes(hostExec, nLocalCells);
+        vectorVector lCellCentres(hostExec, nLocalCells);
+        vectorVector lFaceAreas(hostExec, nLocalFaces);
+        vectorVector lFaceCentres(hostExec, nLocalFaces);
+        scalarVector lMagFaceAreas(hostExec, nLocalFaces);
+        labelVector lFaceOwner(hostExec, nLocalFaces);
+        labelVector lFaceNeighbour(hostExec, nLocalInternal);
+        labelVector lbFaceCells(hostExec, nLocalBoundary);
+        vectorVector lbCf(hostExec, nLocalBoundary);
+        vectorVector lbCn(hostExec, nLocalBoundary);
+        vectorVector lbSf(hostExec, nLocalBoundary);
+        scalarVector lbMagSf(hostExec, nLocalBoundary);
+        vectorVector lbNf(hostExec, nLocalBoundary);
+        vectorVector lbDelta(hostExec, nLocalBoundary);
+        scalarVector lbWeights(hostExec, nLocalBoundary);
+        scalarVector lbDeltaCoeffs(hostExec, nLocalBoundary);
+
+        {
+            auto [vol, cc] = views(lCellVolumes, lCellCentres);
+            for (localIdx celli = 0; celli < nLocalCells; celli++)
+            {
+                vol[celli] = cellVolumes[cellMap[static_cast<size_t>(celli)]];
+                cc[celli] = cellCentres[cellMap[static_cast<size_t>(celli)]];
+            }
+        }
+
+        std::vector<localIdx> faceMap;
+        faceMap.reserve(static_cast<size_t>(nLocalFaces));
+        auto [sf, cf, magSf, own, nei] =
+            views(lFaceAreas, lFaceCentres, lMagFaceAreas, lFaceOwner, lFaceNeighbour);
+        for (localIdx i = 0; i < nLocalInternal; i++)
+        {
+            const auto facei = internal[static_cast<size_t>(i)];
+            faceMap.push_back(facei);
+            sf[i] = faceAreas[facei];
+            cf[i] = faceCentres[facei];
+            magSf[i] = magFaceAreas[facei];
+            own[i] = localCell[static_cast<size_t>(owner[facei])];
+            nei[i] = localCell[static_cast<size_t>(neighbour[facei])];
+        }
+
+        auto [fc, bcf, bcn, bsf, bmagSf, bnf, bdelta, bweights, bdeltaCoeffs] = views(
+            lbFaceCells, lbCf, lbCn, lbSf, lbMagSf, lbNf, lbDelta, lbWeights, lbDeltaCoeffs
+        );
+        for (localIdx i = 0; i < nLocalPhysical; i++)
+        {
+            const auto bfacei = physicalFaces[static_cast<size_t>(i)];
+            const auto facei = nInternalFaces + bfacei;
+            const auto lfacei = nLocalInternal + i;
+            faceMap.push_back(facei);
+            sf[lfacei] = faceAreas[facei];
+            cf[lfacei] = faceCentres[facei];
+            magSf[lfacei] = magFaceAreas[facei];
+            own[lfacei] = localCell[static_cast<size_t>(bFaceCells[bfacei])];
+            fc[i] = own[lfacei];
+            bcf[i] = bCf[bfacei];
+            bcn[i] = bCn[bfacei];
+            bsf[i] = bSf[bfacei];
+            bmagSf[i] = bMagSf[bfacei];
+            bnf[i] = bNf[bfacei];
+            bdelta[i] = bDelta[bfacei];
+            bweights[i] = bWeights[bfacei];
+            bdeltaCoeffs[i] = bDeltaCoeffs[bfacei];
+        }
+
+        CommMap sendMap(static_cast<size_t>(nParts));
+        CommMap receiveMap(static_cast<size_t>(nParts));
+        for (size_t k = 0; k < proc.size(); k++)
+        {
+            const auto [nbrPart, facei] = proc[k];
+            const auto i = nLocalPhysical + static_cast<localIdx>(k);
+            const auto lfacei = nLocalInternal + i;
+            const bool isOwner = cellToPart[static_cast<size_t>(owner[facei])] == p;
+            const auto localGlobalCell = isOwner ? owner[facei] : neighbour[facei];
+            const auto remoteGlobalCell = isOwner ? neighbour[facei] : owner[facei];
+            const auto celli = localCell[static_cast<size_t>(localGlobalCell)];
+            const Vec3 cLocal = cellCentres[localGlobalCell];
+            const Vec3 cRemote = cellCentres[remoteGlobalCell];
+
+            // processor faces point out of the part
+            const Vec3 outwardSf = isOwner ? faceAreas[facei] : -1.0 * faceAreas[facei];
+            faceMap.push_back(facei);
+            sf[lfacei] = outwardSf;
+            cf[lfacei] = faceCentres[facei];
+            magSf[lfacei] = magFaceAreas[facei];
+            own[lfacei] = celli;
+            fc[i] = celli;
+            bcf[i] = faceCentres[facei];
+            bcn[i] = cLocal;
+            bsf[i] = outwardSf;
+            bmagSf[i] = magFaceAreas[facei];
+            bnf[i] = (1.0 / magFaceAreas[facei]) * outwardSf;
+            // same delta, weights and deltaCoeffs as the internal face of the undecomposed mesh
+            bdelta[i] = cRemote - cLocal;
+            const scalar sfdOwn = std::abs(outwardSf & (faceCentres[facei] - cLocal));
+            const scalar sfdNei = std::abs(outwardSf & (cRemote - faceCentres[facei]));
+            bweights[i] = (sfdOwn + sfdNei > ROOTVSMALL) ? sfdNei / (sfdOwn + sfdNei) : 0.5;
+            bdeltaCoeffs[i] = 1.0 / mag(cRemote - cLocal);
+
+            sendMap[static_cast<size_t>(nbrPart)].push_back(NodeCommMap {celli});
+            receiveMap[static_cast<size_t>(nbrPart)].push_back(NodeCommMap {i});
+        }
+
+        BoundaryMesh boundaryMesh(
+            exec,
+            lbFaceCells.copyToExecutor(exec),
+            lbCf.copyToExecutor(exec),
+            lbCn.copyToExecutor(exec),
+            lbSf.copyToExecutor(exec),
+            lbMagSf.copyToExecutor(exec),
+            lbNf.copyToExecutor(exec),
+            lbDelta.copyToExecutor(exec),
+            lbWeights.copyToExecutor(exec),
+            lbDeltaCoeffs.copyToExecutor(exec),
+            offsets
+        );
+
+        UnstructuredMesh partMesh(
+            vectorVector(exec, 0),
+            lCellVolumes.copyToExecutor(exec),
+            lCellCentres.copyToExecutor(exec),
+            lFaceAreas.copyToExecutor(exec),
+            lFaceCentres.copyToExecutor(exec),
+            lMagFaceAreas.copyToExecutor(exec),
+            lFaceOwner.copyToExecutor(exec),
+            lFaceNeighbour.copyToExecutor(exec),
+            nLocalCells,
+            nLocalInternal,
+            nLocalBoundary,
+            static_cast<localIdx>(offsets.size()) - 1,
+            nLocalFaces,
+            boundaryMesh
+        );
+
+        parts.push_back(PartMesh {
+            p,
+            partMesh,
+            cellMap,
+            faceMap,
+            nPatches,
+            neighbourParts,
+            sendMap,
+            receiveMap
+        });
+    }
+    return parts;
+}
+
+std::vector<PartMesh> decomposeMesh(const UnstructuredMesh& mesh, const Dictionary& dict)
+{
+    const auto nParts = dict.get<label>("nParts");
+    const auto partitioner = Partitioner::create(dict);
+    const auto cellToPart = partitioner->partition(mesh, nParts);
+    return decomposeMesh(mesh, cellToPart, nParts, mesh.exec());
+}
+
+} // namespace NeoN
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <vector>
+
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
+
+namespace NeoN
+{
+
+namespace detail
+{
+
+localIdx patchStart(const UnstructuredMesh& mesh, localIdx nPhysicalBoundaries)
+{
+    const auto& offset = mesh.boundaryMesh().offset();
+    NF_ASSERT(
+        nPhysicalBoundaries >= 0 && static_cast<size_t>(nPhysicalBoundaries) < offset.size(),
+        "Number of physical patches " << nPhysicalBoundaries << " exceeds number of patches."
+    );
+    return offset[static_cast<size_t>(nPhysicalBoundaries)];
+}
+
+std::vector<localIdx> localIndices(const RankCommMap& rankMap)
+{
+    std::vector<localIdx> indices;
+    indices.reserve(rankMap.size());
+    for (const auto& node : rankMap)
+    {
+        indices.push_back(node.local_idx);
+    }
+    return indices;
+}
+
+}
+
+#ifdef NF_WITH_MPI_SUPPORT
+
+ProcessorInterface::ProcessorInterface(
+    const UnstructuredMesh& mesh,
+    localIdx nPhysicalBoundaries,
+    const CommMap& sendMap,
+    const CommMap& receiveMap
+)
+    : ProcessorInterface(mpi::MPIEnvironment(), mesh, nPhysicalBoundaries, sendMap, receiveMap)
+{}
+
+ProcessorInterface::ProcessorInterface(
+    mpi::MPIEnvironment mpiEnviron,
+    const UnstructuredMesh& mesh,
+    localIdx nPhysicalBoundaries,
+    const CommMap& sendMap,
+    const CommMap& receiveMap,
+    mpi::BufferSpace space
+)
+    : exec_(mesh.exec()), nBoundaryFaces_(mesh.nBoundaryFaces()),
+      nPhysicalBoundaryFaces_(detail::patchStart(mesh, nPhysicalBoundaries)),
+      mpiEnviron_(mpiEnviron),
+      communicator_(
+          std::make_shared<Communicator>(mpiEnviron, mesh.exec(), sendMap, receiveMap, space)
+      )
+{}
+
+#else
+
+ProcessorInterface::ProcessorInterface(
+    const UnstructuredMesh& mesh,
+    localIdx nPhysicalBoundaries,
+    const CommMap& sendMap,
+    const CommMap& receiveMap
+)
+    : exec_(mesh.exec()), nBoundaryFaces_(mesh.nBoundaryFaces()),
+      nPhysicalBoundaryFaces_(detail::patchStart(mesh, nPhysicalBoundaries)),
+      sendCells_(mesh.exec(), detail::localIndices(sendMap.at(0))),
+      receiveFaces_(mesh.exec(), detail::localIndices(receiveMap.at(0)))
+{
+    NF_ASSERT(
+        sendMap.size() == 1 && receiveMap.size() == 1,
+        "Without MPI support processor patches can only couple a rank with itself."
+    );
+    NF_ASSERT_EQUAL(sendCells_.size(), receiveFaces_.size());
+}
+
+#endif
+
+std::shared_ptr<ProcessorInterface> ProcessorInterface::read(const UnstructuredMesh& mesh)
+{
+    auto& db = mesh.stencilDB();
+    if (!db.contains("ProcessorInterface"))
+    {
+        return nullptr;
+    }
+    return db.get<std::shared_ptr<ProcessorInterface>>("ProcessorInterface");
+}
+
+void ProcessorInterface::attach(
+    const UnstructuredMesh& mesh, std::shared_ptr<ProcessorInterface> procInterface
+)
+{
+    mesh.stencilDB().insert(std::string("ProcessorInterface"), procInterface);
+}
+
+localIdx nPhysicalBoundaryFaces(const UnstructuredMesh& mesh)
+{
+    auto procInterface = ProcessorInterface::read(mesh);
+    return procInterface ? procInterface->nPhysicalBoundaryFaces() : mesh.nBoundaryFaces();
+}
+
+} // namespace NeoN
@@ -221,4 +221,147 @@ UnstructuredMesh create1DUniformMesh(const Executor exec, const localIdx nCells)
         boundaryMesh
     );
 }
+
+UnstructuredMesh
+create3DUniformMesh(const Executor exec, const localIdx nx, const localIdx ny, const localIdx nz)
+{
+    const localIdx n[3] = {nx, ny, nz};
+    const localIdx stride[3] = {1, nx, nx * ny};
+    const Vec3 spacing(1.0 / scalar(nx), 1.0 / scalar(ny), 1.0 / scalar(nz));
+    const scalar magFaceArea[3] = {
+        spacing[1] * spacing[2], spacing[0] * spacing[2], spacing[0] * spacing[1]
+    };
+    const localIdx nCells = nx * ny * nz;
+
+    auto unit = [](int dir)
+    {
+        Vec3 vec(0.0, 0.0, 0.0);
+        vec[dir] = 1.0;
+        return vec;
+    };
+
+    std::vector<Vec3> points;
+    for (localIdx k = 0; k <= nz; k++)
+    {
+        for (localIdx j = 0; j <= ny; j++)
+        {
+            for (localIdx i = 0; i <= nx; i++)
+            {
+                points.emplace_back(
+                    scalar(i) * spacing[0], scalar(j) * spacing[1], scalar(k) * spacing[2]
+                );
+            }
+        }
+    }
+
+    std::vector<Vec3> cellCentres;
+    for (localIdx k = 0; k < nz; k++)
+    {
+        for (localIdx j = 0; j < ny; j++)
+        {
+            for (localIdx i = 0; i < nx; i++)
+            {
+                cellCentres.emplace_back(
+                    (scalar(i) + 0.5) * spacing[0],
+                    (scalar(j) + 0.5) * spacing[1],
+                    (scalar(k) + 0.5) * spacing[2]
+                );
+            }
+        }
+    }
+
+    std::vector<Vec3> faceAreas;
+    std::vector<Vec3> faceCentres;
+    std::vector<scalar> magFaceAreas;
+    std::vector<label> faceOwner;
+    std::vector<label> faceNeighbour;
+
+    // internal faces, the neighbours in x, y and z direction are in ascending order
+    for (localIdx celli = 0; celli < nCells; celli++)
+    {
+        const localIdx ijk[3] = {celli % nx, (celli / nx) % ny, celli / (nx * ny)};
+        for (int dir = 0; dir < 3; dir++)
+        {
+            if (ijk[dir] + 1 == n[dir]) continue;
+            faceAreas.push_back(magFaceArea[dir] * unit(dir));
+            faceCentres.push_back(cellCentres[celli] + 0.5 * spacing[dir] * unit(dir));
+            magFaceAreas.push_back(magFaceArea[dir]);
+            faceOwner.push_back(celli);
+            faceNeighbour.push_back(celli + stride[dir]);
+        }
+    }
+    const auto nInternalFaces = static_cast<localIdx>(faceOwner.size());
+
+    std::vector<label> faceCells;
+    std::vector<Vec3> cf;
+    std::vector<Vec3> cn;
+    std::vector<Vec3> sf;
+    std::vector<scalar> magSf;
+    std::vector<Vec3> nf;
+    std::vector<Vec3> delta;
+    std::vector<scalar> deltaCoeffs;
+    std::vector<localIdx> offset {0};
+
+    // one patch per side of the cube
+    for (int dir = 0; dir < 3; dir++)
+    {
+        for (scalar side : {-1.0, 1.0})
+        {
+            const localIdx boundaryIdx = side < 0.0 ? 0 : n[dir] - 1;
+            for (localIdx celli = 0; celli < nCells; celli++)
+            {
+                const localIdx ijk[3] = {celli % nx, (celli / nx) % ny, celli / (nx * ny)};
+                if (ijk[dir] != boundaryIdx) continue;
+                const Vec3 normal = side * unit(dir);
+                const Vec3 centre = cellCentres[celli] + 0.5 * spacing[dir] * normal;
+                faceAreas.push_back(magFaceArea[dir] * normal);
+                faceCentres.push_back(centre);
+                magFaceAreas.push_back(magFaceArea[dir]);
+                faceOwner.push_back(celli);
+
+                faceCells.push_back(celli);
+                cf.push_back(centre);
+                cn.push_back(cellCentres[celli]);
+                sf.push_back(magFaceArea[dir] * normal);
+                magSf.push_back(magFaceArea[dir]);
+                nf.push_back(normal);
+                delta.push_back(centre - cellCentres[celli]);
+                deltaCoeffs.push_back(2.0 / spacing[dir]);
+            }
+            offset.push_back(static_cast<localIdx>(faceCells.size()));
+        }
+    }
+    const auto nBoundaryFaces = static_cast<localIdx>(faceCells.size());
+
+    BoundaryMesh boundaryMesh(
+        exec,
+        {exec, faceCells},
+        {exec, cf},
+        {exec, cn},
+        {exec, sf},
+        {exec, magSf},
+        {exec, nf},
+        {exec, delta},
+        {exec, nBoundaryFaces, 1.0}, // weights
+        {exec, deltaCoeffs},
+        offset
+    );
+
+    return UnstructuredMesh(
+        {exec, points},
+        {exec, nCells, spacing[0] * spacing[1] * spacing[2]},
+        {exec, cellCentres},
+        {exec, faceAreas},
+        {exec, faceCentres},
+        {exec, magFaceAreas},
+        {exec, faceOwner},
+        {exec, faceNeighbour},
+        nCells,
+        nInternalFaces,
+        nBoundaryFaces,
+        6,
+        nInternalFaces + nBoundaryFaces,
+        boundaryMesh
+    );
+}
 } // namespace NeoN
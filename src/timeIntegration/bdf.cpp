@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/timeIntegration/bdf.hpp"
+
+#if NN_WITH_SUNDIALS
+
+namespace NeoN::timeIntegration
+{
+
+template<typename SolutionVectorType>
+BDF<SolutionVectorType>::BDF(const BDF<SolutionVectorType>& other)
+    : Base(other), context_(other.context_)
+{}
+
+template<typename SolutionVectorType>
+void BDF<SolutionVectorType>::solve(
+    dsl::Expression<ValueType>& exp, SolutionVectorType& solutionVector, scalar t, const scalar dt
+)
+{
+    // the current values move to the old time field, which holds the initial conditions of
+    // Sundials, while the field receives the solution
+    NeoN::finiteVolume::cellCentred::advanceTime(solutionVector);
+
+    // Setup sundials if required, the solution field is passed to Sundials without copies
+    if (pdeExpr_ == nullptr) initCVODESolver(exp, solutionVector, t);
+    sundials::rewrapVector(solution_.get(), solutionVector.internalVector());
+    rhsData_->solution = &solutionVector;
+    void* cvode = reinterpret_cast<void*>(ODEMemory_.get());
+
+    // Integrate to t + dt without stepping past it, CVODE selects the internal step sizes
+    CVodeSetStopTime(cvode, t + dt);
+    CVodeSetMaxStep(cvode, dt);
+    NeoN::scalar timeOut;
+    auto stepReturn = CVode(cvode, t + dt, solution_.get(), &timeOut, CV_NORMAL);
+
+    // Post step checks
+    NF_ASSERT(stepReturn >= 0, "CVode failed with flag " + std::to_string(stepReturn));
+    NF_ASSERT_EQUAL(t + dt, timeOut);
+
+    // Sundials has written the solution to the field
+    solutionVector.correctBoundaryConditions();
+}
+
+template<typename SolutionVectorType>
+std::unique_ptr<TimeIntegratorBase<SolutionVectorType>> BDF<SolutionVectorType>::clone() const
+{
+    return std::make_unique<BDF>(*this);
+}
+
+template<typename SolutionVectorType>
+void BDF<SolutionVectorType>::initCVODESolver(
+    dsl::Expression<ValueType>& exp, SolutionVectorType& field, scalar t
+)
+{
+    pdeExpr_ = std::make_unique<dsl::Expression<ValueType>>(exp);
+    if (!context_)
+    {
+        std::shared_ptr<SUNContext> context(new SUNContext(), sundials::SUN_CONTEXT_DELETER);
+        int flag = SUNContext_Create(SUN_COMM_NULL, context.get());
+        NF_ASSERT(flag == 0, "SUNContext_Create failed");
+        context_.swap(context);
+    }
+
+    // Sundials copies the initial conditions into its own state vector
+    auto& oldField = NeoN::finiteVolume::cellCentred::oldTime(field);
+    sundials::NVectorPtr initialConditions(
+        sundials::wrapVector(oldField.internalVector(), *context_, field.mesh())
+    );
+    solution_.reset(sundials::wrapVector(field.internalVector(), *context_, field.mesh()));
+    rhsData_->expression = pdeExpr_.get();
+    rhsData_->solution = &field;
+    sundials::initImplicitSystems(*rhsData_, this->solutionDict_);
+
+    void* cvode = CVodeCreate(CV_BDF, *context_);
+    ODEMemory_.reset(reinterpret_cast<char*>(cvode));
+    int flag = CVodeInit(
+        cvode, sundials::fullRHSSolve<SolutionVectorType>, t, initialConditions.get()
+    );
+    NF_ASSERT(flag == 0, "CVodeInit failed");
+    CVodeSetUserData(cvode, rhsData_.get());
+
+    const auto& dict = this->schemeDict_;
+    CVodeSStolerances(
+        cvode,
+        dict.contains("relTol") ? dict.template get<scalar>("relTol") : 1.0e-6,
+        dict.contains("absTol") ? dict.template get<scalar>("absTol") : 1.0e-10
+    );
+    if (dict.contains("maxOrder"))
+    {
+        CVodeSetMaxOrd(cvode, dict.template get<label>("maxOrder"));
+    }
+
+    linearSolver_.reset(sundials::createLinearSolver(*rhsData_, *context_));
+    rhsData_->currentGamma = [cvode]()
+    {
+        scalar gamma;
+        CVodeGetCurrentGamma(cvode, &gamma);
+        return gamma;
+    };
+    flag = CVodeSetLinearSolver(cvode, linearSolver_.get(), nullptr);
+    NF_ASSERT(flag == 0, "CVodeSetLinearSolver failed");
+}
+
+template class BDF<finiteVolume::cellCentred::VolumeField<scalar>>;
+}
+
+#endif
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/timeIntegration/implicitRungeKutta.hpp"
+
+#if NN_WITH_SUNDIALS
+
+namespace NeoN::timeIntegration
+{
+
+template<typename SolutionVectorType>
+ImplicitRungeKutta<SolutionVectorType>::ImplicitRungeKutta(
+    const ImplicitRungeKutta<SolutionVectorType>& other
+)
+    : Base(other), context_(other.context_)
+{}
+
+template<typename SolutionVectorType>
+void ImplicitRungeKutta<SolutionVectorType>::solve(
+    dsl::Expression<ValueType>& exp, SolutionVectorType& solutionVector, scalar t, const scalar dt
+)
+{
+    // the current values move to the old time field, which holds the initial conditions of
+    // Sundials, while the field receives the solution
+    NeoN::finiteVolume::cellCentred::advanceTime(solutionVector);
+
+    // Setup sundials if required, the solution field is passed to Sundials without copies
+    if (pdeExpr_ == nullptr) initSUNARKSolver(exp, solutionVector, t);
+    sundials::rewrapVector(solution_.get(), solutionVector.internalVector());
+    rhsData_->solution = &solutionVector;
+    void* ark = reinterpret_cast<void*>(ODEMemory_.get());
+
+    // Perform time integration
+    ARKodeSetFixedStep(ark, dt);
+    NeoN::scalar timeOut;
+    auto stepReturn = ARKodeEvolve(ark, t + dt, solution_.get(), &timeOut, ARK_ONE_STEP);
+
+    // Post step checks
+    NF_ASSERT_EQUAL(stepReturn, 0);
+    NF_ASSERT_EQUAL(t + dt, timeOut);
+
+    // Sundials has written the solution to the field
+    solutionVector.correctBoundaryConditions();
+}
+
+template<typename SolutionVectorType>
+std::unique_ptr<TimeIntegratorBase<SolutionVectorType>>
+ImplicitRungeKutta<SolutionVectorType>::clone() const
+{
+    return std::make_unique<ImplicitRungeKutta>(*this);
+}
+
+template<typename SolutionVectorType>
+void ImplicitRungeKutta<SolutionVectorType>::initSUNARKSolver(
+    dsl::Expression<ValueType>& exp, SolutionVectorType& field, scalar t
+)
+{
+    pdeExpr_ = std::make_unique<dsl::Expression<ValueType>>(exp);
+    if (!context_)
+    {
+        std::shared_ptr<SUNContext> context(new SUNContext(), sundials::SUN_CONTEXT_DELETER);
+        int flag = SUNContext_Create(SUN_COMM_NULL, context.get());
+        NF_ASSERT(flag == 0, "SUNContext_Create failed");
+        context_.swap(context);
+    }
+
+    // Sundials copies the initial conditions into its own state vector
+    auto& oldField = NeoN::finiteVolume::cellCentred::oldTime(field);
+    sundials::NVectorPtr initialConditions(
+        sundials::wrapVector(oldField.internalVector(), *context_, field.mesh())
+    );
+    solution_.reset(sundials::wrapVector(field.internalVector(), *context_, field.mesh()));
+    rhsData_->expression = pdeExpr_.get();
+    rhsData_->solution = &field;
+    sundials::initImplicitSystems(*rhsData_, this->solutionDict_);
+
+    // split the expression on the operator type, without explicit operators DIRK is used
+    bool hasExplicitOperators = false;
+    for (const auto& op : pdeExpr_->spatialOperators())
+    {
+        hasExplicitOperators |= op.getType() == dsl::Operator::Type::Explicit;
+    }
+    auto [implicitTable, explicitTable] = sundials::stringToARKTables(
+        this->schemeDict_.template get<std::string>("Runge-Kutta-Method")
+    );
+    NF_ASSERT(
+        !hasExplicitOperators || explicitTable != ARKODE_ERK_NONE,
+        "The selected implicit Runge-Kutta method does not support explicit operators."
+    );
+
+    void* ark = ARKStepCreate(
+        hasExplicitOperators ? sundials::explicitRKSolve<SolutionVectorType> : nullptr,
+        sundials::implicitRKSolve<SolutionVectorType>,
+        t,
+        initialConditions.get(),
+        *context_
+    );
+    ODEMemory_.reset(reinterpret_cast<char*>(ark));
+    ARKStepSetTableNum(ark, implicitTable, hasExplicitOperators ? explicitTable : ARKODE_ERK_NONE);
+    ARKodeSetUserData(ark, rhsData_.get());
+
+    const auto& dict = this->schemeDict_;
+    ARKodeSStolerances(
+        ark,
+        dict.contains("relTol") ? dict.template get<scalar>("relTol") : 1.0e-6,
+        dict.contains("absTol") ? dict.template get<scalar>("absTol") : 1.0e-10
+    );
+
+    linearSolver_.reset(sundials::createLinearSolver(*rhsData_, *context_));
+    rhsData_->currentGamma = [ark]()
+    {
+        scalar gamma;
+        ARKodeGetCurrentGamma(ark, &gamma);
+        return gamma;
+    };
+    int flag = ARKodeSetLinearSolver(ark, linearSolver_.get(), nullptr);
+    NF_ASSERT(flag == 0, "ARKodeSetLinearSolver failed");
+}
+
+template class ImplicitRungeKutta<finiteVolume::cellCentred::VolumeField<scalar>>;
+}
+
+#endif
@@ -11,23 +11,13 @@ namespace NeoN::timeIntegration
 
 template<typename SolutionVectorType>
 RungeKutta<SolutionVectorType>::RungeKutta(const RungeKutta<SolutionVectorType>& other)
-    : Base(other), solution_(other.solution_), initialConditions_(other.initialConditions_),
-      pdeExpr_(
-          other.pdeExpr_
-              ? std::make_unique<NeoN::dsl::Expression<ValueType>>(other.pdeExpr_->exec())
-              : nullptr
-      )
-{
-    sunrealtype timeCurrent;
-    void* ark = reinterpret_cast<void*>(other.ODEMemory_.get());
-    ARKodeGetCurrentTime(ark, &timeCurrent);
-    initODEMemory(timeCurrent); // will finalise construction of the ode memory.
-}
+    : Base(other), context_(other.context_)
+{}
 
 template<typename SolutionVectorType>
 RungeKutta<SolutionVectorType>::RungeKutta(RungeKutta<SolutionVectorType>&& other)
     : Base(std::move(other)), solution_(std::move(other.solution_)),
-      initialConditions_(std::move(other.initialConditions_)), context_(std::move(other.context_)),
+      rhsData_(std::move(other.rhsData_)), context_(std::move(other.context_)),
       ODEMemory_(std::move(other.ODEMemory_)), pdeExpr_(std::move(other.pdeExpr_))
 {}
 
@@ -36,25 +26,38 @@ void RungeKutta<SolutionVectorType>::solve(
     dsl::Expression<ValueType>& exp, SolutionVectorType& solutionVector, scalar t, const scalar dt
 )
 {
-    // Setup sundials if required, load the current solution for temporal integration
-    SolutionVectorType& oldSolutionVector =
-        NeoN::finiteVolume::cellCentred::oldTime(solutionVector);
-    if (pdeExpr_ == nullptr) initSUNERKSolver(exp, oldSolutionVector, t);
-    NeoN::sundials::fieldToSunNVector(oldSolutionVector.internalVector(), solution_.sunNVector());
+    // the current values move to the old time field, which holds the initial conditions of
+    // Sundials, while the field receives the solution
+    NeoN::finiteVolume::cellCentred::advanceTime(solutionVector);
+
+    // Setup sundials if required, the solution field is passed to Sundials without copies
+    if (pdeExpr_ == nullptr) initSUNERKSolver(exp, solutionVector, t);
+    sundials::rewrapVector(solution_.get(), solutionVector.internalVector());
+    rhsData_->solution = &solutionVector;
     void* ark = reinterpret_cast<void*>(ODEMemory_.get());
 
-    // Perform time integration
-    ARKodeSetFixedStep(ark, dt);
+    // Perform time integration, with tolerances ARKODE selects the internal step sizes and stops
+    // at t + dt, otherwise a single step of size dt is taken
     NeoN::scalar timeOut;
-    auto stepReturn = ARKodeEvolve(ark, t + dt, solution_.sunNVector(), &timeOut, ARK_ONE_STEP);
+    int stepReturn;
+    if (adaptive())
+    {
+        ARKodeSetStopTime(ark, t + dt);
+        ARKodeSetMaxStep(ark, dt);
+        stepReturn = ARKodeEvolve(ark, t + dt, solution_.get(), &timeOut, ARK_NORMAL);
+    }
+    else
+    {
+        ARKodeSetFixedStep(ark, dt);
+        stepReturn = ARKodeEvolve(ark, t + dt, solution_.get(), &timeOut, ARK_ONE_STEP);
+    }
 
     // Post step checks
-    NF_ASSERT_EQUAL(stepReturn, 0);
+    NF_ASSERT(stepReturn >= 0, "ARKodeEvolve failed with flag " + std::to_string(stepReturn));
     NF_ASSERT_EQUAL(t + dt, timeOut);
 
-    // Copy solution out. (Fence is in sundails free)
-    NeoN::sundials::sunNVectorToVector(solution_.sunNVector(), solutionVector.internalVector());
-    oldSolutionVector.internalVector() = solutionVector.internalVector();
+    // Sundials has written the solution to the field
+    solutionVector.correctBoundaryConditions();
 }
 
 template<typename SolutionVectorType>
@@ -73,9 +76,7 @@ void RungeKutta<SolutionVectorType>::initSUNERKSolver(
 {
     initExpression(exp);
     initSUNContext();
-    initSUNVector(field.exec(), static_cast<size_t>(field.internalVector().size()));
-    initSUNInitialConditions(field);
-    initODEMemory(t);
+    initODEMemory(field, t);
 }
 
 template<typename SolutionVectorType>
@@ -102,37 +103,22 @@ void RungeKutta<SolutionVectorType>::initSUNContext()
 }
 
 template<typename SolutionVectorType>
-void RungeKutta<SolutionVectorType>::initSUNVector(const Executor& exec, size_t size)
+void RungeKutta<SolutionVectorType>::initODEMemory(SolutionVectorType& field, const scalar t)
 {
     NF_DEBUG_ASSERT(context_, "SUNContext is a nullptr.");
-    solution_.setExecutor(exec);
-    solution_.initNVector(size, context_);
-    initialConditions_.setExecutor(exec);
-    initialConditions_.initNVector(size, context_);
-}
-
-template<typename SolutionVectorType>
-void RungeKutta<SolutionVectorType>::initSUNInitialConditions(
-    const SolutionVectorType& solutionVector
-)
-{
+    NF_DEBUG_ASSERT(pdeExpr_, "PDE expression is a nullptr.");
 
-    NeoN::sundials::fieldToSunNVector(
-        solutionVector.internalVector(), initialConditions_.sunNVector()
+    // Sundials copies the initial conditions into its own state vector
+    auto& oldField = NeoN::finiteVolume::cellCentred::oldTime(field);
+    sundials::NVectorPtr initialConditions(
+        sundials::wrapVector(oldField.internalVector(), *context_, field.mesh())
     );
-}
-
-template<typename SolutionVectorType>
-void RungeKutta<SolutionVectorType>::initODEMemory(const scalar t)
-{
-    NF_DEBUG_ASSERT(context_, "SUNContext is a nullptr.");
-    NF_DEBUG_ASSERT(pdeExpr_, "PDE expression is a nullptr.");
+    solution_.reset(sundials::wrapVector(field.internalVector(), *context_, field.mesh()));
+    rhsData_->expression = pdeExpr_.get();
+    rhsData_->solution = &field;
 
     void* ark = ERKStepCreate(
-        NeoN::sundials::explicitRKSolve<SolutionVectorType>,
-        t,
-        initialConditions_.sunNVector(),
-        *context_
+        NeoN::sundials::explicitRKSolve<SolutionVectorType>, t, initialConditions.get(), *context_
     );
     ODEMemory_.reset(reinterpret_cast<char*>(ark));
 
@@ -143,8 +129,20 @@ void RungeKutta<SolutionVectorType>::initODEMemory(const scalar t)
             this->schemeDict_.template get<std::string>("Runge-Kutta-Method")
         )
     );
-    ARKodeSetUserData(ark, pdeExpr_.get());
-    ARKodeSStolerances(ODEMemory_.get(), 1.0, 1.0); // If we want ARK we will revisit.
+    ARKodeSetUserData(ark, rhsData_.get());
+
+    const auto& dict = this->schemeDict_;
+    ARKodeSStolerances(
+        ark,
+        dict.contains("relTol") ? dict.template get<scalar>("relTol") : 1.0e-6,
+        dict.contains("absTol") ? dict.template get<scalar>("absTol") : 1.0e-10
+    );
+}
+
+template<typename SolutionVectorType>
+bool RungeKutta<SolutionVectorType>::adaptive() const
+{
+    return this->schemeDict_.contains("relTol") || this->schemeDict_.contains("absTol");
 }
 
 template class RungeKutta<finiteVolume::cellCentred::VolumeField<scalar>>;
@@ -0,0 +1,533 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include "NeoN/timeIntegration/sundialsNVector.hpp"
+
+#if NN_WITH_SUNDIALS
+
+#include <limits>
+#include <variant>
+
+#include "NeoN/core/error.hpp"
+#include "NeoN/core/parallelAlgorithms.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include "NeoN/core/mpi/operators.hpp"
+#endif
+
+namespace NeoN::sundials
+{
+
+namespace detail
+{
+
+NVectorContent* content(N_Vector v) { return static_cast<NVectorContent*>(v->content); }
+
+Vector<scalar>& vec(N_Vector v) { return *content(v)->vector; }
+
+N_Vector_ID getVectorID(N_Vector) { return SUNDIALS_NVEC_CUSTOM; }
+
+enum class Reduction
+{
+    Sum,
+    Max,
+    Min
+};
+
+/* @brief reduces a rank local value over the ranks of a distributed vector */
+template<typename ValueType>
+ValueType reduce(N_Vector v, ValueType value, Reduction op)
+{
+#ifdef NF_WITH_MPI_SUPPORT
+    const auto comm = content(v)->comm;
+    if (comm != MPI_COMM_NULL)
+    {
+        const auto mpiOp = op == Reduction::Sum ? mpi::ReduceOp::Sum
+                         : op == Reduction::Max ? mpi::ReduceOp::Max
+                                                : mpi::ReduceOp::Min;
+        mpi::allReduce(value, mpiOp, comm);
+    }
+#else
+    (void)v;
+    (void)op;
+#endif
+    return value;
+}
+
+N_Vector cloneEmpty(N_Vector w)
+{
+    N_Vector v = N_VNewEmpty(w->sunctx);
+    N_VCopyOps(w, v);
+    v->content = new NVectorContent {nullptr, false};
+#ifdef NF_WITH_MPI_SUPPORT
+    content(v)->comm = content(w)->comm;
+#endif
+    return v;
+}
+
+N_Vector clone(N_Vector w)
+{
+    N_Vector v = cloneEmpty(w);
+    const auto& wVector = vec(w);
+    content(v)->vector = new Vector<scalar>(wVector.exec(), wVector.size());
+    content(v)->owning = true;
+    return v;
+}
+
+void destroy(N_Vector v)
+{
+    if (v == nullptr)
+    {
+        return;
+    }
+    if (v->content != nullptr)
+    {
+        if (content(v)->owning)
+        {
+            delete content(v)->vector;
+        }
+        delete content(v);
+        v->content = nullptr;
+    }
+    N_VFreeEmpty(v);
+}
+
+void space(N_Vector v, sunindextype* lrw, sunindextype* liw)
+{
+    *lrw = static_cast<sunindextype>(vec(v).size());
+    *liw = 2;
+}
+
+/* @brief the data on the host, nullptr if the vector resides on a device */
+sunrealtype* getArrayPointer(N_Vector v)
+{
+    auto& vector = vec(v);
+    return std::holds_alternative<GPUExecutor>(vector.exec()) ? nullptr : vector.data();
+}
+
+sunrealtype* getDeviceArrayPointer(N_Vector v) { return vec(v).data(); }
+
+sunindextype getLocalLength(N_Vector v) { return static_cast<sunindextype>(vec(v).size()); }
+
+sunindextype getLength(N_Vector v) { return reduce(v, getLocalLength(v), Reduction::Sum); }
+
+#if defined(NF_WITH_MPI_SUPPORT) && SUNDIALS_MPI_ENABLED
+SUNComm getCommunicator(N_Vector v) { return content(v)->comm; }
+#endif
+
+void linearSum(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y, N_Vector z)
+{
+    auto [xV, yV, zV] = views(vec(x), vec(y), vec(z));
+    parallelFor(
+        vec(z).exec(),
+        {0, zV.size()},
+        KOKKOS_LAMBDA(const localIdx i) { zV[i] = a * xV[i] + b * yV[i]; },
+        "NVector::linearSum"
+    );
+}
+
+void constant(sunrealtype c, N_Vector z)
+{
+    auto zV = vec(z).view();
+    parallelFor(
+        vec(z).exec(),
+        {0, zV.size()},
+        KOKKOS_LAMBDA(const localIdx i) { zV[i] = c; },
+        "NVector::const"
+    );
+}
+
+void prod(N_Vector x, N_Vector y, N_Vector z)
+{
+    auto [xV, yV, zV] = views(vec(x), vec(y), vec(z));
+    parallelFor(
+        vec(z).exec(),
+        {0, zV.size()},
+        KOKKOS_LAMBDA(const localIdx i) { zV[i] = xV[i] * yV[i]; },
+        "NVector::prod"
+    );
+}
+
+void div(N_Vector x, N_Vector y, N_Vector z)
+{
+    auto [xV, yV, zV] = views(vec(x), vec(y), vec(z));
+    parallelFor(
+        vec(z).exec(),
+        {0, zV.size()},
+        KOKKOS_LAMBDA(const localIdx i) { zV[i] = xV[i] / yV[i]; },
+        "NVector::div"
+    );
+}
+
+void scale(sunrealtype c, N_Vector x, N_Vector z)
+{
+    auto [xV, zV] = views(vec(x), vec(z));
+    parallelFor(
+        vec(z).exec(),
+        {0, zV.size()},
+        KOKKOS_LAMBDA(const localIdx i) { zV[i] = c * xV[i]; },
+        "NVector::scale"
+    );
+}
+
+void abs(N_Vector x, N_Vector z)
+{
+    auto [xV, zV] = views(vec(x), vec(z));
+    parallelFor(
+        vec(z).exec(),
+        {0, zV.size()},
+        KOKKOS_LAMBDA(const localIdx i) { zV[i] = Kokkos::abs(xV[i]); },
+        "NVector::abs"
+    );
+}
+
+void inv(N_Vector x, N_Vector z)
+{
+    auto [xV, zV] = views(vec(x), vec(z));
+    parallelFor(
+        vec(z).exec(),
+        {0, zV.size()},
+        KOKKOS_LAMBDA(const localIdx i) { zV[i] = 1.0 / xV[i]; },
+        "NVector::inv"
+    );
+}
+
+void addConst(N_Vector x, sunrealtype b, N_Vector z)
+{
+    auto [xV, zV] = views(vec(x), vec(z));
+    parallelFor(
+        vec(z).exec(),
+        {0, zV.size()},
+        KOKKOS_LAMBDA(const localIdx i) { zV[i] = xV[i] + b; },
+        "NVector::addConst"
+    );
+}
+
+sunrealtype dotProdLocal(N_Vector x, N_Vector y)
+{
+    auto [xV, yV] = views(vec(x), vec(y));
+    scalar sum = 0.0;
+    parallelReduce(
+        vec(x).exec(),
+        {0, xV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& lsum) { lsum += xV[i] * yV[i]; },
+        sum
+    );
+    return sum;
+}
+
+sunrealtype dotProd(N_Vector x, N_Vector y)
+{
+    return reduce(x, dotProdLocal(x, y), Reduction::Sum);
+}
+
+sunrealtype maxNormLocal(N_Vector x)
+{
+    auto xV = vec(x).view();
+    scalar maxValue = 0.0;
+    Kokkos::Max<scalar> maxReducer(maxValue);
+    parallelReduce(
+        vec(x).exec(),
+        {0, xV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& lmax) {
+            if (Kokkos::abs(xV[i]) > lmax) lmax = Kokkos::abs(xV[i]);
+        },
+        maxReducer
+    );
+    return xV.size() > 0 ? maxReducer.reference() : 0.0;
+}
+
+sunrealtype maxNorm(N_Vector x) { return reduce(x, maxNormLocal(x), Reduction::Max); }
+
+sunrealtype weightedSquareSum(N_Vector x, N_Vector w)
+{
+    auto [xV, wV] = views(vec(x), vec(w));
+    scalar sum = 0.0;
+    parallelReduce(
+        vec(x).exec(),
+        {0, xV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& lsum) {
+            lsum += (xV[i] * wV[i]) * (xV[i] * wV[i]);
+        },
+        sum
+    );
+    return sum;
+}
+
+sunrealtype wrmsNorm(N_Vector x, N_Vector w)
+{
+    const auto sum = reduce(x, weightedSquareSum(x, w), Reduction::Sum);
+    return Kokkos::sqrt(sum / static_cast<scalar>(getLength(x)));
+}
+
+sunrealtype weightedSquareSumMask(N_Vector x, N_Vector w, N_Vector id)
+{
+    auto [xV, wV, idV] = views(vec(x), vec(w), vec(id));
+    scalar sum = 0.0;
+    parallelReduce(
+        vec(x).exec(),
+        {0, xV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& lsum) {
+            if (idV[i] > 0.0) lsum += (xV[i] * wV[i]) * (xV[i] * wV[i]);
+        },
+        sum
+    );
+    return sum;
+}
+
+sunrealtype wrmsNormMask(N_Vector x, N_Vector w, N_Vector id)
+{
+    const auto sum = reduce(x, weightedSquareSumMask(x, w, id), Reduction::Sum);
+    return Kokkos::sqrt(sum / static_cast<scalar>(getLength(x)));
+}
+
+sunrealtype minLocal(N_Vector x)
+{
+    auto xV = vec(x).view();
+    scalar minValue = 0.0;
+    Kokkos::Min<scalar> minReducer(minValue);
+    parallelReduce(
+        vec(x).exec(),
+        {0, xV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& lmin) {
+            if (xV[i] < lmin) lmin = xV[i];
+        },
+        minReducer
+    );
+    return minReducer.reference();
+}
+
+sunrealtype min(N_Vector x) { return reduce(x, minLocal(x), Reduction::Min); }
+
+sunrealtype wl2Norm(N_Vector x, N_Vector w)
+{
+    return Kokkos::sqrt(reduce(x, weightedSquareSum(x, w), Reduction::Sum));
+}
+
+sunrealtype l1NormLocal(N_Vector x)
+{
+    auto xV = vec(x).view();
+    scalar sum = 0.0;
+    parallelReduce(
+        vec(x).exec(),
+        {0, xV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& lsum) { lsum += Kokkos::abs(xV[i]); },
+        sum
+    );
+    return sum;
+}
+
+sunrealtype l1Norm(N_Vector x) { return reduce(x, l1NormLocal(x), Reduction::Sum); }
+
+void compare(sunrealtype c, N_Vector x, N_Vector z)
+{
+    auto [xV, zV] = views(vec(x), vec(z));
+    parallelFor(
+        vec(z).exec(),
+        {0, zV.size()},
+        KOKKOS_LAMBDA(const localIdx i) { zV[i] = Kokkos::abs(xV[i]) >= c ? 1.0 : 0.0; },
+        "NVector::compare"
+    );
+}
+
+/* @brief z = 1 / x for the non-zero x, returns the number of zeros */
+scalar invTestCount(N_Vector x, N_Vector z)
+{
+    auto [xV, zV] = views(vec(x), vec(z));
+    scalar nZeros = 0.0;
+    parallelReduce(
+        vec(z).exec(),
+        {0, zV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& lsum) {
+            if (xV[i] == 0.0)
+            {
+                lsum += 1.0;
+            }
+            else
+            {
+                zV[i] = 1.0 / xV[i];
+            }
+        },
+        nZeros
+    );
+    return nZeros;
+}
+
+sunbooleantype invTestLocal(N_Vector x, N_Vector z)
+{
+    return invTestCount(x, z) > 0.0 ? SUNFALSE : SUNTRUE;
+}
+
+sunbooleantype invTest(N_Vector x, N_Vector z)
+{
+    return reduce(x, invTestCount(x, z), Reduction::Sum) > 0.0 ? SUNFALSE : SUNTRUE;
+}
+
+/* @brief c = 2: x > 0, c = 1: x >= 0, c = -1: x <= 0, c = -2: x < 0, m marks the violations,
+ * returns the number of violations
+ */
+scalar constrMaskCount(N_Vector c, N_Vector x, N_Vector m)
+{
+    auto [cV, xV, mV] = views(vec(c), vec(x), vec(m));
+    scalar nViolations = 0.0;
+    parallelReduce(
+        vec(m).exec(),
+        {0, mV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& lsum) {
+            const scalar ci = cV[i];
+            const scalar xi = xV[i];
+            const bool violated = (Kokkos::abs(ci) > 1.5 && xi * ci <= 0.0)
+                               || (Kokkos::abs(ci) > 0.5 && xi * ci < 0.0);
+            mV[i] = violated ? 1.0 : 0.0;
+            lsum += mV[i];
+        },
+        nViolations
+    );
+    return nViolations;
+}
+
+sunbooleantype constrMaskLocal(N_Vector c, N_Vector x, N_Vector m)
+{
+    return constrMaskCount(c, x, m) > 0.0 ? SUNFALSE : SUNTRUE;
+}
+
+sunbooleantype constrMask(N_Vector c, N_Vector x, N_Vector m)
+{
+    return reduce(x, constrMaskCount(c, x, m), Reduction::Sum) > 0.0 ? SUNFALSE : SUNTRUE;
+}
+
+sunrealtype minQuotientLocal(N_Vector num, N_Vector denom)
+{
+    auto [numV, denomV] = views(vec(num), vec(denom));
+    scalar minValue = 0.0;
+    Kokkos::Min<scalar> minReducer(minValue);
+    parallelReduce(
+        vec(num).exec(),
+        {0, numV.size()},
+        KOKKOS_LAMBDA(const localIdx i, scalar& lmin) {
+            if (denomV[i] != 0.0 && numV[i] / denomV[i] < lmin) lmin = numV[i] / denomV[i];
+        },
+        minReducer
+    );
+    const auto result = minReducer.reference();
+    return result < std::numeric_limits<scalar>::max() ? result : SUN_BIG_REAL;
+}
+
+sunrealtype minQuotient(N_Vector num, N_Vector denom)
+{
+    return reduce(num, minQuotientLocal(num, denom), Reduction::Min);
+}
+
+N_Vector newEmpty(SUNContext context)
+{
+    N_Vector v = N_VNewEmpty(context);
+    NF_ASSERT(v != nullptr, "N_VNewEmpty failed.");
+
+    v->ops->nvgetvectorid = getVectorID;
+    v->ops->nvclone = clone;
+    v->ops->nvcloneempty = cloneEmpty;
+    v->ops->nvdestroy = destroy;
+    v->ops->nvspace = space;
+    v->ops->nvgetarraypointer = getArrayPointer;
+    v->ops->nvgetdevicearraypointer = getDeviceArrayPointer;
+    v->ops->nvgetlength = getLength;
+    v->ops->nvgetlocallength = getLocalLength;
+#if defined(NF_WITH_MPI_SUPPORT) && SUNDIALS_MPI_ENABLED
+    v->ops->nvgetcommunicator = getCommunicator;
+#endif
+
+    v->ops->nvlinearsum = linearSum;
+    v->ops->nvconst = constant;
+    v->ops->nvprod = prod;
+    v->ops->nvdiv = div;
+    v->ops->nvscale = scale;
+    v->ops->nvabs = abs;
+    v->ops->nvinv = inv;
+    v->ops->nvaddconst = addConst;
+    v->ops->nvdotprod = dotProd;
+    v->ops->nvmaxnorm = maxNorm;
+    v->ops->nvwrmsnorm = wrmsNorm;
+    v->ops->nvwrmsnormmask = wrmsNormMask;
+    v->ops->nvmin = min;
+    v->ops->nvwl2norm = wl2Norm;
+    v->ops->nvl1norm = l1Norm;
+    v->ops->nvcompare = compare;
+    v->ops->nvinvtest = invTest;
+    v->ops->nvconstrmask = constrMask;
+    v->ops->nvminquotient = minQuotient;
+
+    // the reductions above are global over the ranks of the communicator, these are rank local
+    v->ops->nvdotprodlocal = dotProdLocal;
+    v->ops->nvmaxnormlocal = maxNormLocal;
+    v->ops->nvminlocal = minLocal;
+    v->ops->nvl1normlocal = l1NormLocal;
+    v->ops->nvinvtestlocal = invTestLocal;
+    v->ops->nvconstrmasklocal = constrMaskLocal;
+    v->ops->nvminquotientlocal = minQuotientLocal;
+    v->ops->nvwsqrsumlocal = weightedSquareSum;
+    v->ops->nvwsqrsummasklocal = weightedSquareSumMask;
+
+    return v;
+}
+
+} // namespace detail
+
+N_Vector wrapVector(Vector<scalar>& vector, SUNContext context)
+{
+    N_Vector v = detail::newEmpty(context);
+    v->content = new NVectorContent {&vector, false};
+    return v;
+}
+
+N_Vector wrapVector(Vector<scalar>& vector, SUNContext context, const UnstructuredMesh& mesh)
+{
+    N_Vector v = wrapVector(vector, context);
+#ifdef NF_WITH_MPI_SUPPORT
+    auto procInterface = ProcessorInterface::read(mesh);
+    if (procInterface)
+    {
+        detail::content(v)->comm = procInterface->mpiEnvironment().comm();
+    }
+#else
+    (void)mesh;
+#endif
+    return v;
+}
+
+N_Vector newVector(const Executor& exec, localIdx size, SUNContext context)
+{
+    N_Vector v = detail::newEmpty(context);
+    v->content = new NVectorContent {new Vector<scalar>(exec, size), true};
+    return v;
+}
+
+void rewrapVector(N_Vector v, Vector<scalar>& vector)
+{
+    auto* content = detail::content(v);
+    NF_ASSERT(!content->owning, "Only N_Vectors created by wrapVector can be rewrapped.");
+    NF_ASSERT(
+        content->vector->size() == vector.size() && content->vector->exec() == vector.exec(),
+        "The rewrapped vector needs to match the size and executor of the N_Vector."
+    );
+    content->vector = &vector;
+}
+
+Vector<scalar>& getVector(N_Vector v)
+{
+    NF_DEBUG_ASSERT(
+        N_VGetVectorID(v) == SUNDIALS_NVEC_CUSTOM && v->content != nullptr,
+        "The N_Vector is not a NeoN N_Vector."
+    );
+    return detail::vec(v);
+}
+
+scalar sumOverRanks(N_Vector v, scalar value)
+{
+    return detail::reduce(v, value, detail::Reduction::Sum);
+}
+
+}
+
+#endif
@@ -5,6 +5,8 @@
 #include "NeoN/timeIntegration/timeIntegration.hpp"
 #include "NeoN/timeIntegration/forwardEuler.hpp"
 #include "NeoN/timeIntegration/backwardEuler.hpp"
+#include "NeoN/timeIntegration/lowStorageRungeKutta.hpp"
+#include "NeoN/timeIntegration/sspRungeKutta.hpp"
 
 namespace fvcc = NeoN::finiteVolume::cellCentred;
 
@@ -17,4 +19,10 @@ template class ForwardEuler<fvcc::VolumeField<Vec3>>;
 template class BackwardEuler<fvcc::VolumeField<scalar>>;
 template class BackwardEuler<fvcc::VolumeField<Vec3>>;
 
+template class LowStorageRungeKutta<fvcc::VolumeField<scalar>>;
+template class LowStorageRungeKutta<fvcc::VolumeField<Vec3>>;
+
+template class SSPRungeKutta<fvcc::VolumeField<scalar>>;
+template class SSPRungeKutta<fvcc::VolumeField<Vec3>>;
+
 } // namespace NeoN::dsl
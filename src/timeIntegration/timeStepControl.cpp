@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "NeoN/timeIntegration/timeStepControl.hpp"
+#include "NeoN/finiteVolume/cellCentred/auxiliary/coNum.hpp"
+#include "NeoN/mesh/unstructured/processorInterface.hpp"
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include "NeoN/core/mpi/operators.hpp"
+#endif
+
+namespace NeoN::timeIntegration
+{
+
+namespace detail
+{
+
+/* @brief Maximum over all ranks if the mesh is decomposed. */
+scalar globalMax(const UnstructuredMesh& mesh, scalar value)
+{
+#ifdef NF_WITH_MPI_SUPPORT
+    auto procInterface = ProcessorInterface::read(mesh);
+    if (procInterface)
+    {
+        mpi::allReduce(value, mpi::ReduceOp::Max, procInterface->mpiEnvironment().comm());
+    }
+#else
+    (void)mesh;
+#endif
+    return value;
+}
+
+}
+
+TimeStepControl::TimeStepControl(const Dictionary& dict)
+    : maxCo_(dict.get<scalar>("maxCo")), maxGrowth_(1.2), maxShrink_(0.1),
+      maxDeltaT_(std::numeric_limits<scalar>::max()), safetyFactor_(0.9)
+{
+    if (dict.contains("maxGrowth"))
+    {
+        maxGrowth_ = dict.get<scalar>("maxGrowth");
+    }
+    if (dict.contains("maxShrink"))
+    {
+        maxShrink_ = dict.get<scalar>("maxShrink");
+    }
+    if (dict.contains("maxDeltaT"))
+    {
+        maxDeltaT_ = dict.get<scalar>("maxDeltaT");
+    }
+    if (dict.contains("safetyFactor"))
+    {
+        safetyFactor_ = dict.get<scalar>("safetyFactor");
+    }
+    NF_ASSERT(maxCo_ > 0.0, "maxCo has to be positive.");
+    NF_ASSERT(
+        maxShrink_ > 0.0 && maxShrink_ <= 1.0 && maxGrowth_ >= 1.0,
+        "The time step limits have to satisfy 0 < maxShrink <= 1 <= maxGrowth."
+    );
+}
+
+scalar TimeStepControl::deltaT(
+    const finiteVolume::cellCentred::SurfaceField<scalar>& faceFlux,
+    scalar dt,
+    std::optional<ErrorEstimate> error
+) const
+{
+    const auto& mesh = faceFlux.mesh();
+    const scalar coNum =
+        detail::globalMax(mesh, finiteVolume::cellCentred::computeMaxCoNum(faceFlux, dt));
+    scalar factor = coNum > 0.0 ? maxCo_ / coNum : maxGrowth_;
+
+    if (error)
+    {
+        const scalar errorNorm = detail::globalMax(mesh, error->norm);
+        if (errorNorm > 0.0)
+        {
+            const scalar exponent = -1.0 / static_cast<scalar>(error->order + 1);
+            factor = std::min(factor, safetyFactor_ * std::pow(errorNorm, exponent));
+        }
+    }
+
+    factor = std::clamp(factor, maxShrink_, maxGrowth_);
+    return std::min(factor * dt, maxDeltaT_);
+}
+
+} // namespace NeoN::timeIntegration
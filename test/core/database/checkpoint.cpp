@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+#include <filesystem>
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+struct CreateVector
+{
+    std::string name;
+    const NeoN::UnstructuredMesh& mesh;
+    std::int64_t timeIndex = 0;
+
+    NeoN::Document operator()(NeoN::Database& db)
+    {
+        std::vector<fvcc::VolumeBoundary<NeoN::scalar>> bcs {};
+        for (auto patchi : std::vector<NeoN::localIdx> {0, 1, 2, 3})
+        {
+            NeoN::Dictionary dict;
+            dict.insert("type", std::string("fixedValue"));
+            dict.insert("fixedValue", 2.0);
+            bcs.push_back(fvcc::VolumeBoundary<NeoN::scalar>(mesh, dict, patchi));
+        }
+        NeoN::Field<NeoN::scalar> domainVector(
+            mesh.exec(),
+            NeoN::Vector<NeoN::scalar>(mesh.exec(), mesh.nCells(), 1.0),
+            mesh.boundaryMesh().offset()
+        );
+        fvcc::VolumeField<NeoN::scalar> vf(mesh.exec(), name, mesh, domainVector, bcs, db, "", "");
+        return NeoN::Document(
+            {{"name", vf.name},
+             {"timeIndex", timeIndex},
+             {"iterationIndex", std::int64_t(0)},
+             {"subCycleIndex", std::int64_t(0)},
+             {"field", vf}},
+            fvcc::validateVectorDoc
+        );
+    }
+};
+
+TEST_CASE("Checkpoint")
+{
+    NeoN::Executor exec = GENERATE(
+        NeoN::Executor(NeoN::SerialExecutor {}),
+        NeoN::Executor(NeoN::CPUExecutor {}),
+        NeoN::Executor(NeoN::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+    NeoN::UnstructuredMesh mesh = NeoN::createSingleCellMesh(exec);
+    auto file = std::filesystem::temp_directory_path() / ("checkpoint_" + execName + ".bin");
+
+    auto value = [](const auto& vec)
+    {
+        auto host = vec.copyToHost();
+        return host.view()[0];
+    };
+
+    NeoN::Database db;
+    auto& fieldCollection = fvcc::VectorCollection::instance(db, "fields");
+    auto& t = fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+        CreateVector {.name = "T", .mesh = mesh, .timeIndex = 5}
+    );
+    auto& tOld = fvcc::oldTime(t);
+    auto& tOld2 = fvcc::oldTime(tOld);
+    NeoN::fill(t.internalVector(), 1.0);
+    NeoN::fill(t.boundaryData().value(), 4.0);
+    NeoN::fill(tOld.internalVector(), 2.0);
+    NeoN::fill(tOld2.internalVector(), 3.0);
+    fieldCollection.fieldDoc(t.key).iterationIndex() = 7;
+
+    fvcc::Checkpoint checkpoint;
+    checkpoint.write(db, file);
+    // the copies of the snapshot are ordered before later kernels modifying the fields
+    NeoN::fill(t.internalVector(), 0.0);
+    REQUIRE(checkpoint.pending());
+    checkpoint.wait();
+    REQUIRE(!checkpoint.pending());
+    REQUIRE(std::filesystem::exists(file));
+
+    SECTION("restores the fields of the same database on " + execName)
+    {
+        NeoN::fill(t.boundaryData().value(), 0.0);
+        NeoN::fill(tOld.internalVector(), 0.0);
+        fieldCollection.fieldDoc(t.key).timeIndex() = 0;
+        // views obtained before the restart stay valid
+        const auto tView = t.internalVector().view();
+
+        fvcc::Checkpoint::read(db, file);
+
+        REQUIRE(t.internalVector().data() == tView.data());
+        REQUIRE(value(NeoN::Vector<NeoN::scalar>(exec, tView.data(), tView.size(), exec)) == 1.0);
+        REQUIRE(value(t.internalVector()) == 1.0);
+        REQUIRE(value(t.boundaryData().value()) == 4.0);
+        REQUIRE(value(tOld.internalVector()) == 2.0);
+        REQUIRE(value(tOld2.internalVector()) == 3.0);
+        REQUIRE(fieldCollection.fieldDoc(t.key).timeIndex() == 5);
+        REQUIRE(fieldCollection.fieldDoc(t.key).iterationIndex() == 7);
+    }
+
+    SECTION("registers missing old time levels on " + execName)
+    {
+        NeoN::Database restartDb;
+        auto& restartCollection = fvcc::VectorCollection::instance(restartDb, "fields");
+        auto& restartT = restartCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "T", .mesh = mesh}
+        );
+
+        fvcc::Checkpoint::read(restartDb, file);
+
+        REQUIRE(fvcc::hasOldTime(restartT));
+        auto& restartTOld = fvcc::oldTime(restartT);
+        REQUIRE(restartTOld.name == "T_0");
+        REQUIRE(value(restartT.internalVector()) == 1.0);
+        REQUIRE(value(restartTOld.internalVector()) == 2.0);
+        REQUIRE(value(fvcc::oldTime(restartTOld).internalVector()) == 3.0);
+        REQUIRE(restartCollection.fieldDoc(restartTOld.key).timeIndex() == 4);
+    }
+
+    SECTION("reuses the staging buffer for later writes on " + execName)
+    {
+        NeoN::fill(t.internalVector(), 5.0);
+        NeoN::fill(tOld.internalVector(), 6.0);
+        checkpoint.write(db, file);
+        NeoN::fill(t.internalVector(), 0.0);
+        checkpoint.wait();
+
+        fvcc::Checkpoint::read(db, file);
+
+        REQUIRE(value(t.internalVector()) == 5.0);
+        REQUIRE(value(t.boundaryData().value()) == 4.0);
+        REQUIRE(value(tOld.internalVector()) == 6.0);
+        REQUIRE(value(tOld2.internalVector()) == 3.0);
+    }
+
+    SECTION("throws if a field is not registered on " + execName)
+    {
+        NeoN::Database emptyDb;
+        REQUIRE_THROWS(fvcc::Checkpoint::read(emptyDb, file));
+        fvcc::VectorCollection::instance(emptyDb, "fields");
+        REQUIRE_THROWS(fvcc::Checkpoint::read(emptyDb, file));
+    }
+
+    std::filesystem::remove(file);
+}
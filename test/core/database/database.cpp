@@ -29,6 +29,7 @@ TEST_CASE("Database")
         REQUIRE(db.contains("collection2"));
         REQUIRE_FALSE(db.contains("collection3"));
         REQUIRE(db.size() == 2);
+        REQUIRE(db.keys() == std::vector<std::string> {"collection1", "collection2"});
     }
 
     SECTION("get collections")
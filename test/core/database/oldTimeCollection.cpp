@@ -191,5 +191,69 @@ TEST_CASE("oldTimeCollection")
             // check if the same field is returned
             REQUIRE(&tOld2 == &sametOld2);
         }
+
+        SECTION("cached lookup")
+        {
+            REQUIRE(!fvcc::hasOldTime(t));
+            auto& tOld = fvcc::oldTime(t);
+            REQUIRE(fvcc::hasOldTime(t));
+            REQUIRE(!fvcc::hasOldTime(tOld));
+
+            const auto& tConst = t;
+            REQUIRE(&fvcc::oldTime(tConst) == &tOld);
+
+            // a copy refers to the same old time field, but looks it up again
+            auto tCopy = t;
+            REQUIRE(tCopy.cachedOldTime() == nullptr);
+            REQUIRE(&fvcc::oldTime(tCopy) == &tOld);
+        }
+
+        SECTION("advanceTime")
+        {
+            auto& tOld = fvcc::oldTime(t);
+            auto& tOld2 = fvcc::oldTime(tOld);
+            NeoN::fill(tOld2.internalVector(), 3.0);
+            NeoN::fill(tOld.internalVector(), 2.0);
+            NeoN::fill(t.internalVector(), 1.0);
+            const auto* currentData = t.internalVector().data();
+            const auto* oldData = tOld.internalVector().data();
+            const auto* oldestData = tOld2.internalVector().data();
+            auto value = [](const auto& vf)
+            {
+                auto host = vf.internalVector().copyToHost();
+                return host.view()[0];
+            };
+
+            const auto& levels = fvcc::oldTimeLevels(t);
+            REQUIRE(levels.size() == 2);
+            REQUIRE(levels[0] == &tOld);
+            REQUIRE(levels[1] == &tOld2);
+
+            fvcc::advanceTime(t);
+
+            // the storage is rotated without copies, the field holds the oldest values
+            REQUIRE(value(tOld) == 1.0);
+            REQUIRE(value(tOld2) == 2.0);
+            REQUIRE(value(t) == 3.0);
+            REQUIRE(tOld.internalVector().data() == currentData);
+            REQUIRE(tOld2.internalVector().data() == oldData);
+            REQUIRE(t.internalVector().data() == oldestData);
+
+            NeoN::fill(t.internalVector(), 0.0);
+            fvcc::advanceTime(t);
+
+            REQUIRE(value(tOld) == 0.0);
+            REQUIRE(value(tOld2) == 1.0);
+
+            // a further old time level invalidates the cached levels
+            auto& tOld3 = fvcc::oldTime(tOld2);
+            NeoN::fill(t.internalVector(), -1.0);
+            fvcc::advanceTime(t);
+
+            REQUIRE(fvcc::oldTimeLevels(t).size() == 3);
+            REQUIRE(value(tOld) == -1.0);
+            REQUIRE(value(tOld2) == 0.0);
+            REQUIRE(value(tOld3) == 1.0);
+        }
     }
 }
@@ -39,6 +39,15 @@ TEST_CASE("halfDuplexBuffer")
         REQUIRE(!buffer.isCommInit());
     }
 
+    SECTION("Tags of Communication Names")
+    {
+        const int tag = commTag("Tag A");
+        REQUIRE(tag >= 10);
+        REQUIRE(commTag("Tag A") == tag);
+        REQUIRE(commTag("Tag B") != tag);
+        REQUIRE(commTag("Tag B") == commTag("Tag B"));
+    }
+
     SECTION("Set Comm Rank Size")
     {
         for (size_t rank = 0; rank < mpiEnviron.sizeRank(); ++rank)
@@ -82,4 +91,42 @@ TEST_CASE("halfDuplexBuffer")
         send.finaliseComm();
         receive.finaliseComm();
     }
+
+    SECTION("Repeated Send and Receive with Neighbours")
+    {
+        // communicate with all other ranks only
+        for (size_t rank = 0; rank < mpiEnviron.sizeRank(); ++rank)
+            rankCommSize[rank] = rank == mpiEnviron.rank() ? 0 : 2;
+        HalfDuplexCommBuffer send(mpiEnviron, rankCommSize);
+        HalfDuplexCommBuffer receive(mpiEnviron, rankCommSize);
+        REQUIRE(send.neighbours().size() == mpiEnviron.sizeRank() - 1);
+
+        for (int step = 0; step < 3; ++step)
+        {
+            send.initComm<int>("Repeated Send and Receive");
+            receive.initComm<int>("Repeated Send and Receive");
+            for (auto rank : send.neighbours())
+            {
+                auto data = send.get<int>(static_cast<size_t>(rank));
+                data[0] = rank;
+                data[1] = step;
+            }
+
+            send.send();
+            receive.receive();
+
+            send.waitComplete();
+            receive.waitComplete();
+
+            for (auto rank : receive.neighbours())
+            {
+                auto data = receive.get<int>(static_cast<size_t>(rank));
+                REQUIRE(data[0] == static_cast<int>(mpiEnviron.rank()));
+                REQUIRE(data[1] == step);
+            }
+
+            send.finaliseComm();
+            receive.finaliseComm();
+        }
+    }
 }
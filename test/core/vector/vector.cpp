@@ -171,6 +171,19 @@ TEST_CASE("Vector Container Operations")
         REQUIRE(b.range().second == size);
     };
 
+    SECTION("swap" + execName)
+    {
+        NeoN::Vector<NeoN::scalar> a(exec, 2, 1.0);
+        NeoN::Vector<NeoN::scalar> b(exec, 3, 2.0);
+        const auto* dataA = a.data();
+        a.swap(b);
+        REQUIRE(a.size() == 3);
+        REQUIRE(b.size() == 2);
+        REQUIRE(b.data() == dataA);
+        auto hostA = a.copyToHost();
+        REQUIRE(hostA.view()[0] == 2.0);
+    };
+
     SECTION("view" + execName)
     {
         NeoN::Vector<NeoN::label> a(exec, {1, 2, 3});
@@ -102,3 +102,53 @@ TEST_CASE("Coeff")
         }
     }
 }
+
+template<typename CoeffType>
+void evaluate(Vector& vec, const CoeffType coeff)
+{
+    NeoN::parallelFor(vec, KOKKOS_LAMBDA(const NeoN::localIdx i) { return coeff[i]; });
+}
+
+TEST_CASE("Coeff visit")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::localIdx size = 3;
+    Vector fieldB(exec, size, 2.0);
+
+    auto check = [&](const Coeff& coeff, NeoN::scalar expected)
+    {
+        Vector fieldA(exec, size, 0.0);
+        coeff.visit([&](const auto variant) { evaluate(fieldA, variant); });
+        auto hostVectorA = fieldA.copyToHost();
+        for (NeoN::localIdx i = 0; i < size; i++)
+        {
+            REQUIRE(hostVectorA.view()[i] == expected);
+        }
+    };
+
+    SECTION("selects the compile time variant on " + execName)
+    {
+        auto isVariant = [](const Coeff& coeff, auto expected)
+        {
+            bool matches = false;
+            coeff.visit(
+                [&](const auto variant)
+                { matches = std::is_same_v<decltype(variant), const decltype(expected)>; }
+            );
+            return matches;
+        };
+        REQUIRE(isVariant(Coeff(1.0), dsl::detail::UnitCoeff {}));
+        REQUIRE(isVariant(Coeff(2.0), dsl::detail::UniformCoeff {}));
+        REQUIRE(isVariant(Coeff(fieldB), dsl::detail::FieldCoeff {}));
+        REQUIRE(isVariant(Coeff(-5.0, fieldB), dsl::detail::ScaledFieldCoeff {}));
+    }
+
+    SECTION("variants evaluate like operator[] on " + execName)
+    {
+        check(Coeff(1.0), 1.0);
+        check(Coeff(2.0), 2.0);
+        check(Coeff(fieldB), 2.0);
+        check(Coeff(-5.0, fieldB), -10.0);
+    }
+}
@@ -184,6 +184,37 @@ public:
     std::string getName() const { return "TemporalDummy"; }
 };
 
+/* @brief An explicit operator adding coeff * y^2 to the source, the nonlinear test problem of the
+ * time integrators. With a coefficient of -1 it solves ddt(y) = y^2 and with 1 ddt(y) = -y^2.
+ */
+class YSquared : public OperatorMixin
+{
+
+public:
+
+    using VectorValueType = NeoN::scalar;
+
+    YSquared(VolumeField& field, Coeff coeff = Coeff(1.0))
+        : OperatorMixin(field.exec(), coeff, field, Operator::Type::Explicit)
+    {}
+
+    void explicitOperation(Vector& source) const
+    {
+        auto sourceView = source.view();
+        auto fieldView = field_.internalVector().view();
+        auto coeff = getCoefficient();
+        NeoN::parallelFor(
+            source.exec(),
+            source.range(),
+            KOKKOS_LAMBDA(const localIdx i) {
+                sourceView[i] += coeff[i] * fieldView[i] * fieldView[i];
+            }
+        );
+    }
+
+    std::string getName() const { return "YSquared"; }
+};
+
 template<typename ValueType>
 ValueType getVector(const NeoN::Vector<ValueType>& source)
 {
@@ -11,6 +11,35 @@
 
 namespace dsl = NeoN::dsl;
 
+/* An implicit dummy operator depending on the field version, which counts its assemblies */
+template<typename ValueType>
+class CachedDummy : public Dummy<ValueType>
+{
+
+public:
+
+    CachedDummy(fvcc::VolumeField<ValueType>& field, std::shared_ptr<int> nAssemblies)
+        : Dummy<ValueType>(field, Operator::Type::Implicit), nAssemblies_(nAssemblies)
+    {}
+
+    void implicitOperation(la::LinearSystem<ValueType, NeoN::localIdx>& ls) const
+    {
+        (*nAssemblies_)++;
+        Dummy<ValueType>::implicitOperation(ls);
+    }
+
+    std::optional<dsl::DependencySignature> dependencySignature() const
+    {
+        dsl::DependencySignature signature;
+        signature.add(this->getCoefficient());
+        signature.add(&this->field_, this->field_.version());
+        return signature;
+    }
+
+private:
+
+    std::shared_ptr<int> nAssemblies_;
+};
 
 TEMPLATE_TEST_CASE("Expression", "[template]", NeoN::scalar, NeoN::Vec3)
 {
@@ -117,4 +146,182 @@ TEMPLATE_TEST_CASE("Expression", "[template]", NeoN::scalar, NeoN::Vec3)
         REQUIRE(getDiag(ls) == 0 * NeoN::one<TestType>());
         REQUIRE(getRhs(ls) == 0 * NeoN::one<TestType>());
     }
+    SECTION("Reuse cached implicit contributions on " + execName)
+    {
+        auto nAssemblies = std::make_shared<int>(0);
+        dsl::SpatialOperator<TestType> a = CachedDummy<TestType>(vf, nAssemblies);
+        dsl::SpatialOperator<TestType> b = Dummy<TestType>(vf, Operator::Type::Implicit);
+        auto eqn = a + b;
+        eqn.cacheAssembly();
+
+        // the first assembly records the signature and the second one builds the baseline
+        for (int i = 0; i < 3; i++)
+        {
+            ls.reset();
+            eqn.assemble(0.0, 1.0, sp, ls);
+            REQUIRE(getDiag(ls) == 4 * NeoN::one<TestType>());
+            REQUIRE(getRhs(ls) == 4 * NeoN::one<TestType>());
+        }
+        REQUIRE(*nAssemblies == 2);
+
+        // a modified field invalidates the cached contribution
+        NeoN::fill(vf.internalVector(), 3.0 * NeoN::one<TestType>());
+        ls.reset();
+        eqn.assemble(0.0, 1.0, sp, ls);
+        REQUIRE(getDiag(ls) == 6 * NeoN::one<TestType>());
+        REQUIRE(*nAssemblies == 3);
+
+        // a changed operator scaling invalidates the cached contribution
+        eqn.spatialOperators()[0].getCoefficient() *= 2.0;
+        ls.reset();
+        eqn.assemble(0.0, 1.0, sp, ls);
+        REQUIRE(getDiag(ls) == 9 * NeoN::one<TestType>());
+        REQUIRE(*nAssemblies == 4);
+    }
+}
+
+TEMPLATE_TEST_CASE(
+    "Expression with cached Gauss-Green operators", "[template]", NeoN::scalar, NeoN::Vec3
+)
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const localIdx nCells = 10;
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+    auto sp = NeoN::la::SparsityPattern {mesh};
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh);
+
+    fvcc::SurfaceField<NeoN::scalar> faceFlux(exec, "faceFlux", mesh, surfaceBCs);
+    NeoN::fill(faceFlux.internalVector(), 1.0);
+    fvcc::SurfaceField<NeoN::scalar> gamma(exec, "gamma", mesh, surfaceBCs);
+    NeoN::fill(gamma.internalVector(), 2.0);
+
+    std::vector<fvcc::VolumeBoundary<TestType>> bcs;
+    bcs.push_back(fvcc::VolumeBoundary<TestType>(
+        mesh,
+        NeoN::Dictionary(
+            {{"type", std::string("fixedValue")}, {"fixedValue", NeoN::one<TestType>()}}
+        ),
+        0
+    ));
+    bcs.push_back(fvcc::VolumeBoundary<TestType>(
+        mesh,
+        NeoN::Dictionary(
+            {{"type", std::string("fixedGradient")}, {"fixedGradient", NeoN::one<TestType>()}}
+        ),
+        1
+    ));
+    fvcc::VolumeField<TestType> phi(exec, "phi", mesh, bcs);
+    NeoN::fill(phi.internalVector(), NeoN::one<TestType>());
+    phi.correctBoundaryConditions();
+
+    SECTION("Gauss-Green signatures track the boundary version on " + execName)
+    {
+        dsl::SpatialOperator<TestType> lapOp = dsl::imp::laplacian(gamma, phi);
+        lapOp.read(NeoN::TokenList(
+            {std::string("Gauss"), std::string("linear"), std::string("uncorrected")}
+        ));
+        const auto signature = lapOp.dependencySignature();
+        REQUIRE(signature.has_value());
+
+        // the cell values and the corrections with fixed coefficients keep the signature
+        NeoN::fill(phi.internalVector(), 2.0 * NeoN::one<TestType>());
+        phi.correctBoundaryConditions();
+        REQUIRE(lapOp.dependencySignature() == signature);
+
+        // a non-const access of the boundary data may change the coefficients
+        NeoN::fill(phi.boundaryData().refValue(), 3.0 * NeoN::one<TestType>());
+        const auto modifiedSignature = lapOp.dependencySignature();
+        REQUIRE(modifiedSignature != signature);
+
+        // the next correction rewrites the coefficients and is tracked once
+        phi.correctBoundaryConditions();
+        const auto correctedSignature = lapOp.dependencySignature();
+        REQUIRE(correctedSignature != modifiedSignature);
+        phi.correctBoundaryConditions();
+        REQUIRE(lapOp.dependencySignature() == correctedSignature);
+
+        // a new diffusivity changes the signature
+        NeoN::fill(gamma.internalVector(), 3.0);
+        REQUIRE(lapOp.dependencySignature() != correctedSignature);
+    }
+
+    SECTION("Cached and uncached assembly agree on " + execName)
+    {
+        dsl::SpatialOperator<TestType> divOp = dsl::imp::div(faceFlux, phi);
+        divOp.read(NeoN::TokenList({std::string("Gauss"), std::string("upwind")}));
+        dsl::SpatialOperator<TestType> lapOp = dsl::imp::laplacian(gamma, phi);
+        lapOp.read(NeoN::TokenList(
+            {std::string("Gauss"), std::string("linear"), std::string("uncorrected")}
+        ));
+        auto eqn = divOp - Coeff(0.5) * lapOp;
+        auto cachedEqn = eqn;
+        cachedEqn.cacheAssembly();
+
+        auto ls = NeoN::la::createEmptyLinearSystem<TestType, localIdx>(mesh, sp);
+        auto cachedLs = NeoN::la::createEmptyLinearSystem<TestType, localIdx>(mesh, sp);
+        using BoundaryCoefficients = NeoN::la::BoundaryCoefficients<TestType, localIdx>;
+        const std::string bcName = "boundaryCoefficients";
+
+        for (int step = 0; step < 5; step++)
+        {
+            // the laplacian stays cached while the div operator is reassembled
+            if (step == 3)
+            {
+                NeoN::fill(faceFlux.internalVector(), 2.0);
+            }
+            // the solution changes every step, while the boundary coefficients only change once
+            NeoN::fill(phi.internalVector(), NeoN::scalar(step + 1) * NeoN::one<TestType>());
+            if (step == 4)
+            {
+                NeoN::fill(phi.boundaryData().refGrad(), NeoN::zero<TestType>());
+            }
+            phi.correctBoundaryConditions();
+            ls.reset();
+            eqn.assemble(0.0, 1.0, sp, ls);
+            cachedLs.reset();
+            cachedEqn.assemble(0.0, 1.0, sp, cachedLs);
+
+            const auto& bcCoeffs =
+                ls.auxiliaryCoefficients().template get<BoundaryCoefficients>(bcName);
+            const auto& cachedBcCoeffs =
+                cachedLs.auxiliaryCoefficients().template get<BoundaryCoefficients>(bcName);
+            auto [valuesHost, cachedValuesHost, rhsHost, cachedRhsHost] = NeoN::copyToHosts(
+                ls.matrix().values(), cachedLs.matrix().values(), ls.rhs(), cachedLs.rhs()
+            );
+            auto [boundHost, cachedBoundHost, boundRhsHost, cachedBoundRhsHost] =
+                NeoN::copyToHosts(
+                    bcCoeffs.matrixValues,
+                    cachedBcCoeffs.matrixValues,
+                    bcCoeffs.rhsValues,
+                    cachedBcCoeffs.rhsValues
+                );
+            auto [values, cachedValues, rhs, cachedRhs] =
+                NeoN::views(valuesHost, cachedValuesHost, rhsHost, cachedRhsHost);
+            auto [bound, cachedBound, boundRhs, cachedBoundRhs] =
+                NeoN::views(boundHost, cachedBoundHost, boundRhsHost, cachedBoundRhsHost);
+
+            for (size_t i = 0; i < values.size(); i++)
+            {
+                REQUIRE(
+                    NeoN::mag(cachedValues[i] - values[i]) == Catch::Approx(0.0).margin(1e-12)
+                );
+            }
+            for (size_t i = 0; i < rhs.size(); i++)
+            {
+                REQUIRE(NeoN::mag(cachedRhs[i] - rhs[i]) == Catch::Approx(0.0).margin(1e-12));
+            }
+            REQUIRE(NeoN::mag(bound[0]) > 0.0);
+            for (size_t i = 0; i < bound.size(); i++)
+            {
+                REQUIRE(
+                    NeoN::mag(cachedBound[i] - bound[i]) == Catch::Approx(0.0).margin(1e-12)
+                );
+                REQUIRE(
+                    NeoN::mag(cachedBoundRhs[i] - boundRhs[i])
+                    == Catch::Approx(0.0).margin(1e-12)
+                );
+            }
+        }
+    }
 }
@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "catch2_common.hpp"
+
+#include "common.hpp"
+
+namespace dsl = NeoN::dsl;
+
+TEMPLATE_TEST_CASE("StaticExpression", "[template]", NeoN::scalar, NeoN::Vec3)
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    auto sp = NeoN::la::SparsityPattern {mesh};
+
+    const size_t size {1};
+    NeoN::BoundaryData<TestType> bf(exec, mesh.boundaryMesh().offset());
+
+    std::vector<fvcc::VolumeBoundary<TestType>> bcs {};
+    NeoN::Vector<TestType> fA(exec, 1, 2.0 * NeoN::one<TestType>());
+    auto vf = fvcc::VolumeField(exec, "vf", mesh, fA, bf, bcs);
+
+    SECTION("Create static expression and perform explicit operation on " + execName)
+    {
+        auto eqnA = dsl::staticExpression(Dummy<TestType>(vf)) + Dummy<TestType>(vf);
+        auto eqnB = 3 * (eqnA - Dummy<TestType>(vf));
+        auto eqnC = eqnA - eqnB;
+
+        STATIC_REQUIRE(eqnA.size() == 2);
+        STATIC_REQUIRE(eqnB.size() == 3);
+        STATIC_REQUIRE(eqnC.size() == 5);
+
+        // 2 + 2 = 4
+        REQUIRE(getVector(eqnA.explicitOperation(size)) == 4 * NeoN::one<TestType>());
+        // 3 * (2 + 2 - 2) = 6
+        REQUIRE(getVector(eqnB.explicitOperation(size)) == 6 * NeoN::one<TestType>());
+        // 4 - 6 = -2
+        REQUIRE(getVector(eqnC.explicitOperation(size)) == -2 * NeoN::one<TestType>());
+    }
+
+    SECTION("Static and runtime expressions agree on " + execName)
+    {
+        auto eqn = 2
+                 * (dsl::staticExpression(Dummy<TestType>(vf, Operator::Type::Implicit))
+                    + Dummy<TestType>(vf, Operator::Type::Explicit)
+                    - Dummy<TestType>(vf, Operator::Type::Implicit));
+
+        dsl::Expression<TestType> runtimeEqn = eqn;
+        REQUIRE(runtimeEqn.size() == 3);
+
+        auto ls = NeoN::la::createEmptyLinearSystem<TestType, localIdx>(mesh, sp);
+        eqn.assemble(0.0, 1.0, sp, ls);
+        auto runtimeLs = NeoN::la::createEmptyLinearSystem<TestType, localIdx>(mesh, sp);
+        runtimeEqn.assemble(0.0, 1.0, sp, runtimeLs);
+
+        // 2 * (2 - 2) = 0 for the implicit and 2 * 2 = 4 for the explicit operators
+        REQUIRE(getDiag(ls) == getDiag(runtimeLs));
+        REQUIRE(getRhs(ls) == getRhs(runtimeLs));
+        REQUIRE(getDiag(ls) == 0.0 * NeoN::one<TestType>());
+        REQUIRE(getVector(eqn.explicitOperation(size)) == 4 * NeoN::one<TestType>());
+        REQUIRE(
+            getVector(eqn.explicitOperation(size)) == getVector(runtimeEqn.explicitOperation(size))
+        );
+    }
+}
+
+TEMPLATE_TEST_CASE("StaticExpression fused assembly", "[template]", NeoN::scalar, NeoN::Vec3)
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const localIdx nCells = 10;
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+    auto sp = NeoN::la::SparsityPattern {mesh};
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh);
+
+    fvcc::SurfaceField<NeoN::scalar> faceFlux(exec, "faceFlux", mesh, surfaceBCs);
+    NeoN::fill(faceFlux.internalVector(), 1.0);
+    fvcc::SurfaceField<NeoN::scalar> gamma(exec, "gamma", mesh, surfaceBCs);
+    NeoN::fill(gamma.internalVector(), 2.0);
+
+    std::vector<fvcc::VolumeBoundary<TestType>> bcs;
+    for (auto patchi : {0, 1})
+    {
+        bcs.push_back(fvcc::VolumeBoundary<TestType>(
+            mesh,
+            NeoN::Dictionary(
+                {{"type", std::string("fixedValue")}, {"fixedValue", NeoN::one<TestType>()}}
+            ),
+            patchi
+        ));
+    }
+    fvcc::VolumeField<TestType> phi(exec, "phi", mesh, bcs);
+    NeoN::fill(phi.internalVector(), NeoN::one<TestType>());
+    phi.correctBoundaryConditions();
+
+    SECTION("Static expression of concrete operators on " + execName)
+    {
+        NeoN::TokenList divScheme({std::string("Gauss"), std::string("upwind")});
+        NeoN::TokenList lapScheme(
+            {std::string("Gauss"), std::string("linear"), std::string("uncorrected")}
+        );
+        fvcc::DivOperator divOp(Operator::Type::Implicit, faceFlux, phi, divScheme);
+        fvcc::LaplacianOperator<TestType> lapOp(Operator::Type::Implicit, gamma, phi, lapScheme);
+        auto eqn = dsl::staticExpression(std::move(divOp)) - std::move(lapOp);
+
+        auto ls = NeoN::la::createEmptyLinearSystem<TestType, localIdx>(mesh, sp);
+        eqn.assembleSpatialOperator(ls);
+
+        dsl::Expression<TestType> runtimeEqn = eqn;
+        auto runtimeLs = NeoN::la::createEmptyLinearSystem<TestType, localIdx>(mesh, sp);
+        for (const auto& op : runtimeEqn.spatialOperators())
+        {
+            op.implicitOperation(runtimeLs);
+        }
+
+        auto [valuesHost, runtimeValuesHost, rhsHost, runtimeRhsHost] = NeoN::copyToHosts(
+            ls.matrix().values(), runtimeLs.matrix().values(), ls.rhs(), runtimeLs.rhs()
+        );
+        auto [values, runtimeValues, rhs, runtimeRhs] =
+            NeoN::views(valuesHost, runtimeValuesHost, rhsHost, runtimeRhsHost);
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            REQUIRE(NeoN::mag(values[i] - runtimeValues[i]) == Catch::Approx(0.0).margin(1e-12));
+        }
+        for (size_t i = 0; i < rhs.size(); i++)
+        {
+            REQUIRE(NeoN::mag(rhs[i] - runtimeRhs[i]) == Catch::Approx(0.0).margin(1e-12));
+        }
+    }
+}
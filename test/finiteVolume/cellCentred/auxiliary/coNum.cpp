@@ -36,5 +36,7 @@ TEST_CASE("Courant Number")
         const auto [maxCoNum, meanCoNum] = fvcc::computeCoNum(sf, 0.01);
 
         REQUIRE(maxCoNum == 0.04);
+        REQUIRE(meanCoNum == Catch::Approx(0.04));
+        REQUIRE(fvcc::computeMaxCoNum(sf, 0.01) == 0.04);
     }
 }
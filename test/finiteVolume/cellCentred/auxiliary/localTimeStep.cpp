@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+fvcc::SurfaceField<NeoN::scalar>
+createSurfaceField(const NeoN::UnstructuredMesh& mesh, std::vector<NeoN::scalar> values)
+{
+    std::vector<fvcc::SurfaceBoundary<NeoN::scalar>> bcs {};
+    for (auto patchi : std::initializer_list<NeoN::localIdx> {0, 1})
+    {
+        NeoN::Dictionary dict;
+        dict.insert("type", std::string("calculated"));
+        bcs.push_back(fvcc::SurfaceBoundary<NeoN::scalar>(mesh, dict, patchi));
+    }
+    fvcc::SurfaceField<NeoN::scalar> sf(mesh.exec(), "sf", mesh, bcs);
+    NeoN::Vector<NeoN::scalar> valuesHost(NeoN::SerialExecutor {}, values);
+    sf.internalVector() = valuesHost.copyToExecutor(mesh.exec());
+    return sf;
+}
+
+TEST_CASE("LocalTimeStep")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    // 4 cells of volume 0.25, the faces 0 to 2 are internal, face i connects cell i and i + 1
+    NeoN::UnstructuredMesh mesh = NeoN::create1DUniformMesh(exec, 4);
+    auto faceFlux = createSurfaceField(mesh, {8.0, 0.0, 0.0, 0.0, 0.0});
+
+    NeoN::Dictionary dict;
+    dict.insert("maxCo", 0.5);
+    dict.insert("maxDeltaT", 1.0);
+    dict.insert("smoothingCoeff", 1.0);
+
+    SECTION("computes the time step size from the courant number on " + execName)
+    {
+        dict.insert("nSmoothingSweeps", NeoN::label(0));
+        fvcc::LocalTimeStep localTimeStep(mesh, dict);
+        localTimeStep.update(faceFlux);
+
+        // rDeltaT = sum|phi| / (2 maxCo V) or 1 / maxDeltaT
+        auto rDeltaT = localTimeStep.rDeltaT().copyToHost();
+        REQUIRE(rDeltaT.view()[0] == Catch::Approx(32.0));
+        REQUIRE(rDeltaT.view()[1] == Catch::Approx(32.0));
+        REQUIRE(rDeltaT.view()[2] == Catch::Approx(1.0));
+        REQUIRE(rDeltaT.view()[3] == Catch::Approx(1.0));
+    }
+
+    SECTION("smooths the time step size on " + execName)
+    {
+        fvcc::LocalTimeStep localTimeStep(mesh, dict);
+        localTimeStep.update(faceFlux);
+
+        // every sweep limits the ratio to the neighbours to 1 + smoothingCoeff
+        auto rDeltaT = localTimeStep.rDeltaT().copyToHost();
+        REQUIRE(rDeltaT.view()[0] == Catch::Approx(32.0));
+        REQUIRE(rDeltaT.view()[1] == Catch::Approx(32.0));
+        REQUIRE(rDeltaT.view()[2] == Catch::Approx(16.0));
+        REQUIRE(rDeltaT.view()[3] == Catch::Approx(8.0));
+    }
+
+    SECTION("computes the time step size from the diffusion number on " + execName)
+    {
+        dict.insert("nSmoothingSweeps", NeoN::label(0));
+        dict.insert("maxDi", 0.5);
+        fvcc::LocalTimeStep localTimeStep(mesh, dict);
+        auto noFlux = createSurfaceField(mesh, {0.0, 0.0, 0.0, 0.0, 0.0});
+        auto gamma = createSurfaceField(mesh, {1.0, 1.0, 1.0, 1.0, 1.0});
+        localTimeStep.update(noFlux, gamma);
+
+        // rDeltaT = sum(gamma |S| deltaCoeff) / (maxDi V), deltaCoeff is 4 on internal and
+        // 8 on boundary faces
+        auto rDeltaT = localTimeStep.rDeltaT().copyToHost();
+        REQUIRE(rDeltaT.view()[0] == Catch::Approx(96.0));
+        REQUIRE(rDeltaT.view()[1] == Catch::Approx(64.0));
+        REQUIRE(rDeltaT.view()[2] == Catch::Approx(64.0));
+        REQUIRE(rDeltaT.view()[3] == Catch::Approx(96.0));
+    }
+}
@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+/* @brief a scalar field whose values are a linear function of the cell centres */
+fvcc::VolumeField<NeoN::scalar> linearField(const NeoN::UnstructuredMesh& mesh)
+{
+    fvcc::VolumeField<NeoN::scalar> field(
+        mesh.exec(), "T", mesh, fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh)
+    );
+    auto hostCentres = mesh.cellCentres().copyToHost();
+    std::vector<NeoN::scalar> values;
+    for (const auto& centre : hostCentres.view())
+    {
+        values.push_back(1.0 + centre[0] + 2.0 * centre[1] + 3.0 * centre[2]);
+    }
+    field.internalVector() = NeoN::Vector<NeoN::scalar>(mesh.exec(), values);
+    return field;
+}
+
+/* @brief a scalar field whose values are a quadratic function of the cell centres */
+fvcc::VolumeField<NeoN::scalar> quadraticField(const NeoN::UnstructuredMesh& mesh)
+{
+    fvcc::VolumeField<NeoN::scalar> field(
+        mesh.exec(), "T", mesh, fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh)
+    );
+    auto hostCentres = mesh.cellCentres().copyToHost();
+    std::vector<NeoN::scalar> values;
+    for (const auto& centre : hostCentres.view())
+    {
+        values.push_back(centre[0] * centre[0] + centre[1] * centre[2]);
+    }
+    field.internalVector() = NeoN::Vector<NeoN::scalar>(mesh.exec(), values);
+    return field;
+}
+
+fvcc::VolumeField<NeoN::scalar> zeroField(const NeoN::UnstructuredMesh& mesh)
+{
+    fvcc::VolumeField<NeoN::scalar> field(
+        mesh.exec(), "T", mesh, fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh)
+    );
+    NeoN::fill(field.internalVector(), 0.0);
+    return field;
+}
+
+TEST_CASE("MeshToMesh")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    auto coarse = NeoN::create3DUniformMesh(exec, 4, 4, 4);
+    auto fine = NeoN::create3DUniformMesh(exec, 8, 8, 8);
+    auto coarseHostCentres = coarse.cellCentres().copyToHost();
+    auto fineHostCentres = fine.cellCentres().copyToHost();
+
+    SECTION("maps from the nearest cell on " + execName)
+    {
+        auto same = NeoN::create3DUniformMesh(exec, 4, 4, 4);
+        NeoN::Dictionary dict;
+        dict.insert("method", std::string("nearest"));
+        fvcc::MeshToMesh mapper(coarse, same, dict);
+        REQUIRE(mapper.method() == "nearest");
+        REQUIRE(mapper.sources().numSegments() == same.nCells());
+
+        auto source = linearField(coarse);
+        auto target = zeroField(same);
+        auto statistics = mapper.map(source, target);
+        REQUIRE(statistics.nOutside == 0);
+        REQUIRE(statistics.integralError == Catch::Approx(0.0).margin(1e-14));
+        REQUIRE(statistics.boundednessError == Catch::Approx(0.0).margin(1e-14));
+
+        auto sourceValues = source.internalVector().copyToHost();
+        auto targetValues = target.internalVector().copyToHost();
+        for (NeoN::localIdx celli = 0; celli < same.nCells(); celli++)
+        {
+            REQUIRE(targetValues.view()[celli] == sourceValues.view()[celli]);
+        }
+    }
+
+    SECTION("maps conservatively to a finer mesh on " + execName)
+    {
+        fvcc::MeshToMesh mapper(coarse, fine);
+        REQUIRE(mapper.method() == "conservative");
+
+        auto source = linearField(coarse);
+        auto target = zeroField(fine);
+        auto statistics = mapper.map(source, target);
+        REQUIRE(statistics.nOutside == 0);
+        REQUIRE(statistics.integralError == Catch::Approx(0.0).margin(1e-12));
+        REQUIRE(statistics.boundednessError == Catch::Approx(0.0).margin(1e-12));
+
+        // every fine cell is inside of a single coarse cell
+        auto segments = mapper.sources().segments().copyToHost();
+        auto sourceValues = source.internalVector().copyToHost();
+        auto targetValues = target.internalVector().copyToHost();
+        for (NeoN::localIdx celli = 0; celli < fine.nCells(); celli++)
+        {
+            REQUIRE(segments.view()[celli + 1] - segments.view()[celli] == 1);
+            const auto& centre = fineHostCentres.view()[celli];
+            auto index = [&](int dir) { return static_cast<NeoN::localIdx>(centre[dir] * 4); };
+            const auto coarsei = index(0) + 4 * (index(1) + 4 * index(2));
+            REQUIRE(targetValues.view()[celli] == Catch::Approx(sourceValues.view()[coarsei]));
+        }
+    }
+
+    SECTION("maps conservatively to a coarser mesh on " + execName)
+    {
+        NeoN::Dictionary dict;
+        dict.insert("batchSize", NeoN::label(10));
+        fvcc::MeshToMesh mapper(fine, coarse, dict);
+
+        auto source = linearField(fine);
+        auto target = zeroField(coarse);
+        auto statistics = mapper.map(source, target);
+        REQUIRE(statistics.integralError == Catch::Approx(0.0).margin(1e-12));
+        REQUIRE(statistics.boundednessError == Catch::Approx(0.0).margin(1e-12));
+
+        // every coarse cell is the mean of eight fine cells, which is its centre value for a
+        // linear field
+        auto segments = mapper.sources().segments().copyToHost();
+        auto weights = mapper.weights().copyToHost();
+        auto targetValues = target.internalVector().copyToHost();
+        for (NeoN::localIdx celli = 0; celli < coarse.nCells(); celli++)
+        {
+            REQUIRE(segments.view()[celli + 1] - segments.view()[celli] == 8);
+            for (auto i = segments.view()[celli]; i < segments.view()[celli + 1]; i++)
+            {
+                REQUIRE(weights.view()[i] == Catch::Approx(0.125));
+            }
+            const auto& centre = coarseHostCentres.view()[celli];
+            const auto expected = 1.0 + centre[0] + 2.0 * centre[1] + 3.0 * centre[2];
+            REQUIRE(targetValues.view()[celli] == Catch::Approx(expected));
+        }
+    }
+
+    SECTION("derives the samples from the volume ratio of a 4:1 coarsening on " + execName)
+    {
+        auto fine4 = NeoN::create3DUniformMesh(exec, 16, 16, 16);
+        fvcc::MeshToMesh mapper(fine4, coarse);
+
+        // a field which is not linear is only conserved if every fine cell is sampled once
+        auto source = quadraticField(fine4);
+        auto target = zeroField(coarse);
+        auto statistics = mapper.map(source, target);
+        REQUIRE(statistics.nOutside == 0);
+        REQUIRE(statistics.integralError == Catch::Approx(0.0).margin(1e-12));
+        REQUIRE(statistics.boundednessError == Catch::Approx(0.0).margin(1e-12));
+
+        auto segments = mapper.sources().segments().copyToHost();
+        auto weights = mapper.weights().copyToHost();
+        for (NeoN::localIdx celli = 0; celli < coarse.nCells(); celli++)
+        {
+            REQUIRE(segments.view()[celli + 1] - segments.view()[celli] == 64);
+            for (auto i = segments.view()[celli]; i < segments.view()[celli + 1]; i++)
+            {
+                REQUIRE(weights.view()[i] == Catch::Approx(1.0 / 64.0));
+            }
+        }
+    }
+
+    SECTION("rejects volume ratios exceeding the derived samples on " + execName)
+    {
+        const auto n = fvcc::maxDerivedSamples + 1;
+        auto source = NeoN::create3DUniformMesh(exec, n, n, n);
+        auto target = NeoN::create3DUniformMesh(exec, 1, 1, 1);
+        REQUIRE_THROWS(fvcc::MeshToMesh(source, target));
+
+        NeoN::Dictionary dict;
+        dict.insert("nSamples", NeoN::label(n));
+        fvcc::MeshToMesh mapper(source, target, dict);
+        REQUIRE(mapper.sources().size() == n * n * n);
+    }
+
+    SECTION("maps vector fields between meshes of different resolution on " + execName)
+    {
+        auto mesh = NeoN::create3DUniformMesh(exec, 6, 5, 3);
+        NeoN::Dictionary dict;
+        dict.insert("nSamples", NeoN::label(4));
+        fvcc::MeshToMesh mapper(fine, mesh, dict);
+
+        fvcc::VolumeField<NeoN::Vec3> source(
+            exec, "U", fine, fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::Vec3>>(fine)
+        );
+        fvcc::VolumeField<NeoN::Vec3> target(
+            exec, "U", mesh, fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::Vec3>>(mesh)
+        );
+        NeoN::fill(source.internalVector(), NeoN::Vec3(1.0, -2.0, 3.0));
+        NeoN::fill(target.internalVector(), NeoN::Vec3(0.0, 0.0, 0.0));
+        auto statistics = mapper.map(source, target);
+
+        // a uniform field is preserved since the weights of every target cell sum to one
+        REQUIRE(statistics.integralError == Catch::Approx(0.0).margin(1e-12));
+        REQUIRE(statistics.boundednessError == Catch::Approx(0.0).margin(1e-12));
+        auto targetValues = target.internalVector().copyToHost();
+        for (const auto& value : targetValues.view())
+        {
+            REQUIRE(value[0] == Catch::Approx(1.0));
+            REQUIRE(value[1] == Catch::Approx(-2.0));
+            REQUIRE(value[2] == Catch::Approx(3.0));
+        }
+    }
+
+    SECTION("rejects unknown methods on " + execName)
+    {
+        NeoN::Dictionary dict;
+        dict.insert("method", std::string("cubic"));
+        REQUIRE_THROWS(fvcc::MeshToMesh(coarse, fine, dict));
+    }
+}
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+#include "../../../../mesh/unstructured/periodicMesh.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+TEST_CASE("processor")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::localIdx nCells = 10;
+    auto mesh = createPeriodic1DMesh(exec, nCells);
+    REQUIRE(NeoN::nPhysicalBoundaryFaces(mesh) == 0);
+
+    std::vector<fvcc::VolumeBoundary<NeoN::scalar>> bcs;
+    for (NeoN::localIdx patchi = 0; patchi < mesh.nBoundaries(); patchi++)
+    {
+        NeoN::Dictionary dict {{"type", std::string("processor")}, {"neighbourRank", 0}};
+        bcs.emplace_back(mesh, dict, patchi);
+    }
+    REQUIRE(!bcs[0].attributes().assignable);
+
+    fvcc::VolumeField<NeoN::scalar> phi(exec, "phi", mesh, bcs);
+    auto phiHost = phi.internalVector().copyToHost();
+    for (NeoN::localIdx celli = 0; celli < nCells; celli++)
+    {
+        phiHost.view()[celli] = static_cast<NeoN::scalar>(celli);
+    }
+    phi.internalVector() = phiHost.copyToExecutor(exec);
+
+    SECTION("Exchanges neighbour cell values " + execName)
+    {
+        NeoN::fill(phi.boundaryData().valueFraction(), 1.0);
+        phi.correctBoundaryConditions();
+
+        auto values = phi.boundaryData().value().copyToHost();
+        auto valueFractions = phi.boundaryData().valueFraction().copyToHost();
+        REQUIRE(values.view()[0] == static_cast<NeoN::scalar>(nCells - 1));
+        REQUIRE(values.view()[1] == 0.0);
+        REQUIRE(valueFractions.view()[0] == 0.0);
+        REQUIRE(valueFractions.view()[1] == 0.0);
+    }
+
+    SECTION("Interpolates processor faces like internal faces " + execName)
+    {
+        // boundary values are not corrected, the interpolation exchanges the cell values itself
+        auto linear = fvcc::SurfaceInterpolation<NeoN::scalar>(
+            exec, mesh, NeoN::TokenList({std::string("linear")})
+        );
+        fvcc::SurfaceField<NeoN::scalar> phif(
+            exec, "phif", mesh, fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh)
+        );
+        linear.interpolate(phi, phif);
+
+        auto phifHost = phif.internalVector().copyToHost();
+        auto nInternal = mesh.nInternalFaces();
+        REQUIRE(phifHost.view()[0] == Catch::Approx(0.5));
+        REQUIRE(phifHost.view()[nInternal] == Catch::Approx(0.5 * (nCells - 1)));
+        REQUIRE(phifHost.view()[nInternal + 1] == Catch::Approx(0.5 * (nCells - 1)));
+    }
+
+    SECTION("Gradient of a constant field vanishes " + execName)
+    {
+        NeoN::fill(phi.internalVector(), 2.0);
+        fvcc::GaussGreenGrad grad(exec, mesh);
+        auto gradPhi = grad.grad(phi);
+
+        auto gradHost = gradPhi.internalVector().copyToHost();
+        for (auto value : gradHost.view())
+        {
+            REQUIRE(NeoN::mag(value) == Catch::Approx(0.0).margin(1e-12));
+        }
+    }
+}
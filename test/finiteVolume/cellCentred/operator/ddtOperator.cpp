@@ -105,6 +105,29 @@ TEMPLATE_TEST_CASE("DdtOperator", "[template]", NeoN::scalar, NeoN::Vec3)
             REQUIRE(rhsV[ii] == -2.0 * volV[0] * one<TestType>());
         }
     }
+
+    SECTION("DdtOperator with local time step " + execName)
+    {
+        // the time step size passed to the operations is ignored
+        auto rDeltaT = Vector<scalar>(exec, phi.internalVector().size(), 4.0);
+        auto source = Vector<TestType>(exec, phi.size(), zero<TestType>());
+        dsl::exp::ddt(phi, rDeltaT).explicitOperation(source, 1.0, 0.5);
+
+        auto ls = NeoN::la::createEmptyLinearSystem<TestType, NeoN::localIdx>(mesh, sp);
+        dsl::imp::ddt(phi, rDeltaT).implicitOperation(ls, 1.0, 0.5);
+
+        const auto [vol, hostSource, lsHost] = copyToHosts(mesh.cellVolumes(), source, ls);
+        const auto [volV, vals, mtxValsV, rhsV] =
+            views(vol, hostSource, lsHost.matrix().values(), lsHost.rhs());
+
+        for (auto ii = 0; ii < vals.size(); ++ii)
+        {
+            // => (10 -- 1)*4*V = 44V
+            REQUIRE(vals[ii] == volV[0] * TestType(44.0));
+            REQUIRE(mtxValsV[ii] == 4.0 * volV[0] * one<TestType>());
+            REQUIRE(rhsV[ii] == -4.0 * volV[0] * one<TestType>());
+        }
+    }
 }
 
 }
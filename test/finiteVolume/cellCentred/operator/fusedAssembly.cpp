@@ -0,0 +1,233 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+namespace NeoN
+{
+
+TEMPLATE_TEST_CASE("fusedAssembly", "[template]", NeoN::scalar, NeoN::Vec3)
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const localIdx nCells = 10;
+    auto mesh = create1DUniformMesh(exec, nCells);
+    auto sp = la::SparsityPattern {mesh};
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<scalar>>(mesh);
+
+    fvcc::SurfaceField<scalar> faceFlux(exec, "faceFlux", mesh, surfaceBCs);
+    fill(faceFlux.internalVector(), 1.0);
+    auto faceFluxView = faceFlux.internalVector().view();
+    // face on the left side has different orientation
+    parallelFor(
+        exec, {nCells - 1, nCells}, KOKKOS_LAMBDA(const localIdx i) { faceFluxView[i] = -1.0; }
+    );
+
+    fvcc::SurfaceField<scalar> gamma(exec, "gamma", mesh, surfaceBCs);
+    fill(gamma.internalVector(), 2.0);
+
+    std::vector<fvcc::VolumeBoundary<TestType>> bcs;
+    bcs.push_back(fvcc::VolumeBoundary<TestType>(
+        mesh, Dictionary({{"type", std::string("fixedValue")}, {"fixedValue", one<TestType>()}}), 0
+    ));
+    bcs.push_back(fvcc::VolumeBoundary<TestType>(
+        mesh,
+        Dictionary({{"type", std::string("fixedGradient")}, {"fixedGradient", one<TestType>()}}),
+        1
+    ));
+    fvcc::VolumeField<TestType> phi(exec, "phi", mesh, bcs);
+    parallelFor(
+        phi.internalVector(),
+        KOKKOS_LAMBDA(const localIdx i) { return scalar(i + 1) * one<TestType>(); }
+    );
+    phi.correctBoundaryConditions();
+
+    auto interpolation = GENERATE(std::string("linear"), std::string("upwind"));
+
+    SECTION("fused and sequential assembly agree with " + interpolation + " on " + execName)
+    {
+        dsl::SpatialOperator<TestType> divOp = dsl::imp::div(faceFlux, phi);
+        divOp.read(TokenList({std::string("Gauss"), interpolation}));
+        dsl::SpatialOperator<TestType> lapOp = dsl::imp::laplacian(gamma, phi);
+        lapOp.read(
+            TokenList({std::string("Gauss"), std::string("linear"), std::string("uncorrected")})
+        );
+        lapOp = dsl::Coeff(-0.5) * lapOp;
+
+        dsl::Expression<TestType> eqn(exec);
+        eqn.addOperator(divOp);
+        eqn.addOperator(lapOp);
+
+        auto fusedLs = la::createEmptyLinearSystem<TestType, localIdx>(mesh, sp);
+        eqn.assembleSpatialOperator(fusedLs);
+
+        auto ls = la::createEmptyLinearSystem<TestType, localIdx>(mesh, sp);
+        divOp.implicitOperation(ls);
+        lapOp.implicitOperation(ls);
+
+        auto fusedValuesHost = fusedLs.matrix().values().copyToHost();
+        auto valuesHost = ls.matrix().values().copyToHost();
+        auto fusedRhsHost = fusedLs.rhs().copyToHost();
+        auto rhsHost = ls.rhs().copyToHost();
+        auto [fusedValues, values, fusedRhs, rhs] =
+            views(fusedValuesHost, valuesHost, fusedRhsHost, rhsHost);
+
+        REQUIRE(fusedValues.size() == values.size());
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            REQUIRE(mag(fusedValues[i] - values[i]) == Catch::Approx(0.0).margin(1e-12));
+        }
+        for (size_t i = 0; i < rhs.size(); i++)
+        {
+            REQUIRE(mag(fusedRhs[i] - rhs[i]) == Catch::Approx(0.0).margin(1e-12));
+        }
+    }
+
+    SECTION("fused groups of two fields agree with " + interpolation + " on " + execName)
+    {
+        // the interleaved terms of both fields are grouped by field and fused per field
+        fvcc::VolumeField<TestType> psi(exec, "psi", mesh, bcs);
+        parallelFor(
+            psi.internalVector(),
+            KOKKOS_LAMBDA(const localIdx i) { return scalar(nCells - i) * one<TestType>(); }
+        );
+        psi.correctBoundaryConditions();
+
+        const auto divTokens = TokenList({std::string("Gauss"), interpolation});
+        const auto lapTokens =
+            TokenList({std::string("Gauss"), std::string("linear"), std::string("uncorrected")});
+        dsl::SpatialOperator<TestType> divPhi = dsl::imp::div(faceFlux, phi);
+        divPhi.read(divTokens);
+        dsl::SpatialOperator<TestType> lapPsi = dsl::imp::laplacian(gamma, psi);
+        lapPsi.read(lapTokens);
+        dsl::SpatialOperator<TestType> lapPhi = dsl::imp::laplacian(gamma, phi);
+        lapPhi.read(lapTokens);
+        lapPhi = dsl::Coeff(-0.5) * lapPhi;
+        dsl::SpatialOperator<TestType> divPsi = dsl::imp::div(faceFlux, psi);
+        divPsi.read(divTokens);
+        std::vector<dsl::SpatialOperator<TestType>> ops {divPhi, lapPsi, lapPhi, divPsi};
+
+        std::vector<fvcc::GaussGreenTerm<TestType>> terms;
+        for (const auto& op : ops)
+        {
+            auto term = op.gaussGreenTerm();
+            REQUIRE(term.has_value());
+            terms.push_back(std::move(*term));
+        }
+
+        auto fusedLs = la::createEmptyLinearSystem<TestType, localIdx>(mesh, sp);
+        fvcc::assembleGaussGreenTerms<TestType>(fusedLs, terms);
+
+        auto ls = la::createEmptyLinearSystem<TestType, localIdx>(mesh, sp);
+        for (const auto& op : ops)
+        {
+            op.implicitOperation(ls);
+        }
+
+        auto [fusedValuesHost, valuesHost, fusedRhsHost, rhsHost] = copyToHosts(
+            fusedLs.matrix().values(), ls.matrix().values(), fusedLs.rhs(), ls.rhs()
+        );
+        auto [fusedValues, values, fusedRhs, rhs] =
+            views(fusedValuesHost, valuesHost, fusedRhsHost, rhsHost);
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            REQUIRE(mag(fusedValues[i] - values[i]) == Catch::Approx(0.0).margin(1e-12));
+        }
+        for (size_t i = 0; i < rhs.size(); i++)
+        {
+            REQUIRE(mag(fusedRhs[i] - rhs[i]) == Catch::Approx(0.0).margin(1e-12));
+        }
+    }
+
+    SECTION(
+        "fused chunks and sequential assembly agree with " + interpolation + " on " + execName
+    )
+    {
+        // more terms than fit into a single fused kernel, a coefficient field selects the
+        // kernels for non-uniform scalings
+        auto fieldScaled = GENERATE(false, true);
+        Vector<scalar> cellScaling(exec, nCells, 0.5);
+        dsl::Expression<TestType> eqn(exec);
+        std::vector<dsl::SpatialOperator<TestType>> ops;
+        const std::vector<scalar> scales {1.0, -0.5, 2.0, 0.25, -3.0, 1.5};
+        for (std::size_t i = 0; i < scales.size(); i++)
+        {
+            dsl::SpatialOperator<TestType> op = i % 2 == 0
+                                                  ? dsl::imp::div(faceFlux, phi)
+                                                  : dsl::imp::laplacian(gamma, phi);
+            op.read(
+                i % 2 == 0
+                    ? TokenList({std::string("Gauss"), interpolation})
+                    : TokenList(
+                        {std::string("Gauss"), std::string("linear"), std::string("uncorrected")}
+                    )
+            );
+            op = (fieldScaled && i == 0 ? dsl::Coeff(scales[i], cellScaling)
+                                        : dsl::Coeff(scales[i]))
+               * op;
+            eqn.addOperator(op);
+            ops.push_back(op);
+        }
+        REQUIRE(ops.size() > fvcc::maxFusedGaussGreenTerms);
+
+        auto fusedLs = la::createEmptyLinearSystem<TestType, localIdx>(mesh, sp);
+        auto ls = la::createEmptyLinearSystem<TestType, localIdx>(mesh, sp);
+        // a second assembly after a reset must not accumulate the previous one
+        for (int step = 0; step < 2; step++)
+        {
+            fusedLs.reset();
+            eqn.assembleSpatialOperator(fusedLs);
+            ls.reset();
+            for (const auto& op : ops)
+            {
+                op.implicitOperation(ls);
+            }
+        }
+
+        using BoundaryCoefficients = la::BoundaryCoefficients<TestType, localIdx>;
+        const std::string bcName = "boundaryCoefficients";
+        const auto& fusedBcCoeffs =
+            fusedLs.auxiliaryCoefficients().template get<BoundaryCoefficients>(bcName);
+        const auto& bcCoeffs =
+            ls.auxiliaryCoefficients().template get<BoundaryCoefficients>(bcName);
+        auto [fusedValuesHost, valuesHost, fusedRhsHost, rhsHost] = copyToHosts(
+            fusedLs.matrix().values(), ls.matrix().values(), fusedLs.rhs(), ls.rhs()
+        );
+        auto [fusedBoundHost, boundHost, fusedBoundRhsHost, boundRhsHost] = copyToHosts(
+            fusedBcCoeffs.matrixValues,
+            bcCoeffs.matrixValues,
+            fusedBcCoeffs.rhsValues,
+            bcCoeffs.rhsValues
+        );
+        auto [fusedValues, values, fusedRhs, rhs] =
+            views(fusedValuesHost, valuesHost, fusedRhsHost, rhsHost);
+        auto [fusedBound, bound, fusedBoundRhs, boundRhs] =
+            views(fusedBoundHost, boundHost, fusedBoundRhsHost, boundRhsHost);
+
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            REQUIRE(mag(fusedValues[i] - values[i]) == Catch::Approx(0.0).margin(1e-12));
+        }
+        for (size_t i = 0; i < rhs.size(); i++)
+        {
+            REQUIRE(mag(fusedRhs[i] - rhs[i]) == Catch::Approx(0.0).margin(1e-12));
+        }
+        REQUIRE(mag(bound[0]) > 0.0);
+        for (size_t i = 0; i < bound.size(); i++)
+        {
+            REQUIRE(mag(fusedBound[i] - bound[i]) == Catch::Approx(0.0).margin(1e-12));
+            REQUIRE(mag(fusedBoundRhs[i] - boundRhs[i]) == Catch::Approx(0.0).margin(1e-12));
+        }
+    }
+}
+
+}
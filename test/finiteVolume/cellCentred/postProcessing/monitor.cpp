@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+/* @brief reads the header and the values of every row of a monitor file */
+std::pair<std::string, std::vector<std::vector<NeoN::scalar>>>
+readMonitorFile(const std::filesystem::path& file)
+{
+    std::ifstream in(file);
+    std::string header;
+    std::getline(in, header);
+    std::vector<std::vector<NeoN::scalar>> rows;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::istringstream values(line);
+        auto& row = rows.emplace_back();
+        NeoN::scalar value;
+        while (values >> value)
+        {
+            row.push_back(value);
+        }
+    }
+    return {header, rows};
+}
+
+TEST_CASE("Monitor")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const NeoN::localIdx nCells = 10;
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+    fvcc::VolumeField<NeoN::scalar> t(
+        exec, "T", mesh, fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh)
+    );
+    fvcc::VolumeField<NeoN::Vec3> u(
+        exec, "U", mesh, fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::Vec3>>(mesh)
+    );
+
+    // the value of every cell is its index
+    std::vector<NeoN::scalar> tValues;
+    std::vector<NeoN::Vec3> uValues;
+    for (NeoN::localIdx celli = 0; celli < nCells; celli++)
+    {
+        tValues.push_back(NeoN::scalar(celli));
+        uValues.push_back(NeoN::Vec3(0.0, -NeoN::scalar(celli), 0.0));
+    }
+    t.internalVector() = NeoN::Vector<NeoN::scalar>(exec, tValues);
+    u.internalVector() = NeoN::Vector<NeoN::Vec3>(exec, uValues);
+    t.boundaryData().value() = NeoN::Vector<NeoN::scalar>(exec, {1.0, 3.0});
+
+    auto directory = std::filesystem::temp_directory_path() / ("monitor_" + execName);
+    std::filesystem::remove_all(directory);
+
+    SECTION("finds the cells closest to points on " + execName)
+    {
+        std::vector<NeoN::Vec3> points {{0.05, 0.0, 0.0}, {0.96, 0.2, 0.0}, {0.31, 0.0, 0.0}};
+        auto cells = fvcc::findCells(mesh, points);
+        auto hostCells = cells.copyToHost();
+        REQUIRE(hostCells.view()[0] == 0);
+        REQUIRE(hostCells.view()[1] == nCells - 1);
+        REQUIRE(hostCells.view()[2] == 3);
+    }
+
+    SECTION("computes volume-weighted statistics on " + execName)
+    {
+        auto tStatistics = fvcc::volumeStatistics(t);
+        REQUIRE(tStatistics.min == 0.0);
+        REQUIRE(tStatistics.max == 9.0);
+        REQUIRE(tStatistics.mean() == Catch::Approx(4.5));
+
+        // the extrema of vectors refer to the magnitude
+        auto uStatistics = fvcc::volumeStatistics(u);
+        REQUIRE(uStatistics.min == 0.0);
+        REQUIRE(uStatistics.max == 9.0);
+        REQUIRE(uStatistics.mean()[1] == Catch::Approx(-4.5));
+    }
+
+    SECTION("writes the samplers every output interval on " + execName)
+    {
+        NeoN::Dictionary lines(
+            {{"centre",
+              NeoN::Dictionary(
+                  {{"start", NeoN::Vec3(0.05, 0.0, 0.0)},
+                   {"end", NeoN::Vec3(0.95, 0.0, 0.0)},
+                   {"nPoints", NeoN::label(10)}}
+              )}}
+        );
+        NeoN::Dictionary planes(
+            {{"section",
+              NeoN::Dictionary(
+                  {{"origin", NeoN::Vec3(0.25, -1.0, -1.0)},
+                   {"e1", NeoN::Vec3(0.0, 2.0, 0.0)},
+                   {"e2", NeoN::Vec3(0.0, 0.0, 2.0)},
+                   {"nPoints1", NeoN::label(2)},
+                   {"nPoints2", NeoN::label(3)}}
+              )}}
+        );
+        NeoN::Dictionary dict(
+            {{"probes", std::vector<NeoN::Vec3> {{0.05, 0.0, 0.0}, {0.75, 0.0, 0.0}}},
+             {"lines", lines},
+             {"planes", planes},
+             {"patches", std::vector<NeoN::localIdx> {0, 1}},
+             {"writeInterval", NeoN::label(2)}}
+        );
+        fvcc::Monitor monitor(mesh, directory, "monitor", dict);
+        monitor.add(t);
+        monitor.add(u);
+
+        REQUIRE(
+            monitor.samplers()
+            == std::vector<std::string> {"probes", "centre", "section", "patches", "statistics"}
+        );
+        REQUIRE(monitor.execute(0.0));
+        REQUIRE_FALSE(monitor.execute(0.1));
+        t.internalVector() = 2.0;
+        REQUIRE(monitor.execute(0.2));
+
+        auto [probesHeader, probes] = readMonitorFile(monitor.file("probes"));
+        REQUIRE(probesHeader == "# time T(0) T(1) U(0)_x U(0)_y U(0)_z U(1)_x U(1)_y U(1)_z");
+        REQUIRE(probes.size() == 2);
+        REQUIRE(
+            probes[0] == std::vector<NeoN::scalar> {0.0, 0.0, 7.0, 0.0, 0.0, 0.0, 0.0, -7.0, 0.0}
+        );
+        REQUIRE(probes[1][0] == 0.2);
+        REQUIRE(probes[1][2] == 2.0);
+
+        auto [centreHeader, centre] = readMonitorFile(monitor.file("centre"));
+        REQUIRE(centre[0].size() == 1 + 10 + 3 * 10);
+        for (NeoN::localIdx i = 0; i < nCells; i++)
+        {
+            REQUIRE(centre[0][1 + i] == NeoN::scalar(i));
+        }
+
+        auto [sectionHeader, section] = readMonitorFile(monitor.file("section"));
+        REQUIRE(section[0].size() == 1 + 6 + 3 * 6);
+        REQUIRE(section[0][1] == 2.0);
+        REQUIRE(section[0][6] == 2.0);
+
+        auto [patchesHeader, patches] = readMonitorFile(monitor.file("patches"));
+        REQUIRE(patches[0][1] == 1.0);
+        REQUIRE(patches[0][2] == 3.0);
+
+        auto [statisticsHeader, statistics] = readMonitorFile(monitor.file("statistics"));
+        REQUIRE(
+            statisticsHeader == "# time T_min T_max T_mean U_min U_max U_mean_x U_mean_y U_mean_z"
+        );
+        REQUIRE(statistics[0][3] == Catch::Approx(4.5));
+        REQUIRE(statistics[1][3] == Catch::Approx(2.0));
+        REQUIRE(statistics[1][7] == Catch::Approx(-4.5));
+    }
+
+    SECTION("unknown patches are rejected on " + execName)
+    {
+        NeoN::Dictionary dict({{"patches", std::vector<NeoN::localIdx> {2}}});
+        REQUIRE_THROWS(fvcc::Monitor(mesh, directory, "monitor", dict));
+    }
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include <algorithm>
+#include <random>
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+/* @brief the index of the closest point, the smallest index for ties */
+NeoN::localIdx bruteForceNearest(const NeoN::Vector<NeoN::Vec3>& centres, const NeoN::Vec3& point)
+{
+    auto hostCentres = centres.copyToHost();
+    auto centreView = hostCentres.view();
+    NeoN::localIdx nearest = 0;
+    for (NeoN::localIdx i = 1; i < centreView.size(); i++)
+    {
+        if (NeoN::mag(centreView[i] - point) < NeoN::mag(centreView[nearest] - point)) nearest = i;
+    }
+    return nearest;
+}
+
+TEST_CASE("MeshSearch")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const NeoN::localIdx n = 8;
+    auto mesh = NeoN::create3DUniformMesh(exec, n, n, n);
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<NeoN::scalar> distribution(0.0, 1.0);
+    std::vector<NeoN::Vec3> hostPoints;
+    for (int i = 0; i < 100; i++)
+    {
+        hostPoints.emplace_back(
+            distribution(generator), distribution(generator), distribution(generator)
+        );
+    }
+    NeoN::Vector<NeoN::Vec3> points(exec, hostPoints);
+
+    SECTION("is cached in the stencil database on " + execName)
+    {
+        const auto& search = fvcc::MeshSearch::readOrCreate(mesh);
+        REQUIRE(mesh.stencilDB().contains("MeshSearch"));
+        REQUIRE(&search == &fvcc::MeshSearch::readOrCreate(mesh));
+        REQUIRE(search.cells().size() == mesh.nCells());
+        REQUIRE(search.faces().size() == mesh.nFaces());
+
+        // every cell is part of exactly one leaf and inside of the box of the root
+        auto primitives = search.cells().primitives().copyToHost();
+        std::vector<NeoN::localIdx> sorted(primitives.view().begin(), primitives.view().end());
+        std::sort(sorted.begin(), sorted.end());
+        for (NeoN::localIdx i = 0; i < mesh.nCells(); i++)
+        {
+            REQUIRE(sorted[static_cast<size_t>(i)] == i);
+        }
+        auto nodes = search.cells().nodes().copyToHost();
+        auto root = nodes.view()[0];
+        auto cellCentres = mesh.cellCentres().copyToHost();
+        for (const auto& centre : cellCentres.view())
+        {
+            REQUIRE(root.contains(centre));
+        }
+    }
+
+    SECTION("finds the nearest cells and faces on " + execName)
+    {
+        auto cells = fvcc::findNearestCells(mesh, points).copyToHost();
+        auto faces = fvcc::findNearestFaces(mesh, points).copyToHost();
+        for (size_t i = 0; i < hostPoints.size(); i++)
+        {
+            REQUIRE(cells.view()[i] == bruteForceNearest(mesh.cellCentres(), hostPoints[i]));
+            REQUIRE(faces.view()[i] == bruteForceNearest(mesh.faceCentres(), hostPoints[i]));
+        }
+    }
+
+    SECTION("finds the containing cells on " + execName)
+    {
+        auto cells = fvcc::findContainingCells(mesh, points).copyToHost();
+        for (size_t pointi = 0; pointi < hostPoints.size(); pointi++)
+        {
+            const auto& point = hostPoints[pointi];
+            auto index = [&](int dir) { return static_cast<NeoN::localIdx>(point[dir] * n); };
+            REQUIRE(cells.view()[pointi] == index(0) + n * (index(1) + n * index(2)));
+        }
+
+        NeoN::Vector<NeoN::Vec3> outside(exec, {{1.5, 0.5, 0.5}, {0.5, -0.1, 0.5}});
+        auto outsideCells = fvcc::findContainingCells(mesh, outside).copyToHost();
+        REQUIRE(outsideCells.view()[0] == -1);
+        REQUIRE(outsideCells.view()[1] == -1);
+    }
+
+    SECTION("finds the cells within a radius on " + execName)
+    {
+        const NeoN::scalar radius = 0.2;
+        auto cells = fvcc::findCellsInRadius(mesh, points, radius);
+        auto hostValues = cells.values().copyToHost();
+        auto hostSegments = cells.segments().copyToHost();
+        auto cellCentres = mesh.cellCentres().copyToHost();
+        for (size_t pointi = 0; pointi < hostPoints.size(); pointi++)
+        {
+            std::vector<NeoN::localIdx> expected;
+            for (NeoN::localIdx celli = 0; celli < mesh.nCells(); celli++)
+            {
+                if (NeoN::mag(cellCentres.view()[celli] - hostPoints[pointi]) <= radius)
+                {
+                    expected.push_back(celli);
+                }
+            }
+            std::vector<NeoN::localIdx> found(
+                hostValues.view().begin() + hostSegments.view()[pointi],
+                hostValues.view().begin() + hostSegments.view()[pointi + 1]
+            );
+            std::sort(found.begin(), found.end());
+            REQUIRE(found == expected);
+        }
+    }
+
+    SECTION("works on a 1D mesh on " + execName)
+    {
+        auto mesh1D = NeoN::create1DUniformMesh(exec, 10);
+        NeoN::Vector<NeoN::Vec3> points1D(exec, {{0.05, 0.0, 0.0}, {0.51, 0.0, 0.0}});
+        auto nearest = fvcc::findNearestCells(mesh1D, points1D).copyToHost();
+        REQUIRE(nearest.view()[0] == 0);
+        REQUIRE(nearest.view()[1] == 5);
+        auto containing = fvcc::findContainingCells(mesh1D, points1D).copyToHost();
+        REQUIRE(containing.view()[0] == 0);
+        REQUIRE(containing.view()[1] == 5);
+    }
+}
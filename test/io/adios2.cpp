@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include <filesystem>
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+TEST_CASE("Adios2")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const NeoN::localIdx nCells = 10;
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+    auto bcs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh);
+    fvcc::VolumeField<NeoN::scalar> t(exec, "T", mesh, bcs);
+    fvcc::VolumeField<NeoN::scalar> tRead(exec, "T", mesh, bcs);
+    auto file = (std::filesystem::temp_directory_path() / ("adios2_" + execName + ".bp")).string();
+
+    auto value = [](const auto& vec, NeoN::localIdx i)
+    {
+        auto host = vec.copyToHost();
+        return host.view()[i];
+    };
+
+    SECTION("write and read steps with the file engine on " + execName)
+    {
+        {
+            NeoN::io::Adios2Writer writer(mesh, file);
+            for (int step = 0; step < 3; step++)
+            {
+                NeoN::fill(t.internalVector(), NeoN::scalar(step));
+                NeoN::fill(t.boundaryData().value(), NeoN::scalar(10 * step));
+                writer.beginStep(0.5 * step);
+                writer.put(t);
+                writer.endStep();
+                // the data is buffered at endStep, thus the field can be modified while writing
+                NeoN::fill(t.internalVector(), -1.0);
+            }
+            REQUIRE(writer.steps() == 3);
+        }
+
+        NeoN::io::Adios2Reader reader(mesh, file);
+        // the values are read into the existing allocation, thus views stay valid
+        const auto* tReadData = tRead.internalVector().data();
+        int step = 0;
+        while (reader.beginStep())
+        {
+            REQUIRE(reader.time() == 0.5 * step);
+            reader.get(tRead);
+            REQUIRE(tRead.internalVector().data() == tReadData);
+            REQUIRE(value(tRead.internalVector(), 0) == NeoN::scalar(step));
+            REQUIRE(value(tRead.internalVector(), nCells - 1) == NeoN::scalar(step));
+            REQUIRE(value(tRead.boundaryData().value(), 0) == NeoN::scalar(10 * step));
+            if (step == 0)
+            {
+                auto points = reader.get<NeoN::Vec3>("mesh/points");
+                REQUIRE(points.size() == mesh.points().size());
+                REQUIRE(value(points, 1) == value(mesh.points(), 1));
+                auto faceOwner = reader.get<NeoN::label>("mesh/faceOwner");
+                REQUIRE(faceOwner.size() == mesh.faceOwner().size());
+            }
+            reader.endStep();
+            step++;
+        }
+        REQUIRE(step == 3);
+    }
+
+    std::filesystem::remove_all(file);
+}
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+std::string readFile(const std::filesystem::path& file)
+{
+    std::ifstream in(file, std::ios::binary);
+    std::stringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+/* @brief reads the uncompressed appended data of the data array with the given name */
+std::vector<NeoN::scalar> readAppendedArray(const std::string& content, const std::string& name)
+{
+    auto arrayStart = content.find("Name=\"" + name + "\"");
+    auto offsetStart = content.find("offset=\"", arrayStart) + std::strlen("offset=\"");
+    auto offset = std::stoul(content.substr(offsetStart, content.find('"', offsetStart)));
+    auto dataStart = content.find('_', content.find("<AppendedData")) + 1 + offset;
+
+    std::uint64_t nBytes = 0;
+    std::memcpy(&nBytes, content.data() + dataStart, sizeof(nBytes));
+    std::vector<NeoN::scalar> values(nBytes / sizeof(NeoN::scalar));
+    std::memcpy(values.data(), content.data() + dataStart + sizeof(nBytes), nBytes);
+    return values;
+}
+
+TEST_CASE("VtuWriter")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    const NeoN::localIdx nCells = 10;
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+    fvcc::VolumeField<NeoN::scalar> t(
+        exec, "T", mesh, fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::scalar>>(mesh)
+    );
+    fvcc::VolumeField<NeoN::Vec3> u(
+        exec, "U", mesh, fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoN::Vec3>>(mesh)
+    );
+    auto directory = std::filesystem::temp_directory_path() / ("vtuWriter_" + execName);
+    std::filesystem::remove_all(directory);
+
+    SECTION("writes the selected fields of every output time on " + execName)
+    {
+        NeoN::Dictionary dict({{"compression", std::string("none")}});
+        NeoN::io::VtuWriter writer(mesh, directory, "fields", dict);
+        writer.add(t);
+        writer.add(u);
+
+        NeoN::fill(t.internalVector(), 1.0);
+        NeoN::fill(u.internalVector(), NeoN::Vec3(1.0, 2.0, 3.0));
+        writer.write(0.0);
+        // the fields are copied by write, thus later changes are not part of the first output
+        NeoN::fill(t.internalVector(), 2.0);
+        writer.write(0.5);
+        writer.flush();
+
+        REQUIRE(std::filesystem::exists(writer.file(0)));
+        REQUIRE(std::filesystem::exists(writer.file(1)));
+
+        auto collection = readFile(directory / "fields.pvd");
+        REQUIRE(collection.find("timestep=\"0\"") != std::string::npos);
+        REQUIRE(collection.find("timestep=\"0.5\"") != std::string::npos);
+        REQUIRE(collection.find("fields_1.vtu") != std::string::npos);
+
+        auto first = readFile(writer.file(0));
+        REQUIRE(first.find("NumberOfCells=\"10\"") != std::string::npos);
+        REQUIRE(first.find("compressor") == std::string::npos);
+        auto firstT = readAppendedArray(first, "T");
+        REQUIRE(firstT.size() == nCells);
+        REQUIRE(firstT[0] == 1.0);
+        auto firstU = readAppendedArray(first, "U");
+        REQUIRE(firstU.size() == 3 * nCells);
+        REQUIRE(firstU[2] == 3.0);
+
+        auto secondT = readAppendedArray(readFile(writer.file(1)), "T");
+        REQUIRE(secondT[nCells - 1] == 2.0);
+    }
+
+    SECTION("write only blocks if the queue is full on " + execName)
+    {
+        NeoN::Dictionary dict({{"queueSize", NeoN::label(1)}});
+        NeoN::io::VtuWriter writer(mesh, directory, "fields", dict);
+        writer.add(t);
+        for (int i = 0; i < 5; i++)
+        {
+            writer.write(NeoN::scalar(i));
+        }
+        writer.flush();
+        for (size_t i = 0; i < 5; i++)
+        {
+            REQUIRE(std::filesystem::exists(writer.file(i)));
+        }
+        if (writer.compression() == "zlib")
+        {
+            REQUIRE(
+                readFile(writer.file(0)).find("compressor=\"vtkZLibDataCompressor\"")
+                != std::string::npos
+            );
+        }
+    }
+
+    SECTION("unknown compressions are rejected on " + execName)
+    {
+        NeoN::Dictionary dict({{"compression", std::string("unknown")}});
+        REQUIRE_THROWS(NeoN::io::VtuWriter(mesh, directory, "fields", dict));
+    }
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+#include "../mesh/unstructured/periodicMesh.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+TEST_CASE("DistributedLinearSystem")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::localIdx nCells = 10;
+    auto mesh = createPeriodic1DMesh(exec, nCells);
+
+    SECTION("Sparsity pattern of a single part " + execName)
+    {
+        const auto& pattern = NeoN::la::DistributedSparsityPattern::readOrCreate(mesh);
+        REQUIRE(pattern.rowStart() == 0);
+        REQUIRE(pattern.nGlobalRows() == nCells);
+        REQUIRE(pattern.nnz() == 2);
+
+        auto globalColIdxs = pattern.globalColIdxs().copyToHost();
+        REQUIRE(globalColIdxs.view()[0] == nCells - 1);
+        REQUIRE(globalColIdxs.view()[1] == 0);
+
+        auto rowOffs = pattern.rowOffs().copyToHost();
+        REQUIRE(rowOffs.view()[1] == 1);
+        REQUIRE(rowOffs.view()[nCells - 1] == 1);
+        REQUIRE(rowOffs.view()[nCells] == 2);
+    }
+
+    std::vector<fvcc::VolumeBoundary<NeoN::scalar>> bcs;
+    for (NeoN::localIdx patchi = 0; patchi < mesh.nBoundaries(); patchi++)
+    {
+        NeoN::Dictionary dict {{"type", std::string("processor")}, {"neighbourRank", 0}};
+        bcs.emplace_back(mesh, dict, patchi);
+    }
+    fvcc::VolumeField<NeoN::scalar> phi(exec, "phi", mesh, bcs);
+    NeoN::parallelFor(
+        phi.internalVector(), KOKKOS_LAMBDA(const NeoN::localIdx i) { return NeoN::scalar(i); }
+    );
+    phi.correctBoundaryConditions();
+
+    fvcc::SurfaceField<NeoN::scalar> gamma(
+        exec, "gamma", mesh, fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh)
+    );
+    NeoN::fill(gamma.internalVector(), 1.0);
+
+    auto ls = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(
+        mesh, NeoN::la::SparsityPattern::readOrCreate(mesh)
+    );
+    NeoN::dsl::SpatialOperator lapOp = NeoN::dsl::imp::laplacian(gamma, phi);
+    lapOp.read(
+        NeoN::TokenList({std::string("Gauss"), std::string("linear"), std::string("uncorrected")})
+    );
+    lapOp.implicitOperation(ls);
+
+    NeoN::la::DistributedLinearSystem<NeoN::scalar, NeoN::localIdx> dls(mesh, ls);
+
+    SECTION("Moves the processor coupling into the non-local block " + execName)
+    {
+        auto rhs = dls.localSystem().rhs().copyToHost();
+        for (auto value : rhs.view())
+        {
+            REQUIRE(value == Catch::Approx(0.0).margin(1e-12));
+        }
+
+        NeoN::Vector<NeoN::scalar> y(exec, nCells, 0.0);
+        NeoN::la::spmv(dls, phi.internalVector(), y);
+        auto yHost = y.copyToHost();
+        auto nSquared = static_cast<NeoN::scalar>(nCells * nCells);
+        REQUIRE(yHost.view()[0] == Catch::Approx(nSquared));
+        REQUIRE(yHost.view()[nCells - 1] == Catch::Approx(-nSquared));
+        for (NeoN::localIdx celli = 1; celli < nCells - 1; celli++)
+        {
+            REQUIRE(yHost.view()[celli] == Catch::Approx(0.0).margin(1e-10));
+        }
+    }
+
+    SECTION("Residual matches the lagged local system " + execName)
+    {
+        NeoN::Vector<NeoN::scalar> res(exec, nCells, 0.0);
+        NeoN::Vector<NeoN::scalar> localRes(exec, nCells, 0.0);
+        NeoN::la::computeResidual(dls, phi.internalVector(), res);
+        NeoN::la::computeResidual(ls.matrix(), ls.rhs(), phi.internalVector(), localRes);
+
+        auto [resHost, localResHost] = NeoN::copyToHosts(res, localRes);
+        for (NeoN::localIdx celli = 0; celli < nCells; celli++)
+        {
+            REQUIRE(resHost.view()[celli] == Catch::Approx(localResHost.view()[celli]).margin(1e-10));
+        }
+    }
+
+    SECTION("Accumulates the coupling of all operators after a reset " + execName)
+    {
+        fvcc::SurfaceField<NeoN::scalar> faceFlux(
+            exec, "sf", mesh, fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoN::scalar>>(mesh)
+        );
+        NeoN::fill(faceFlux.internalVector(), 1.0);
+        NeoN::dsl::SpatialOperator divOp = NeoN::dsl::imp::div(faceFlux, phi);
+        divOp.read(NeoN::TokenList({std::string("Gauss"), std::string("linear")}));
+
+        auto divLs = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(
+            mesh, NeoN::la::SparsityPattern::readOrCreate(mesh)
+        );
+        divOp.implicitOperation(divLs);
+
+        // assembling twice must not accumulate across the reset
+        auto sumLs = NeoN::la::createEmptyLinearSystem<NeoN::scalar, NeoN::localIdx>(
+            mesh, NeoN::la::SparsityPattern::readOrCreate(mesh)
+        );
+        for (int step = 0; step < 2; step++)
+        {
+            sumLs.reset();
+            lapOp.implicitOperation(sumLs);
+            divOp.implicitOperation(sumLs);
+        }
+
+        using BoundaryCoefficients = NeoN::la::BoundaryCoefficients<NeoN::scalar, NeoN::localIdx>;
+        auto coeffs = [](const NeoN::la::LinearSystem<NeoN::scalar, NeoN::localIdx>& system)
+        {
+            const auto& bcCoeffs = system.auxiliaryCoefficients().get<BoundaryCoefficients>(
+                "boundaryCoefficients"
+            );
+            return NeoN::copyToHosts(bcCoeffs.matrixValues, bcCoeffs.rhsValues);
+        };
+        auto [lapMat, lapRhs] = coeffs(ls);
+        auto [divMat, divRhs] = coeffs(divLs);
+        auto [sumMat, sumRhs] = coeffs(sumLs);
+        for (NeoN::localIdx bfacei = 0; bfacei < mesh.nBoundaryFaces(); bfacei++)
+        {
+            REQUIRE(divMat.view()[bfacei] != Catch::Approx(0.0).margin(1e-12));
+            REQUIRE(
+                sumMat.view()[bfacei]
+                == Catch::Approx(lapMat.view()[bfacei] + divMat.view()[bfacei])
+            );
+            REQUIRE(
+                sumRhs.view()[bfacei]
+                == Catch::Approx(lapRhs.view()[bfacei] + divRhs.view()[bfacei])
+            );
+        }
+    }
+}
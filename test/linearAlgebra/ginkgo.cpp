@@ -5,6 +5,7 @@
 #include "catch2_common.hpp"
 
 #include "NeoN/NeoN.hpp"
+#include "../mesh/unstructured/periodicMesh.hpp"
 
 
 #if NF_WITH_GINKGO
@@ -177,4 +178,88 @@ TEST_CASE("MatrixAssembly - Ginkgo")
         REQUIRE(finalResNorm < 1.0e-04);
     }
 }
+
+TEST_CASE("DistributedLinearSystem - Ginkgo")
+{
+    namespace fvcc = NeoN::finiteVolume::cellCentred;
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    localIdx nCells = 10;
+    auto mesh = createPeriodic1DMesh(exec, nCells);
+
+    std::vector<fvcc::VolumeBoundary<scalar>> bcs;
+    for (localIdx patchi = 0; patchi < mesh.nBoundaries(); patchi++)
+    {
+        Dictionary dict {{"type", std::string("processor")}, {"neighbourRank", 0}};
+        bcs.emplace_back(mesh, dict, patchi);
+    }
+    fvcc::VolumeField<scalar> phi(exec, "phi", mesh, bcs);
+    NeoN::fill(phi.internalVector(), 0.0);
+    phi.correctBoundaryConditions();
+    fvcc::SurfaceField<scalar> gamma(
+        exec, "gamma", mesh, fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<scalar>>(mesh)
+    );
+    NeoN::fill(gamma.internalVector(), 1.0);
+
+    // the periodic laplacian is singular, the shifted system laplacian - I is not
+    const auto& sp = NeoN::la::SparsityPattern::readOrCreate(mesh);
+    auto ls = NeoN::la::createEmptyLinearSystem<scalar, localIdx>(mesh, sp);
+    NeoN::dsl::SpatialOperator lapOp = NeoN::dsl::imp::laplacian(gamma, phi);
+    lapOp.read(
+        NeoN::TokenList({std::string("Gauss"), std::string("linear"), std::string("uncorrected")})
+    );
+    lapOp.implicitOperation(ls);
+    auto [values, rowOffs, diagOffs] =
+        NeoN::views(ls.matrix().values(), sp.rowOffs(), sp.diagOffset());
+    NeoN::parallelFor(
+        exec,
+        {0, nCells},
+        KOKKOS_LAMBDA(const localIdx celli) { values[rowOffs[celli] + diagOffs[celli]] -= 1.0; },
+        "shiftDiagonal"
+    );
+    NeoN::fill(ls.rhs(), -1.0);
+
+    NeoN::la::DistributedLinearSystem<scalar, localIdx> dls(mesh, ls);
+
+    SECTION("Solve distributed linear system " + execName)
+    {
+        Dictionary solverDict {
+            {{"solver", std::string {"Ginkgo"}},
+             {"type", "solver::Bicgstab"},
+             {"criteria", Dictionary {{{"iteration", 50}, {"relative_residual_norm", 1e-12}}}}}
+        };
+        auto solver = NeoN::la::Solver(exec, solverDict);
+        Vector<scalar> x(exec, nCells, 0.0);
+        auto [numIter, initResNorm, finalResNorm, solveTime] = solver.solve(dls, x);
+
+        // the rows of the laplacian sum to zero, thus the solution is one
+        auto hostX = x.copyToHost();
+        for (auto value : hostX.view())
+        {
+            REQUIRE(value == Catch::Approx(1.0).margin(1e-8));
+        }
+        REQUIRE(initResNorm == Catch::Approx(std::sqrt(static_cast<scalar>(nCells))));
+
+        Vector<scalar> res(exec, nCells, 0.0);
+        NeoN::la::computeResidual(dls, x, res);
+        auto hostRes = res.copyToHost();
+        for (auto value : hostRes.view())
+        {
+            REQUIRE(value == Catch::Approx(0.0).margin(1e-8));
+        }
+
+        // the cached global matrix structure refreshes the values of the next solve, a stale
+        // matrix would double the solution
+        dls.localSystem().matrix().values() *= 2.0;
+        dls.nonLocalMatrix().values() *= 2.0;
+        dls.localSystem().rhs() *= 2.0;
+        NeoN::fill(x, 0.0);
+        solver.solve(dls, x);
+        hostX = x.copyToHost();
+        for (auto value : hostX.view())
+        {
+            REQUIRE(value == Catch::Approx(1.0).margin(1e-8));
+        }
+    }
+}
 #endif
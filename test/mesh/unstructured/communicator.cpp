@@ -13,51 +13,78 @@ using namespace NeoN;
 
 TEST_CASE("Communicator Vector Synchronization")
 {
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto space = GENERATE(mpi::BufferSpace::Host, mpi::BufferSpace::Device);
+
     mpi::MPIEnvironment mpiEnviron;
-    Communicator comm;
+    auto sizeRank = static_cast<localIdx>(mpiEnviron.sizeRank());
 
     // first block send (size rank)
     // second block remains the same
     // third block receive (size rank)
-    Vector<int> field(SerialExecutor(), 3 * mpiEnviron.sizeRank());
+    Vector<int> hostField(SerialExecutor(), 3 * sizeRank);
+    auto hostView = hostField.view();
 
-    for (size_t rank = 0; rank < mpiEnviron.sizeRank(); rank++)
+    for (localIdx rank = 0; rank < sizeRank; rank++)
     {
         // we send the rank numbers
-        field(rank) = static_cast<int>(rank);
+        hostView[rank] = static_cast<int>(rank);
 
         // just make sure its not a communicated value.
-        field(rank + mpiEnviron.sizeRank()) = static_cast<int>(mpiEnviron.sizeRank() + rank);
+        hostView[rank + sizeRank] = static_cast<int>(sizeRank + rank);
 
         // set to 0.0 to check if the value is communicated
-        field(rank + 2 * mpiEnviron.sizeRank()) = 0;
+        hostView[rank + 2 * sizeRank] = 0;
     }
+    auto field = hostField.copyToExecutor(exec);
 
     // Set up buffer to local map, we will ignore global_idx
     CommMap rankSendMap(mpiEnviron.sizeRank());
     CommMap rankReceiveMap(mpiEnviron.sizeRank());
-    for (size_t rank = 0; rank < mpiEnviron.sizeRank(); rank++)
+    for (localIdx rank = 0; rank < sizeRank; rank++)
     {
         rankSendMap[rank].emplace_back(NodeCommMap {.local_idx = static_cast<label>(rank)});
-        NodeCommMap newNode({.local_idx = static_cast<label>(2 * mpiEnviron.sizeRank() + rank)});
+        NodeCommMap newNode({.local_idx = static_cast<label>(2 * sizeRank + rank)});
         rankReceiveMap[rank].push_back(newNode); // got tired of fighting with clang-format.
     }
 
-    // Communicate
-    comm = Communicator(mpiEnviron, rankSendMap, rankReceiveMap);
-    std::string loc = "foo";
-    // std::source_location::current().file_name() + std::source_location::current().line();
-    comm.startComm(field, loc);
-    comm.isComplete(loc); // just call it to make sure it doesn't crash
-    comm.finaliseComm(field, loc);
+    SECTION("Exchanges values with all ranks " + execName)
+    {
+        // Communicate
+        Communicator comm(mpiEnviron, exec, rankSendMap, rankReceiveMap, space);
+        std::string loc = "foo";
+        // std::source_location::current().file_name() + std::source_location::current().line();
+        comm.startComm(field, loc);
+        comm.isComplete(loc); // just call it to make sure it doesn't crash
+        comm.finaliseComm(field, loc);
 
-    // Check the values
-    for (size_t rank = 0; rank < mpiEnviron.sizeRank(); rank++)
+        // Check the values
+        auto resultField = field.copyToHost();
+        auto result = resultField.view();
+        for (localIdx rank = 0; rank < sizeRank; rank++)
+        {
+            REQUIRE(result[rank] == static_cast<int>(rank));
+            REQUIRE(result[rank + sizeRank] == static_cast<int>(sizeRank + rank));
+            REQUIRE(result[rank + 2 * sizeRank] == static_cast<int>(mpiEnviron.rank()));
+        }
+    }
+
+    SECTION("Reuses buffers for repeated exchanges " + execName)
     {
-        REQUIRE(field(rank) == static_cast<int>(rank));
-        REQUIRE(
-            field(rank + mpiEnviron.sizeRank()) == static_cast<int>(mpiEnviron.sizeRank() + rank)
-        );
-        REQUIRE(field(rank + 2 * mpiEnviron.sizeRank()) == static_cast<int>(mpiEnviron.rank()));
+        Communicator comm(mpiEnviron, exec, rankSendMap, rankReceiveMap, space);
+        for (int i = 0; i < 3; i++)
+        {
+            comm.startComm(field, "first");
+            comm.startComm(field, "second");
+            comm.finaliseComm(field, "second");
+            comm.finaliseComm(field, "first");
+        }
+
+        auto resultField = field.copyToHost();
+        auto result = resultField.view();
+        for (localIdx rank = 0; rank < sizeRank; rank++)
+        {
+            REQUIRE(result[rank + 2 * sizeRank] == static_cast<int>(mpiEnviron.rank()));
+        }
     }
 }
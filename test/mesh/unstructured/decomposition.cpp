@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+TEST_CASE("Partitioner")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto method = GENERATE(std::string("RCB"), std::string("inertial"), std::string("multilevel"));
+
+    NeoN::localIdx nCells = 16;
+    NeoN::label nParts = 4;
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+
+    SECTION("Can partition a 1D mesh with " + method + " " + execName)
+    {
+        auto partitioner = NeoN::Partitioner::create(NeoN::Dictionary {{"method", method}});
+        auto cellToPart = partitioner->partition(mesh, nParts);
+
+        REQUIRE(cellToPart.size() == static_cast<size_t>(nCells));
+
+        // a line of cells is optimally split into contiguous chunks, i.e. nParts non-empty parts
+        // with nParts - 1 cut faces
+        auto stats = NeoN::computePartitionStats(mesh, cellToPart, nParts);
+        REQUIRE(stats.nParts == nParts);
+        REQUIRE(stats.edgeCut == nParts - 1);
+        REQUIRE(stats.loadImbalance == Catch::Approx(1.0));
+        for (auto load : stats.loads)
+        {
+            REQUIRE(load == nCells / nParts);
+        }
+    }
+}
+
+TEST_CASE("decomposeMesh")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::localIdx nCells = 16;
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+
+    SECTION("Can compute partition statistics " + execName)
+    {
+        // alternating parts cut every internal face
+        std::vector<NeoN::label> cellToPart(nCells);
+        for (NeoN::localIdx celli = 0; celli < nCells; celli++)
+        {
+            cellToPart[celli] = celli % 2;
+        }
+        auto stats = NeoN::computePartitionStats(mesh, cellToPart, 2);
+        REQUIRE(stats.edgeCut == nCells - 1);
+        REQUIRE(stats.loads[0] == 8);
+        REQUIRE(stats.loads[1] == 8);
+        REQUIRE(stats.cuts[0] == nCells - 1);
+        REQUIRE(stats.cuts[1] == nCells - 1);
+    }
+
+    SECTION("Can decompose a 1D mesh into two parts " + execName)
+    {
+        auto parts = NeoN::decomposeMesh(
+            mesh, NeoN::Dictionary {{"method", std::string("RCB")}, {"nParts", NeoN::label(2)}}
+        );
+        REQUIRE(parts.size() == 2);
+
+        // |_0 part 0 |_7 part 1 |_1
+        for (const auto& part : parts)
+        {
+            const auto& partMesh = part.mesh;
+            REQUIRE(partMesh.nCells() == 8);
+            REQUIRE(partMesh.nInternalFaces() == 7);
+            REQUIRE(partMesh.nBoundaryFaces() == 2);
+            REQUIRE(partMesh.nBoundaries() == 3);
+            REQUIRE(partMesh.nFaces() == 9);
+            REQUIRE(part.nPhysicalBoundaries == 2);
+            REQUIRE(part.neighbourParts.size() == 1);
+            REQUIRE(part.neighbourParts[0] == 1 - part.part);
+            REQUIRE(part.faceMap.back() == 7);
+
+            // the processor patch is the last patch
+            const auto& offset = partMesh.boundaryMesh().offset();
+            REQUIRE(offset.back() - offset[offset.size() - 2] == 1);
+
+            auto deltaCoeffs = partMesh.boundaryMesh().deltaCoeffs().copyToHost();
+            REQUIRE(deltaCoeffs.view()[1] == Catch::Approx(nCells));
+            auto volumes = partMesh.cellVolumes().copyToHost();
+            NeoN::scalar sumVolumes = 0;
+            for (auto vol : volumes.view())
+            {
+                sumVolumes += vol;
+            }
+            REQUIRE(sumVolumes == Catch::Approx(0.5));
+        }
+
+        const auto& part0 = parts[0];
+        REQUIRE(part0.cellMap.front() == 0);
+        REQUIRE(part0.mesh.boundaryMesh().offset() == std::vector<NeoN::localIdx> {0, 1, 1, 2});
+        REQUIRE(part0.sendMap[1].size() == 1);
+        REQUIRE(part0.sendMap[1][0].local_idx == 7);
+        REQUIRE(part0.receiveMap[1][0].local_idx == 1);
+        REQUIRE(part0.sendMap[0].empty());
+
+        const auto& part1 = parts[1];
+        REQUIRE(part1.cellMap.front() == 8);
+        REQUIRE(part1.mesh.boundaryMesh().offset() == std::vector<NeoN::localIdx> {0, 0, 1, 2});
+        REQUIRE(part1.sendMap[0][0].local_idx == 0);
+        REQUIRE(part1.receiveMap[0][0].local_idx == 1);
+
+        // the processor face points out of the part
+        auto sf0 = part0.mesh.boundaryMesh().sf().copyToHost();
+        auto sf1 = part1.mesh.boundaryMesh().sf().copyToHost();
+        REQUIRE(sf0.view()[1][0] == Catch::Approx(1.0));
+        REQUIRE(sf1.view()[1][0] == Catch::Approx(-1.0));
+    }
+}
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "NeoN/NeoN.hpp"
+
+/* @brief a periodic 1D mesh, where both end faces are processor faces coupling the rank with itself
+ */
+inline NeoN::UnstructuredMesh
+createPeriodic1DMesh(const NeoN::Executor& exec, NeoN::localIdx nCells)
+{
+    auto mesh = NeoN::create1DUniformMesh(exec, nCells);
+    const auto& bMesh = mesh.boundaryMesh();
+    NeoN::scalar dx = 1.0 / static_cast<NeoN::scalar>(nCells);
+    NeoN::BoundaryMesh periodicBMesh(
+        exec,
+        bMesh.faceCells(),
+        bMesh.cf(),
+        bMesh.cn(),
+        bMesh.sf(),
+        bMesh.magSf(),
+        bMesh.nf(),
+        {exec, {{-dx, 0.0, 0.0}, {dx, 0.0, 0.0}}},
+        {exec, {0.5, 0.5}},
+        {exec, {1.0 / dx, 1.0 / dx}},
+        bMesh.offset()
+    );
+    NeoN::UnstructuredMesh periodicMesh(
+        mesh.points(),
+        mesh.cellVolumes(),
+        mesh.cellCentres(),
+        mesh.faceAreas(),
+        mesh.faceCentres(),
+        mesh.magFaceAreas(),
+        mesh.faceOwner(),
+        mesh.faceNeighbour(),
+        mesh.nCells(),
+        mesh.nInternalFaces(),
+        mesh.nBoundaryFaces(),
+        mesh.nBoundaries(),
+        mesh.nFaces(),
+        periodicBMesh
+    );
+
+    // the left face receives the last cell and the right face the first cell
+    NeoN::CommMap sendMap {{{nCells - 1}, {0}}};
+    NeoN::CommMap receiveMap {{{0}, {1}}};
+    auto procInterface =
+        std::make_shared<NeoN::ProcessorInterface>(periodicMesh, 0, sendMap, receiveMap);
+    NeoN::ProcessorInterface::attach(periodicMesh, procInterface);
+    return periodicMesh;
+}
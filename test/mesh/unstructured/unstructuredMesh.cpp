@@ -78,4 +78,52 @@ TEST_CASE("Unstructured Mesh")
         REQUIRE(hostBoundaryDelta.view()[0][0] == -0.125);
         REQUIRE(hostBoundaryDelta.view()[1][0] == 0.125);
     }
+
+    SECTION("Can create a 3D uniform mesh " + execName)
+    {
+        NeoN::UnstructuredMesh mesh = NeoN::create3DUniformMesh(exec, 2, 3, 4);
+
+        REQUIRE(mesh.nCells() == 24);
+        REQUIRE(mesh.nInternalFaces() == 12 + 16 + 18);
+        REQUIRE(mesh.nBoundaryFaces() == 2 * (12 + 8 + 6));
+        REQUIRE(mesh.nBoundaries() == 6);
+        REQUIRE(mesh.nFaces() == mesh.nInternalFaces() + mesh.nBoundaryFaces());
+        REQUIRE(mesh.points().size() == 3 * 4 * 5);
+        REQUIRE(
+            mesh.boundaryMesh().offset() == std::vector<NeoN::localIdx> {0, 12, 24, 32, 40, 46, 52}
+        );
+
+        auto hostCellCentres = mesh.cellCentres().copyToHost();
+        REQUIRE(hostCellCentres.view()[0] == NeoN::Vec3(0.25, 1.0 / 6.0, 0.125));
+        REQUIRE(hostCellCentres.view()[23][0] == 0.75);
+        REQUIRE(hostCellCentres.view()[23][1] == Catch::Approx(5.0 / 6.0));
+        REQUIRE(hostCellCentres.view()[23][2] == 0.875);
+
+        // the internal faces of the first cell in x, y and z direction
+        auto hostFaceOwner = mesh.faceOwner().copyToHost();
+        auto hostFaceNeighbour = mesh.faceNeighbour().copyToHost();
+        REQUIRE(hostFaceOwner.view()[0] == 0);
+        REQUIRE(hostFaceNeighbour.view()[0] == 1);
+        REQUIRE(hostFaceOwner.view()[1] == 0);
+        REQUIRE(hostFaceNeighbour.view()[1] == 2);
+        REQUIRE(hostFaceOwner.view()[2] == 0);
+        REQUIRE(hostFaceNeighbour.view()[2] == 6);
+
+        // the face area vectors of every cell sum up to zero
+        auto hostFaceAreas = mesh.faceAreas().copyToHost();
+        std::vector<NeoN::Vec3> sumSf(24, NeoN::Vec3(0.0, 0.0, 0.0));
+        for (NeoN::localIdx facei = 0; facei < mesh.nFaces(); facei++)
+        {
+            sumSf[static_cast<size_t>(hostFaceOwner.view()[facei])] += hostFaceAreas.view()[facei];
+            if (facei < mesh.nInternalFaces())
+            {
+                sumSf[static_cast<size_t>(hostFaceNeighbour.view()[facei])] -=
+                    hostFaceAreas.view()[facei];
+            }
+        }
+        for (const auto& sf : sumSf)
+        {
+            REQUIRE(NeoN::mag(sf) < 1e-14);
+        }
+    }
 }
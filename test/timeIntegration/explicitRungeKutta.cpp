@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+#include <string>
+
+#include "../dsl/common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using TemporalOperator = NeoN::dsl::TemporalOperator<NeoN::scalar>;
+
+// only for msvc
+template class NeoN::timeIntegration::LowStorageRungeKutta<VolumeField>;
+template class NeoN::timeIntegration::SSPRungeKutta<VolumeField>;
+
+TEST_CASE("TimeIntegration - native explicit Runge Kutta")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto [type, method, expectedOrder] = GENERATE(
+        std::tuple<std::string, std::string, NeoN::scalar> {
+            "lowStorageRungeKutta", "Williamson-3", 3.0
+        },
+        std::tuple<std::string, std::string, NeoN::scalar> {
+            "lowStorageRungeKutta", "Carpenter-Kennedy-4", 4.0
+        },
+        std::tuple<std::string, std::string, NeoN::scalar> {"SSPRungeKutta", "SSP-2", 2.0},
+        std::tuple<std::string, std::string, NeoN::scalar> {"SSPRungeKutta", "SSP-3", 3.0}
+    );
+
+    NeoN::Database db;
+    NeoN::Dictionary fvSchemes;
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", type);
+    ddtSchemes.insert("Runge-Kutta-Method", method);
+    fvSchemes.insert("ddtSchemes", ddtSchemes);
+    NeoN::Dictionary fvSolution;
+
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+    fvcc::VolumeField<NeoN::scalar>& vf =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .timeIndex = 1}
+        );
+
+    const NeoN::scalar maxTime = 0.1;
+    const NeoN::scalar initialValue = 1.0;
+    std::array<int, 2> nSteps = {10, 20};
+
+    SECTION("Solve " + method + " on " + execName)
+    {
+        std::array<NeoN::scalar, 2> error;
+        for (std::size_t iTest = 0; iTest < nSteps.size(); iTest++)
+        {
+            auto& vfOld = fvcc::oldTime(vf);
+            vf.internalVector() = initialValue;
+            vfOld.internalVector() = initialValue;
+
+            // the stages are evaluated in vf, thus the operator is created from vf
+            TemporalOperator ddtOp = NeoN::dsl::imp::ddt(vf);
+            auto eqn = ddtOp + YSquared(vf, Coeff(-1.0));
+
+            NeoN::scalar dt = maxTime / nSteps[iTest];
+            for (int step = 0; step < nSteps[iTest]; step++)
+            {
+                NeoN::dsl::solve(eqn, vf, step * dt, dt, fvSchemes, fvSolution);
+            }
+
+            NeoN::scalar analytical = 1.0 / (initialValue - maxTime);
+            auto vfHost = vf.internalVector().copyToHost();
+            error[iTest] = std::abs(vfHost.view()[0] - analytical);
+        }
+
+        NeoN::scalar order = std::log(error[0] / error[1]) / std::log(2.0);
+        REQUIRE(order > expectedOrder - 0.1);
+    }
+}
+
+TEST_CASE("TimeIntegration - SSP Runge Kutta error estimate")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto [method, embeddedOrder] = GENERATE(
+        std::tuple<std::string, int> {"SSP-2", 1}, std::tuple<std::string, int> {"SSP-3", 2}
+    );
+
+    NeoN::Database db;
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", std::string("SSPRungeKutta"));
+    ddtSchemes.insert("Runge-Kutta-Method", method);
+    ddtSchemes.insert("absTol", 1.0e-6);
+    NeoN::Dictionary fvSolution;
+
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+    fvcc::VolumeField<NeoN::scalar>& vf =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .timeIndex = 1}
+        );
+
+    SECTION("Estimates the local error of " + method + " on " + execName)
+    {
+        NeoN::timeIntegration::TimeIntegration<fvcc::VolumeField<NeoN::scalar>> integrator(
+            ddtSchemes, fvSolution
+        );
+        REQUIRE(!integrator.errorEstimate());
+
+        TemporalOperator ddtOp = NeoN::dsl::imp::ddt(vf);
+        auto eqn = ddtOp + YSquared(vf, Coeff(-1.0));
+
+        // the local error of the embedded method scales with dt^(p + 1)
+        std::array<NeoN::scalar, 2> errorNorm;
+        std::array<NeoN::scalar, 2> dt = {0.02, 0.01};
+        for (std::size_t iTest = 0; iTest < dt.size(); iTest++)
+        {
+            // the integrator starts from the field, which is advanced to the old time field
+            vf.internalVector() = 1.0;
+            integrator.solve(eqn, vf, 0.0, dt[iTest]);
+            auto error = integrator.errorEstimate();
+            REQUIRE(error);
+            REQUIRE(error->order == embeddedOrder);
+            errorNorm[iTest] = error->norm;
+        }
+
+        NeoN::scalar order = std::log(errorNorm[0] / errorNorm[1]) / std::log(2.0) - 1.0;
+        REQUIRE(order > embeddedOrder - 0.1);
+    }
+}
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+#include <string>
+
+#include "../dsl/common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using TemporalOperator = NeoN::dsl::TemporalOperator<NeoN::scalar>;
+
+// only for msvc
+template class NeoN::timeIntegration::ImplicitRungeKutta<VolumeField>;
+template class NeoN::timeIntegration::BDF<VolumeField>;
+
+/* @brief solves ddt(y) = -k y - c y^2, with the linear part treated implicitly */
+NeoN::scalar solveDecay(
+    const NeoN::Executor& exec,
+    const NeoN::Dictionary& ddtSchemes,
+    bool withExplicitPart,
+    int nSteps,
+    NeoN::scalar maxTime
+)
+{
+    const NeoN::scalar k = 10.0;
+    const NeoN::scalar initialValue = 1.0;
+
+    NeoN::Database db;
+    NeoN::Dictionary fvSchemes;
+    fvSchemes.insert("ddtSchemes", ddtSchemes);
+    NeoN::Dictionary fvSolution {
+        {{"solver", std::string("Ginkgo")},
+         {"type", std::string("solver::Cg")},
+         {"criteria", NeoN::Dictionary {{{"iteration", 50}, {"relative_residual_norm", 1e-14}}}}}
+    };
+
+    auto mesh = NeoN::create1DUniformMesh(exec, 4);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+    fvcc::VolumeField<NeoN::scalar>& vf =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .timeIndex = 1}
+        );
+    fvcc::VolumeField<NeoN::scalar>& coeff =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "coeff", .mesh = mesh, .value = k}
+        );
+    vf.internalVector() = initialValue;
+    fvcc::oldTime(vf).internalVector() = initialValue;
+
+    // the stages are evaluated in vf, thus the operators are created from vf
+    TemporalOperator ddtOp = NeoN::dsl::imp::ddt(vf);
+    auto eqn = ddtOp + NeoN::dsl::imp::source(coeff, vf);
+    if (withExplicitPart)
+    {
+        eqn.addOperator(NeoN::dsl::SpatialOperator<NeoN::scalar>(YSquared(vf)));
+    }
+
+    NeoN::scalar dt = maxTime / nSteps;
+    for (int step = 0; step < nSteps; step++)
+    {
+        NeoN::dsl::solve(eqn, vf, step * dt, dt, fvSchemes, fvSolution);
+    }
+
+    // y(t) = k / ((k / y0 + 1) exp(k t) - 1) with the quadratic term, y0 exp(-k t) without
+    NeoN::scalar analytical =
+        withExplicitPart
+            ? k / ((k / initialValue + 1.0) * std::exp(k * maxTime) - 1.0)
+            : initialValue * std::exp(-k * maxTime);
+    auto vfHost = vf.internalVector().copyToHost();
+    NeoN::scalar error = 0.0;
+    for (auto value : vfHost.view())
+    {
+        error = std::max(error, std::abs(value - analytical));
+    }
+    return error;
+}
+
+TEST_CASE("TimeIntegration - implicit and IMEX Runge Kutta")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+    auto [method, withExplicitPart, expectedOrder] = GENERATE(
+        std::tuple<std::string, bool, NeoN::scalar> {"SDIRK-2", false, 2.0},
+        std::tuple<std::string, bool, NeoN::scalar> {"ARK-2", false, 2.0},
+        std::tuple<std::string, bool, NeoN::scalar> {"ARK-2", true, 2.0}
+    );
+
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", std::string("Implicit-Runge-Kutta"));
+    ddtSchemes.insert("Runge-Kutta-Method", method);
+
+    std::string split = withExplicitPart ? " with explicit part" : "";
+    SECTION("Solve " + method + split + " on " + execName)
+    {
+        std::array<int, 2> nSteps = {20, 40};
+        std::array<NeoN::scalar, 2> error;
+        for (std::size_t iTest = 0; iTest < nSteps.size(); iTest++)
+        {
+            error[iTest] = solveDecay(exec, ddtSchemes, withExplicitPart, nSteps[iTest], 0.1);
+        }
+
+        NeoN::scalar order = std::log(error[0] / error[1]) / std::log(2.0);
+        REQUIRE(order > expectedOrder - 0.1);
+    }
+}
+
+TEST_CASE("TimeIntegration - BDF")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", std::string("BDF"));
+    ddtSchemes.insert("relTol", 1.0e-8);
+    ddtSchemes.insert("absTol", 1.0e-10);
+
+    SECTION("Solve stiff decay on " + execName)
+    {
+        // steps far beyond the explicit stability limit dt < 2 / k
+        REQUIRE(solveDecay(exec, ddtSchemes, false, 4, 1.0) < 1.0e-3);
+        REQUIRE(solveDecay(exec, ddtSchemes, true, 4, 1.0) < 1.0e-3);
+    }
+}
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+#include <string>
+
+#include "../dsl/common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+using TemporalOperator = NeoN::dsl::TemporalOperator<NeoN::scalar>;
+
+// only for msvc
+template class NeoN::timeIntegration::Parareal<VolumeField>;
+template class NeoN::timeIntegration::ForwardEuler<VolumeField>;
+template class NeoN::timeIntegration::SSPRungeKutta<VolumeField>;
+
+NeoN::scalar hostValue(const NeoN::Vector<NeoN::scalar>& vector)
+{
+    auto vectorHost = vector.copyToHost();
+    return vectorHost.view()[0];
+}
+
+TEST_CASE("TimeIntegration - Parareal")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::Database db;
+    auto mesh = NeoN::createSingleCellMesh(exec);
+    fvcc::VectorCollection& fieldCollection =
+        fvcc::VectorCollection::instance(db, "fieldCollection");
+    fvcc::VolumeField<NeoN::scalar>& vf =
+        fieldCollection.registerVector<fvcc::VolumeField<NeoN::scalar>>(
+            CreateVector {.name = "vf", .mesh = mesh, .timeIndex = 1}
+        );
+
+    NeoN::Dictionary coarse;
+    coarse.insert("type", std::string("forwardEuler"));
+    NeoN::Dictionary fine;
+    fine.insert("type", std::string("SSPRungeKutta"));
+    fine.insert("Runge-Kutta-Method", std::string("SSP-3"));
+    NeoN::Dictionary pararealDict;
+    pararealDict.insert("coarse", coarse);
+    pararealDict.insert("fine", fine);
+    pararealDict.insert("nSlices", 8);
+    pararealDict.insert("nFineSteps", 10);
+    NeoN::Dictionary fvSolution;
+
+    // ddt(y) = -y^2, y(t) = 1 / (1 + t) for y(0) = 1
+    TemporalOperator ddtOp = NeoN::dsl::imp::ddt(vf);
+    auto eqn = ddtOp + YSquared(vf);
+    const NeoN::scalar tEnd = 1.0;
+
+    // serial fine reference
+    vf.internalVector() = 1.0;
+    NeoN::timeIntegration::TimeIntegration<fvcc::VolumeField<NeoN::scalar>> fineIntegrator(
+        fine, fvSolution
+    );
+    const NeoN::scalar dt = tEnd / 80;
+    for (int step = 0; step < 80; step++)
+    {
+        fineIntegrator.solve(eqn, vf, step * dt, dt);
+    }
+    const NeoN::scalar reference = hostValue(vf.internalVector());
+    REQUIRE(reference == Catch::Approx(0.5).margin(1e-6));
+
+    SECTION("Converges to the serial fine solution on " + execName)
+    {
+        pararealDict.insert("tolerance", 1.0e-10);
+        NeoN::timeIntegration::Parareal<fvcc::VolumeField<NeoN::scalar>> parareal(
+            pararealDict, fvSolution
+        );
+
+        vf.internalVector() = 1.0;
+        auto stats = parareal.solve(eqn, vf, 0.0, tEnd);
+
+        REQUIRE(stats.converged);
+        REQUIRE(stats.nIterations < 8);
+        REQUIRE(stats.residuals.size() == static_cast<std::size_t>(stats.nIterations));
+        REQUIRE(stats.residuals.back() < 1.0e-10);
+        REQUIRE(stats.residuals.back() < stats.residuals.front());
+        REQUIRE(stats.speedUp > 0.0);
+        REQUIRE(hostValue(vf.internalVector()) == Catch::Approx(reference).margin(1e-10));
+        REQUIRE(
+            hostValue(fvcc::oldTime(vf).internalVector()) == Catch::Approx(reference).margin(1e-10)
+        );
+    }
+
+    SECTION("Is exact after nSlices iterations on " + execName)
+    {
+        pararealDict.insert("tolerance", 0.0);
+        NeoN::timeIntegration::Parareal<fvcc::VolumeField<NeoN::scalar>> parareal(
+            pararealDict, fvSolution
+        );
+
+        vf.internalVector() = 1.0;
+        auto stats = parareal.solve(eqn, vf, 0.0, tEnd);
+
+        REQUIRE(stats.nIterations == 8);
+        REQUIRE(hostValue(vf.internalVector()) == Catch::Approx(reference).margin(1e-14));
+    }
+}
@@ -27,31 +27,6 @@ using Ddt = NeoN::dsl::temporal::Ddt<VolumeField>;
 // only for msvc
 template class NeoN::timeIntegration::RungeKutta<VolumeField>;
 
-class YSquared : public OperatorMixin
-{
-
-public:
-
-    using VectorValueType = NeoN::scalar;
-
-    YSquared(VolumeField& field)
-        : OperatorMixin(field.exec(), dsl::Coeff(1.0), field, Operator::Type::Explicit)
-    {}
-
-    void explicitOperation(Vector& source) const
-    {
-        auto sourceView = source.view();
-        auto fieldData = field_.internalVector().data();
-        NeoN::parallelFor(
-            source.exec(),
-            source.range(),
-            KOKKOS_LAMBDA(const localIdx i) { sourceView[i] -= fieldData[i] * fieldData[i]; }
-        );
-    }
-
-    std::string getName() const { return "YSquared"; }
-};
-
 TEST_CASE("TimeIntegration - Runge Kutta")
 {
     auto [execName, exec] = GENERATE(allAvailableExecutor());
@@ -95,7 +70,7 @@ TEST_CASE("TimeIntegration - Runge Kutta")
             // Set expression
             TemporalOperator ddtOp = NeoN::dsl::imp::ddt(vfOld);
 
-            auto divOp = YSquared(vfOld);
+            auto divOp = YSquared(vfOld, Coeff(-1.0));
             auto eqn = ddtOp + divOp;
 
             // solve.
@@ -117,4 +92,36 @@ TEST_CASE("TimeIntegration - Runge Kutta")
                            / (std::log(deltaTime[0]) - std::log(deltaTime[1]));
         REQUIRE(order > (1.0 - convergenceTolerance));
     }
+
+    SECTION("Solve multi-stage method on " + execName)
+    {
+        ddtSchemes.insert("Runge-Kutta-Method", std::string("Heun"));
+        fvSchemes.insert("ddtSchemes", ddtSchemes);
+
+        std::array<int, 2> nSteps = {10, 20};
+        std::array<NeoN::scalar, 2> error;
+        for (std::size_t iTest = 0; iTest < nSteps.size(); iTest++)
+        {
+            auto& vfOld = fvcc::oldTime(vf);
+            vf.internalVector() = initialValue;
+            vfOld.internalVector() = initialValue;
+
+            // the stages are evaluated in vf, thus the operator is created from vf
+            TemporalOperator ddtOp = NeoN::dsl::imp::ddt(vf);
+            auto eqn = ddtOp + YSquared(vf, Coeff(-1.0));
+
+            NeoN::scalar dt = maxTime / nSteps[iTest];
+            for (int step = 0; step < nSteps[iTest]; step++)
+            {
+                NeoN::dsl::solve(eqn, vf, step * dt, dt, fvSchemes, fvSolution);
+            }
+
+            NeoN::scalar analytical = 1.0 / (initialValue - maxTime);
+            auto vfHost = vf.internalVector().copyToHost();
+            error[iTest] = std::abs(vfHost.view()[0] - analytical);
+        }
+
+        NeoN::scalar order = std::log(error[0] / error[1]) / std::log(2.0);
+        REQUIRE(order > (2.0 - 0.1));
+    }
 }
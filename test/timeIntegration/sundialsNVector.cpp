@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+TEST_CASE("Sundials N_Vector")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    std::shared_ptr<SUNContext> context(new SUNContext(), NeoN::sundials::SUN_CONTEXT_DELETER);
+    REQUIRE(SUNContext_Create(SUN_COMM_NULL, context.get()) == 0);
+
+    NeoN::Vector<NeoN::scalar> x(exec, {1.0, -2.0, 3.0});
+    NeoN::sundials::NVectorPtr xN(NeoN::sundials::wrapVector(x, *context));
+
+    SECTION("Wraps the vector without copies " + execName)
+    {
+        REQUIRE(N_VGetLength(xN.get()) == 3);
+        REQUIRE(&NeoN::sundials::getVector(xN.get()) == &x);
+
+        // writing through the N_Vector changes the wrapped vector
+        N_VScale(2.0, xN.get(), xN.get());
+        auto xHost = x.copyToHost();
+        REQUIRE(xHost.view()[0] == 2.0);
+        REQUIRE(xHost.view()[1] == -4.0);
+        REQUIRE(xHost.view()[2] == 6.0);
+    }
+
+    SECTION("Clones own a vector on the same executor " + execName)
+    {
+        NeoN::sundials::NVectorPtr yN(N_VClone(xN.get()));
+        auto& y = NeoN::sundials::getVector(yN.get());
+        REQUIRE(y.size() == 3);
+        REQUIRE(y.exec() == exec);
+        REQUIRE(y.data() != x.data());
+    }
+
+    SECTION("Vector operations " + execName)
+    {
+        NeoN::sundials::NVectorPtr yN(N_VClone(xN.get()));
+        NeoN::sundials::NVectorPtr wN(N_VClone(xN.get()));
+        N_VConst(1.0, yN.get());
+        N_VConst(0.5, wN.get());
+
+        N_VLinearSum(2.0, xN.get(), 1.0, yN.get(), yN.get());
+        auto yHost = NeoN::sundials::getVector(yN.get()).copyToHost();
+        REQUIRE(yHost.view()[0] == 3.0);
+        REQUIRE(yHost.view()[1] == -3.0);
+        REQUIRE(yHost.view()[2] == 7.0);
+
+        REQUIRE(N_VDotProd(xN.get(), yN.get()) == Catch::Approx(30.0));
+        REQUIRE(N_VMaxNorm(xN.get()) == Catch::Approx(3.0));
+        REQUIRE(N_VMin(xN.get()) == Catch::Approx(-2.0));
+        REQUIRE(N_VL1Norm(xN.get()) == Catch::Approx(6.0));
+        REQUIRE(N_VWL2Norm(xN.get(), wN.get()) == Catch::Approx(0.5 * std::sqrt(14.0)));
+        REQUIRE(N_VWrmsNorm(xN.get(), wN.get()) == Catch::Approx(0.5 * std::sqrt(14.0 / 3.0)));
+        REQUIRE(N_VMinQuotient(xN.get(), wN.get()) == Catch::Approx(-4.0));
+
+        N_VConst(0.0, wN.get());
+        REQUIRE(N_VInvTest(wN.get(), yN.get()) == SUNFALSE);
+        REQUIRE(N_VInvTest(xN.get(), yN.get()) == SUNTRUE);
+    }
+}
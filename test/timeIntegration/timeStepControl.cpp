@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2025 NeoN authors
+//
+// SPDX-License-Identifier: MIT
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include "catch2_common.hpp"
+
+#include "NeoN/NeoN.hpp"
+
+namespace fvcc = NeoN::finiteVolume::cellCentred;
+
+TEST_CASE("TimeStepControl")
+{
+    auto [execName, exec] = GENERATE(allAvailableExecutor());
+
+    NeoN::UnstructuredMesh mesh = NeoN::create1DUniformMesh(exec, 4);
+    std::vector<fvcc::SurfaceBoundary<NeoN::scalar>> bcs {};
+    for (auto patchi : std::initializer_list<NeoN::localIdx> {0, 1})
+    {
+        NeoN::Dictionary dict;
+        dict.insert("type", std::string("fixedValue"));
+        dict.insert("fixedValue", 1.0);
+        bcs.push_back(fvcc::SurfaceBoundary<NeoN::scalar>(mesh, dict, patchi));
+    }
+    fvcc::SurfaceField<NeoN::scalar> faceFlux(exec, "faceFlux", mesh, bcs);
+    NeoN::fill(faceFlux.internalVector(), 1.0);
+    faceFlux.correctBoundaryConditions();
+
+    // the maximum courant number is 0.04 for a time step size of 0.01
+    const NeoN::scalar dt = 0.01;
+    NeoN::Dictionary controlDict;
+    controlDict.insert("maxCo", 0.5);
+
+    SECTION("growth is limited on " + execName)
+    {
+        NeoN::timeIntegration::TimeStepControl control(controlDict);
+        REQUIRE(control.deltaT(faceFlux, dt) == Catch::Approx(1.2 * dt));
+    }
+
+    SECTION("reaches the target courant number on " + execName)
+    {
+        controlDict.insert("maxGrowth", 100.0);
+        NeoN::timeIntegration::TimeStepControl control(controlDict);
+        auto newDt = control.deltaT(faceFlux, dt);
+        REQUIRE(newDt == Catch::Approx(0.125));
+        REQUIRE(fvcc::computeMaxCoNum(faceFlux, newDt) == Catch::Approx(0.5));
+    }
+
+    SECTION("shrinks to the target courant number on " + execName)
+    {
+        controlDict.insert("maxCo", 0.02);
+        NeoN::timeIntegration::TimeStepControl control(controlDict);
+        REQUIRE(control.deltaT(faceFlux, dt) == Catch::Approx(0.5 * dt));
+    }
+
+    SECTION("respects maxDeltaT on " + execName)
+    {
+        controlDict.insert("maxDeltaT", 0.011);
+        NeoN::timeIntegration::TimeStepControl control(controlDict);
+        REQUIRE(control.deltaT(faceFlux, dt) == Catch::Approx(0.011));
+    }
+
+    SECTION("uses the error estimate on " + execName)
+    {
+        NeoN::timeIntegration::TimeStepControl control(controlDict);
+        NeoN::timeIntegration::ErrorEstimate error {4.0, 1};
+        REQUIRE(control.deltaT(faceFlux, dt, error) == Catch::Approx(0.45 * dt));
+
+        error.norm = 1.0e-6;
+        REQUIRE(control.deltaT(faceFlux, dt, error) == Catch::Approx(1.2 * dt));
+
+        error.norm = 1.0e6;
+        REQUIRE(control.deltaT(faceFlux, dt, error) == Catch::Approx(0.1 * dt));
+    }
+}